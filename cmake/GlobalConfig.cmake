@@ -41,6 +41,8 @@ option(BUILD_PIPE_ONLY "Build the PIPE libraries only" OFF)
 option(BUILD_CLASSIC_DELEGATE "Build the Arm NN TfLite delegate" OFF)
 option(BUILD_OPAQUE_DELEGATE "Build the Arm NN TfLite Opaque delegate" OFF)
 option(BUILD_MEMORY_STRATEGY_BENCHMARK "Build the MemoryBenchmark" OFF)
+option(BUILD_OPTIMIZE_BENCHMARK "Build the OptimizeBenchmark" OFF)
+option(BUILD_PARTITION_BENCHMARK "Build the PartitionBenchmark" OFF)
 option(BUILD_BARE_METAL "Disable features requiring operating system support" OFF)
 option(BUILD_SHARED_LIBS "Determines if Armnn will be built statically or dynamically.
                           This is an experimental feature and not fully supported.
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2019,2021-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2019,2021-2024,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -18,6 +18,7 @@
 namespace armnn
 {
 class ILayerSupport;
+class LayerSupportCache;
 class TensorInfo;
 struct LstmInputParamsInfo;
 struct QuantizedLstmInputParamsInfo;
@@ -37,6 +38,11 @@ public:
 
     bool IsBackendRegistered() const;
 
+    /// Memoizes the answers of this handle and of its copies made from now on. Asking again about a layer of the same
+    /// type, with an equal descriptor and equal TensorInfos (including their quantization), returns the first answer,
+    /// and appends its reason, without querying the backend. Queries with LSTM parameters are not cached.
+    void EnableCache();
+
     bool IsActivationSupported(const TensorInfo& input,
                                const TensorInfo& output,
                                const ActivationDescriptor& descriptor,
@@ -470,8 +476,17 @@ public:
         Optional<std::string&> reasonIfUnsupported = EmptyOptional());
 
 private:
+    template <typename DescriptorT>
+    bool IsLayerSupported(const LayerType& type,
+                          const std::vector<TensorInfo>& infos,
+                          const DescriptorT& descriptor,
+                          const Optional<LstmInputParamsInfo>& lstmParamsInfo,
+                          const Optional<QuantizedLstmInputParamsInfo>& quantizedLstmParamsInfo,
+                          Optional<std::string&> reasonIfUnsupported);
+
     std::shared_ptr<ILayerSupport> m_LayerSupport;
     const BackendId m_BackendId;
+    std::shared_ptr<LayerSupportCache> m_Cache;
 };
 
 /// Convenience function to retrieve the ILayerSupportHandle for a backend
@@ -940,6 +940,40 @@ struct FillDescriptor : BaseDescriptor
     float m_Value;
 };
 
+/// An operation of the program run by a FusedLayer of type FusedKernelType::Elementwise.
+/// Operands index the inputs of the FusedLayer first, followed by the results of the preceding operations.
+struct FusedElementwiseOperation
+{
+    FusedElementwiseOperation()
+        : m_LayerType(LayerType::ElementwiseBinary)
+        , m_FirstOperand(0)
+        , m_SecondOperand(0)
+    {}
+
+    bool operator ==(const FusedElementwiseOperation& rhs) const
+    {
+        return m_LayerType     == rhs.m_LayerType &&
+               m_Activation    == rhs.m_Activation &&
+               m_Binary        == rhs.m_Binary &&
+               m_Unary         == rhs.m_Unary &&
+               m_FirstOperand  == rhs.m_FirstOperand &&
+               m_SecondOperand == rhs.m_SecondOperand;
+    }
+
+    /// The type of layer the operation computes: Activation, ElementwiseBinary or ElementwiseUnary.
+    LayerType m_LayerType;
+    /// Parameters of an Activation operation.
+    ActivationDescriptor m_Activation;
+    /// Parameters of an ElementwiseBinary operation.
+    ElementwiseBinaryDescriptor m_Binary;
+    /// Parameters of an ElementwiseUnary operation.
+    ElementwiseUnaryDescriptor m_Unary;
+    /// Index of the first operand.
+    unsigned int m_FirstOperand;
+    /// Index of the second operand, only used by ElementwiseBinary operations.
+    unsigned int m_SecondOperand;
+};
+
 /// A FusedDescriptor for the FusedLayer.
 struct FusedDescriptor : BaseDescriptor
 {
@@ -953,12 +987,16 @@ struct FusedDescriptor : BaseDescriptor
     {
         return m_NumInputSlots  == rhs.m_NumInputSlots &&
                m_NumOutputSlots == rhs.m_NumOutputSlots &&
-               m_FusedKernelType == rhs.m_FusedKernelType;
+               m_FusedKernelType == rhs.m_FusedKernelType &&
+               m_ElementwiseProgram == rhs.m_ElementwiseProgram;
     }
 
     unsigned int m_NumInputSlots;
     unsigned int m_NumOutputSlots;
     FusedKernelType m_FusedKernelType;
+    /// Operations run for each element by a FusedKernelType::Elementwise layer, in execution order.
+    /// The result of the last operation is the single output of the layer.
+    std::vector<FusedElementwiseOperation> m_ElementwiseProgram;
 };
 
 /// A GatherDescriptor for the GatherLayer.
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <map>
+#include <ostream>
 
 namespace arm
 {
@@ -44,12 +45,18 @@ struct INetworkProperties
                        MemorySource outputSource,
                        bool profilingEnabled = false,
                        ProfilingDetailsMethod detailsMethod = ProfilingDetailsMethod::Undefined,
-                       bool externalMemoryManagementEnabled = false)
+                       bool externalMemoryManagementEnabled = false,
+                       size_t workingMemoryBudget = 0,
+                       bool allocateWorkingMemoryOnLoad = false,
+                       unsigned int numWarmUpInferences = 0)
         : m_ProfilingEnabled(profilingEnabled),
           m_OutputNetworkDetailsMethod(detailsMethod),
           m_InputSource(inputSource),
           m_OutputSource(outputSource),
-          m_ExternalMemoryManagementEnabled(externalMemoryManagementEnabled)
+          m_ExternalMemoryManagementEnabled(externalMemoryManagementEnabled),
+          m_WorkingMemoryBudget(workingMemoryBudget),
+          m_AllocateWorkingMemoryOnLoad(allocateWorkingMemoryOnLoad),
+          m_NumWarmUpInferences(numWarmUpInferences)
     {}
 
     const bool m_ProfilingEnabled;
@@ -61,9 +68,41 @@ struct INetworkProperties
 
     const bool m_ExternalMemoryManagementEnabled;
 
+    /// The most working memory, in bytes, the intermediate tensors of the network may use across all backends, or 0
+    /// for no limit. When the default execution order needs more, LoadNetwork looks for an order and a memory plan
+    /// that fit, and fails if it finds none.
+    const size_t m_WorkingMemoryBudget;
+
+    /// Allocates the working memory in LoadNetwork and touches each of its pages, rather than on the first inference.
+    /// As usual, the working memory is freed when an inference of another network follows one of this network on the
+    /// same thread.
+    const bool m_AllocateWorkingMemoryOnLoad;
+
+    /// The number of inferences LoadNetwork runs on inputs of zeros, so that any lazy setup of the backends is done
+    /// before the first inference of the user. With profiling enabled, the first one is reported as the event
+    /// "LoadNetwork_ColdInference" and the others as "LoadNetwork_WarmUpInference".
+    const unsigned int m_NumWarmUpInferences;
+
     virtual ~INetworkProperties() {}
 };
 
+/// Memory used by a loaded network on one of its backends, in bytes.
+struct MemoryStatistics
+{
+    /// Constant tensors, such as weights and biases.
+    size_t m_ConstantBytes = 0;
+
+    /// Working memory planned for the intermediate tensors, or 0 when the backend does not report it.
+    size_t m_WorkingMemoryBytes = 0;
+
+    /// The largest total size of the intermediate tensors that are alive at the same time in the execution order.
+    /// No plan of the working memory can be smaller than this.
+    size_t m_MinimumWorkingMemoryBytes = 0;
+
+    /// User buffers pinned by ImportInputs and ImportOutputs until they are cleared.
+    size_t m_ImportedBytes = 0;
+};
+
 class IRuntime
 {
 public:
@@ -103,7 +142,7 @@ public:
         /// Set this if you need to take control of how memory is allocated on a backend. Required for
         /// Protected Mode in order to correctly allocate Protected Memory
         ///
-        /// @note Only supported for GpuAcc
+        /// @note Only supported for GpuAcc and, with MemorySource::Malloc allocators, CpuRef
         std::map<BackendId, std::shared_ptr<ICustomAllocator>> m_CustomAllocatorMap;
 
         /// @brief A map to define a custom memory optimizer strategy for specific backend Ids.
@@ -255,6 +294,46 @@ public:
     /// @param func callback function to pass to the debug layer.
     void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func);
 
+    /// Gets the memory used by a loaded network on each of its backends.
+    /// @param networkId The id of the network for which to get the statistics.
+    /// @return The statistics of each backend used by the network, or an empty map if the network is not found.
+    std::map<BackendId, MemoryStatistics> GetMemoryStatistics(NetworkId networkId) const;
+
+    /// Writes the lifetime and size of the memory blocks planned for the intermediate tensors of a loaded network, as
+    /// text with one block per line: "<backend> <start of life> <end of life> <size in bytes> <index>". The trace can
+    /// be replayed by MemoryStrategyBenchmark to compare the memory optimizer strategies on real networks.
+    /// Only networks loaded with external memory management enabled plan their memory this way.
+    /// @param networkId The id of the network.
+    /// @param stream The stream to write the memory blocks to.
+    /// @return Status::Failure if the network is not found or does not use external memory management.
+    Status SerializeMemoryProfile(NetworkId networkId, std::ostream& stream) const;
+
+    /// Makes an input and an output of a loaded network a state tensor, such as the hidden state of a recurrent
+    /// network or the key-value cache of a decoder. The network keeps the state between executions: each execution
+    /// reads it through the input and replaces it with the value of the output. Neither tensor is then passed to
+    /// EnqueueWorkload. Where the backend can import the memory of the state, no copy is made. The state starts as
+    /// zeros. This function is not thread safe and must not be used while other threads are calling Execute().
+    /// @param networkId The id of the network.
+    /// @param inputId The binding id of the input that reads the state.
+    /// @param outputId The binding id of the output that updates the state. Its shape and type must match the input's.
+    void AddStateTensor(NetworkId networkId, LayerBindingId inputId, LayerBindingId outputId);
+
+    /// Sets all the state tensors of a loaded network to zeros.
+    /// @param networkId The id of the network.
+    void ResetStateTensors(NetworkId networkId);
+
+    /// Copies the current value of a state tensor, for example to take a snapshot of it.
+    /// @param networkId The id of the network.
+    /// @param inputId The binding id of the input that reads the state.
+    /// @param tensor The tensor to copy the state into. Its TensorInfo must match the state's.
+    void GetStateTensor(NetworkId networkId, LayerBindingId inputId, const Tensor& tensor) const;
+
+    /// Sets the value of a state tensor, for example to restore a snapshot of it.
+    /// @param networkId The id of the network.
+    /// @param inputId The binding id of the input that reads the state.
+    /// @param tensor The tensor to copy the state from. Its TensorInfo must match the state's.
+    void SetStateTensor(NetworkId networkId, LayerBindingId inputId, const ConstTensor& tensor);
+
 protected:
     IRuntime();
     IRuntime(const IRuntime::CreationOptions& options);
@@ -266,7 +266,8 @@ enum class MemBlockStrategyType
 
 enum class FusedKernelType
 {
-    AddMulAdd  = 0
+    AddMulAdd   = 0,
+    Elementwise = 1
 };
 
 /// Each backend should implement an IBackend.
@@ -122,6 +122,7 @@ constexpr char const* GetFusedTypeAsCString(FusedKernelType type)
     switch (type)
     {
         case FusedKernelType::AddMulAdd:   return "AddMulAdd";
+        case FusedKernelType::Elementwise: return "Elementwise";
         default:                           return "Unknown";
     }
 }
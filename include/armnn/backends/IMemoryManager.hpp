@@ -1,9 +1,10 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace armnn
@@ -18,6 +19,10 @@ public:
     virtual void Acquire() = 0;
     virtual void Release() = 0;
 
+    /// Returns the number of bytes Acquire allocates for the managed tensors, or 0 when the memory manager does not
+    /// report it.
+    virtual size_t GetManagedMemorySize() const { return 0; }
+
     virtual ~IMemoryManager() {}
 };
 
@@ -1,5 +1,5 @@
 //
-// Copyright © 2020-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2020-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -7,6 +7,9 @@
 #include <armnn/Types.hpp>
 #include <armnn/backends/WorkloadInfo.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace armnn
 {
 
@@ -40,6 +43,14 @@ public:
     {
         return armnn::EmptyOptional();
     }
+
+    // Returns pairs of (output slot, input slot) indices whose tensors may share the same memory. A workload declares
+    // a pair when it reads each element of the input before it writes the same element of the output, so that the
+    // output can overwrite the input when both have the same number of elements and data type.
+    virtual std::vector<std::pair<unsigned int, unsigned int>> GetInPlaceSlots() const
+    {
+        return {};
+    }
 };
 
 }; //namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021-2023,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -17,6 +17,7 @@ namespace armnn
 {
 
 class Layer;
+class LayerSupportHandle;
 
 // Workload factory interface for compute backends.
 class IWorkloadFactory
@@ -48,6 +49,13 @@ public:
                                  std::string& outReasonIfUnsupported,
                                  const ModelOptions& modelOptions);
 
+    /// Asks the given handle on the layer support of the backend of the layer, which can cache the answers of repeated
+    /// queries, instead of creating a new one for the query.
+    static bool IsLayerSupported(LayerSupportHandle& layerSupport,
+                                 const IConnectableLayer& layer,
+                                 Optional<DataType> dataType,
+                                 std::string& outReasonIfUnsupported);
+
     virtual bool SupportsSubTensors() const = 0;
 
     ARMNN_DEPRECATED_MSG("Use ITensorHandleFactory::CreateSubTensorHandle instead")
@@ -78,6 +86,11 @@ private:
                                               Optional<DataType> dataType,
                                               std::string& outReasonIfUnsupported,
                                               const ModelOptions& modelOptions = {});
+
+    static bool IsLayerConfigurationSupported(LayerSupportHandle& layerSupport,
+                                              const IConnectableLayer& connectableLayer,
+                                              Optional<DataType> dataType,
+                                              std::string& outReasonIfUnsupported);
 };
 
 } // namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2022, 2025 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022, 2025-2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -20,7 +20,10 @@ static const uint16_t NETWORK_UNLOADS       = 1;
 static const uint16_t REGISTERED_BACKENDS   = 2;
 static const uint16_t UNREGISTERED_BACKENDS = 3;
 static const uint16_t INFERENCES_RUN        = 4;
-static const uint16_t MAX_ARMNN_COUNTER     = INFERENCES_RUN;
+static const uint16_t CONSTANT_MEMORY       = 5;
+static const uint16_t WORKING_MEMORY        = 6;
+static const uint16_t IMPORTED_MEMORY       = 7;
+static const uint16_t MAX_ARMNN_COUNTER     = IMPORTED_MEMORY;
 
 // Static holding Arm NN's software descriptions
 static std::string ARMNN_SOFTWARE_INFO("ArmNN");
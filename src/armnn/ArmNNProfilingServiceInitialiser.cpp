@@ -1,5 +1,5 @@
 //
-// Copyright © 2022,2024 Arm Ltd. All rights reserved.
+// Copyright © 2022,2024,2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -11,6 +11,10 @@
 
 #include <common/include/Counter.hpp>
 
+#include <string>
+#include <tuple>
+#include <vector>
+
 namespace armnn
 {
 
@@ -122,6 +126,39 @@ void ArmNNProfilingServiceInitialiser::InitialiseProfilingService(arm::pipe::IPr
 
         profilingService.InitializeCounterValue(inferencesRunCounter->m_Uid);
     }
+    // Register counters for the memory used by the loaded networks. The counters count kilobytes.
+    std::string ArmNN_Memory("ArmNN_Memory");
+    if (!profilingService.IsCategoryRegistered(ArmNN_Memory))
+    {
+        profilingService.GetCounterRegistry().RegisterCategory(ArmNN_Memory);
+    }
+    std::string bytes("bytes");
+    const std::vector<std::tuple<uint16_t, std::string, std::string>> memoryCounters =
+    {
+        { arm::pipe::CONSTANT_MEMORY, "Constant memory", "The memory held by the constant tensors of loaded networks" },
+        { arm::pipe::WORKING_MEMORY, "Working memory",
+          "The memory planned for the intermediate tensors of loaded networks" },
+        { arm::pipe::IMPORTED_MEMORY, "Imported memory", "The user memory pinned by imported inputs and outputs" }
+    };
+    for (const auto& memoryCounter : memoryCounters)
+    {
+        const std::string& name = std::get<1>(memoryCounter);
+        if (!profilingService.IsCounterRegistered(name))
+        {
+            const arm::pipe::Counter* counter =
+                profilingService.GetCounterRegistry().RegisterCounter(armnn::profiling::BACKEND_ID.Get(),
+                                                                      std::get<0>(memoryCounter),
+                                                                      ArmNN_Memory,
+                                                                      ZERO,
+                                                                      ZERO,
+                                                                      1024.0,
+                                                                      name,
+                                                                      std::get<2>(memoryCounter),
+                                                                      bytes);
+
+            profilingService.InitializeCounterValue(counter->m_Uid);
+        }
+    }
 }
 
 } // namespace armnn
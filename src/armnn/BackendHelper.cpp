@@ -1,5 +1,5 @@
 //
-// Copyright © 2017,2022-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017,2022-2024,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -14,6 +14,8 @@
 #include <armnn/backends/ILayerSupport.hpp>
 #include <armnn/backends/IBackendInternal.hpp>
 
+#include "LayerSupportCache.hpp"
+
 #include <stddef.h>
 
 namespace armnn
@@ -149,6 +151,40 @@ bool LayerSupportHandle::IsBackendRegistered() const
     return false;
 }
 
+void LayerSupportHandle::EnableCache()
+{
+    if (!m_Cache)
+    {
+        m_Cache = std::make_shared<LayerSupportCache>();
+    }
+}
+
+template <typename DescriptorT>
+bool LayerSupportHandle::IsLayerSupported(const LayerType& type,
+                                          const std::vector<TensorInfo>& infos,
+                                          const DescriptorT& descriptor,
+                                          const Optional<LstmInputParamsInfo>& lstmParamsInfo,
+                                          const Optional<QuantizedLstmInputParamsInfo>& quantizedLstmParamsInfo,
+                                          Optional<std::string&> reasonIfUnsupported)
+{
+    auto query = [&](Optional<std::string&> reason)
+    {
+        return m_LayerSupport->IsLayerSupported(type,
+                                                infos,
+                                                descriptor,
+                                                lstmParamsInfo,
+                                                quantizedLstmParamsInfo,
+                                                reason);
+    };
+
+    // The LSTM parameters only hold pointers to their TensorInfos, so those queries are not cached.
+    if (!m_Cache || lstmParamsInfo.has_value() || quantizedLstmParamsInfo.has_value())
+    {
+        return query(reasonIfUnsupported);
+    }
+    return m_Cache->IsLayerSupported(type, infos, descriptor, reasonIfUnsupported, query);
+}
+
 using TensorInfos = std::vector<TensorInfo>;
 
 bool LayerSupportHandle::IsActivationSupported(const TensorInfo& input,
@@ -158,12 +194,12 @@ bool LayerSupportHandle::IsActivationSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Activation,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Activation,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsAdditionSupported(const TensorInfo& input0,
@@ -173,12 +209,12 @@ bool LayerSupportHandle::IsAdditionSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Addition,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Addition,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsArgMinMaxSupported(const TensorInfo& input,
@@ -188,12 +224,12 @@ bool LayerSupportHandle::IsArgMinMaxSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ArgMinMax,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ArgMinMax,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsBatchMatMulSupported(const TensorInfo& input0,
@@ -204,12 +240,12 @@ bool LayerSupportHandle::IsBatchMatMulSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::BatchMatMul,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::BatchMatMul,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsBatchNormalizationSupported(const TensorInfo& input,
@@ -223,12 +259,12 @@ bool LayerSupportHandle::IsBatchNormalizationSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output, mean, var, beta, gamma};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::BatchNormalization,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::BatchNormalization,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsBatchToSpaceNdSupported(const TensorInfo& input,
@@ -238,12 +274,12 @@ bool LayerSupportHandle::IsBatchToSpaceNdSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::BatchToSpaceNd,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::BatchToSpaceNd,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 
@@ -254,12 +290,12 @@ bool LayerSupportHandle::IsBroadcastToSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::BroadcastTo,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported.value());
+    return IsLayerSupported(LayerType::BroadcastTo,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported.value());
 }
 
 bool LayerSupportHandle::IsCastSupported(const TensorInfo& input,
@@ -268,12 +304,12 @@ bool LayerSupportHandle::IsCastSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Cast,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Cast,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsChannelShuffleSupported(const TensorInfo &input,
@@ -283,12 +319,12 @@ bool LayerSupportHandle::IsChannelShuffleSupported(const TensorInfo &input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ChannelShuffle,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ChannelShuffle,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsComparisonSupported(const TensorInfo& input0,
@@ -299,12 +335,12 @@ bool LayerSupportHandle::IsComparisonSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Comparison,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Comparison,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsConcatSupported(const std::vector<const TensorInfo*> inputs,
@@ -319,12 +355,12 @@ bool LayerSupportHandle::IsConcatSupported(const std::vector<const TensorInfo*>
     }
     infos.push_back(output);
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Concat,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Concat,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsConstantSupported(const TensorInfo& output,
@@ -332,12 +368,12 @@ bool LayerSupportHandle::IsConstantSupported(const TensorInfo& output,
 {
     TensorInfos infos{output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Constant,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Constant,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsConvertFp16ToFp32Supported(const TensorInfo& input,
@@ -346,12 +382,12 @@ bool LayerSupportHandle::IsConvertFp16ToFp32Supported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ConvertFp16ToFp32,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ConvertFp16ToFp32,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsConvertFp32ToFp16Supported(const TensorInfo& input,
@@ -360,12 +396,12 @@ bool LayerSupportHandle::IsConvertFp32ToFp16Supported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ConvertFp32ToFp16,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ConvertFp32ToFp16,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsConvolution2dSupported(const TensorInfo& input,
@@ -414,12 +450,12 @@ bool LayerSupportHandle::IsConvolution2dSupported(const TensorInfo& input,
         }
     }
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Convolution2d,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Convolution2d,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsConvolution3dSupported(const TensorInfo& input,
@@ -432,12 +468,12 @@ bool LayerSupportHandle::IsConvolution3dSupported(const TensorInfo& input,
     TensorInfo biasesVal =  biases.has_value() ? biases.value() : TensorInfo();
     TensorInfos infos{input, output, weights, biasesVal};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Convolution3d,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Convolution3d,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsDebugSupported(const TensorInfo& input,
@@ -446,12 +482,12 @@ bool LayerSupportHandle::IsDebugSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Debug,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Debug,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsDepthToSpaceSupported(const TensorInfo& input,
@@ -461,12 +497,12 @@ bool LayerSupportHandle::IsDepthToSpaceSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::DepthToSpace,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::DepthToSpace,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsDepthwiseConvolutionSupported(
@@ -515,12 +551,12 @@ bool LayerSupportHandle::IsDepthwiseConvolutionSupported(
         }
     }
 
-    return m_LayerSupport->IsLayerSupported(LayerType::DepthwiseConvolution2d,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::DepthwiseConvolution2d,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsDequantizeSupported(const TensorInfo& input,
@@ -529,12 +565,12 @@ bool LayerSupportHandle::IsDequantizeSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Dequantize,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Dequantize,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsDetectionPostProcessSupported(const TensorInfo& boxEncodings,
@@ -549,12 +585,12 @@ bool LayerSupportHandle::IsDetectionPostProcessSupported(const TensorInfo& boxEn
 {
     TensorInfos infos{boxEncodings, scores, anchors, detectionBoxes, detectionClasses, detectionScores, numDetections};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::DetectionPostProcess,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::DetectionPostProcess,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsDilatedDepthwiseConvolutionSupported(
@@ -603,12 +639,12 @@ bool LayerSupportHandle::IsDilatedDepthwiseConvolutionSupported(
         }
     }
 
-    return m_LayerSupport->IsLayerSupported(LayerType::DepthwiseConvolution2d,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::DepthwiseConvolution2d,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsDivisionSupported(const TensorInfo& input0,
@@ -618,12 +654,12 @@ bool LayerSupportHandle::IsDivisionSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Division,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Division,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsElementwiseBinarySupported(const TensorInfo &input0,
@@ -634,12 +670,12 @@ bool LayerSupportHandle::IsElementwiseBinarySupported(const TensorInfo &input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ElementwiseBinary,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ElementwiseBinary,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsElementwiseUnarySupported(const TensorInfo& input,
@@ -649,12 +685,12 @@ bool LayerSupportHandle::IsElementwiseUnarySupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ElementwiseUnary,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ElementwiseUnary,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsFakeQuantizationSupported(const TensorInfo& input,
@@ -663,12 +699,12 @@ bool LayerSupportHandle::IsFakeQuantizationSupported(const TensorInfo& input,
 {
     TensorInfos infos{input};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::FakeQuantization,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::FakeQuantization,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsFillSupported(const TensorInfo& input,
@@ -678,12 +714,12 @@ bool LayerSupportHandle::IsFillSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Fill,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Fill,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsFloorSupported(const TensorInfo& input,
@@ -692,12 +728,12 @@ bool LayerSupportHandle::IsFloorSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Floor,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Floor,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsFullyConnectedSupported(const TensorInfo& input,
@@ -756,12 +792,12 @@ bool LayerSupportHandle::IsFullyConnectedSupported(const TensorInfo& input,
         }
     }
 
-    return m_LayerSupport->IsLayerSupported(LayerType::FullyConnected,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::FullyConnected,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsFusedSupported(const std::vector<std::reference_wrapper<TensorInfo>>& inputs,
@@ -780,12 +816,12 @@ bool LayerSupportHandle::IsFusedSupported(const std::vector<std::reference_wrapp
         infos.emplace_back(outInfo);
     }
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Fused,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Fused,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsGatherSupported(const TensorInfo& input0,
@@ -796,12 +832,12 @@ bool LayerSupportHandle::IsGatherSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Gather,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Gather,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsGatherNdSupported(const TensorInfo& input0,
@@ -811,12 +847,12 @@ bool LayerSupportHandle::IsGatherNdSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::GatherNd,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::GatherNd,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsInputSupported(const TensorInfo& input,
@@ -824,12 +860,12 @@ bool LayerSupportHandle::IsInputSupported(const TensorInfo& input,
 {
     TensorInfos infos{input};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Input,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Input,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsInstanceNormalizationSupported(
@@ -840,12 +876,12 @@ bool LayerSupportHandle::IsInstanceNormalizationSupported(
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::InstanceNormalization,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::InstanceNormalization,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsL2NormalizationSupported(const TensorInfo& input,
@@ -855,12 +891,12 @@ bool LayerSupportHandle::IsL2NormalizationSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::L2Normalization,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::L2Normalization,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsLogicalBinarySupported(const TensorInfo& input0,
@@ -871,12 +907,12 @@ bool LayerSupportHandle::IsLogicalBinarySupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::LogicalBinary,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::LogicalBinary,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsLogicalUnarySupported(const TensorInfo& input,
@@ -886,12 +922,12 @@ bool LayerSupportHandle::IsLogicalUnarySupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ElementwiseUnary,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ElementwiseUnary,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsLogSoftmaxSupported(const TensorInfo& input,
@@ -901,12 +937,12 @@ bool LayerSupportHandle::IsLogSoftmaxSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::LogSoftmax,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::LogSoftmax,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsLstmSupported(const TensorInfo& input,
@@ -922,12 +958,12 @@ bool LayerSupportHandle::IsLstmSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, outputStateIn, cellStateIn, scratchBuffer, outputStateOut, cellStateOut, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Lstm,
-                                            infos,
-                                            descriptor,
-                                            paramsInfo,
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Lstm,
+                            infos,
+                            descriptor,
+                            paramsInfo,
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsMaximumSupported(const TensorInfo& input0,
@@ -937,12 +973,12 @@ bool LayerSupportHandle::IsMaximumSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Maximum,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Maximum,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsMeanSupported(const TensorInfo& input,
@@ -952,12 +988,12 @@ bool LayerSupportHandle::IsMeanSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Mean,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Mean,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsMemCopySupported(const TensorInfo& input,
@@ -966,12 +1002,12 @@ bool LayerSupportHandle::IsMemCopySupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::MemCopy,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::MemCopy,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsMemImportSupported(const TensorInfo& input,
@@ -980,12 +1016,12 @@ bool LayerSupportHandle::IsMemImportSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::MemImport,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::MemImport,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsMergeSupported(const TensorInfo& input0,
@@ -995,12 +1031,12 @@ bool LayerSupportHandle::IsMergeSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Merge,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Merge,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsMinimumSupported(const TensorInfo& input0,
@@ -1010,12 +1046,12 @@ bool LayerSupportHandle::IsMinimumSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Minimum,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Minimum,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsMultiplicationSupported(const TensorInfo& input0,
@@ -1025,12 +1061,12 @@ bool LayerSupportHandle::IsMultiplicationSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Multiplication,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Multiplication,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsNormalizationSupported(const TensorInfo& input,
@@ -1040,12 +1076,12 @@ bool LayerSupportHandle::IsNormalizationSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Normalization,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Normalization,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsOutputSupported(const TensorInfo& output,
@@ -1053,12 +1089,12 @@ bool LayerSupportHandle::IsOutputSupported(const TensorInfo& output,
 {
     TensorInfos infos{output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Output,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Output,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsPadSupported(const TensorInfo& input,
@@ -1068,12 +1104,12 @@ bool LayerSupportHandle::IsPadSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Pad,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Pad,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsPermuteSupported(const TensorInfo& input,
@@ -1083,12 +1119,12 @@ bool LayerSupportHandle::IsPermuteSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Permute,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Permute,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsPooling2dSupported(const TensorInfo& input,
@@ -1098,12 +1134,12 @@ bool LayerSupportHandle::IsPooling2dSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Pooling2d,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Pooling2d,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsPooling3dSupported(const TensorInfo& input,
@@ -1113,12 +1149,12 @@ bool LayerSupportHandle::IsPooling3dSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Pooling3d,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Pooling3d,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsPreCompiledSupported(const TensorInfo& input,
@@ -1127,12 +1163,12 @@ bool LayerSupportHandle::IsPreCompiledSupported(const TensorInfo& input,
 {
     TensorInfos infos{input};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::PreCompiled,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::PreCompiled,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsPreluSupported(const TensorInfo& input,
@@ -1142,12 +1178,12 @@ bool LayerSupportHandle::IsPreluSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, alpha, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Prelu,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Prelu,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsQuantizeSupported(const TensorInfo& input,
@@ -1156,12 +1192,12 @@ bool LayerSupportHandle::IsQuantizeSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Quantize,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Quantize,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsQLstmSupported(const TensorInfo& input,
@@ -1176,12 +1212,12 @@ bool LayerSupportHandle::IsQLstmSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, previousOutputIn, previousCellStateIn, outputStateOut, cellStateOut, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::QLstm,
-                                            infos,
-                                            descriptor,
-                                            paramsInfo,
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::QLstm,
+                            infos,
+                            descriptor,
+                            paramsInfo,
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsQuantizedLstmSupported(const TensorInfo& input,
@@ -1194,12 +1230,12 @@ bool LayerSupportHandle::IsQuantizedLstmSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, previousCellStateIn, previousOutputIn, cellStateOut, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::QuantizedLstm,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            paramsInfo,
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::QuantizedLstm,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            paramsInfo,
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsRankSupported(const TensorInfo& input,
@@ -1208,12 +1244,12 @@ bool LayerSupportHandle::IsRankSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Rank,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Rank,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsReduceSupported(const TensorInfo& input,
@@ -1223,12 +1259,12 @@ bool LayerSupportHandle::IsReduceSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Reduce,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Reduce,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsReshapeSupported(const TensorInfo& input,
@@ -1238,12 +1274,12 @@ bool LayerSupportHandle::IsReshapeSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Reshape,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Reshape,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsResizeSupported(const TensorInfo& input,
@@ -1253,12 +1289,12 @@ bool LayerSupportHandle::IsResizeSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Resize,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Resize,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsReverseV2Supported(const armnn::TensorInfo &input0,
@@ -1268,12 +1304,12 @@ bool LayerSupportHandle::IsReverseV2Supported(const armnn::TensorInfo &input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ReverseV2,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ReverseV2,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsScatterNdSupported(const TensorInfo& input,
@@ -1285,12 +1321,12 @@ bool LayerSupportHandle::IsScatterNdSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, indices, updates, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::ScatterNd,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::ScatterNd,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsShapeSupported(const TensorInfo& input,
@@ -1299,12 +1335,12 @@ bool LayerSupportHandle::IsShapeSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Shape,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Shape,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsSliceSupported(const TensorInfo& input,
@@ -1314,12 +1350,12 @@ bool LayerSupportHandle::IsSliceSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Slice,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Slice,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsSoftmaxSupported(const TensorInfo& input,
@@ -1329,12 +1365,12 @@ bool LayerSupportHandle::IsSoftmaxSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Softmax,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Softmax,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsSpaceToBatchNdSupported(const TensorInfo& input,
@@ -1344,12 +1380,12 @@ bool LayerSupportHandle::IsSpaceToBatchNdSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::SpaceToBatchNd,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::SpaceToBatchNd,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsSpaceToDepthSupported(const TensorInfo& input,
@@ -1359,12 +1395,12 @@ bool LayerSupportHandle::IsSpaceToDepthSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::SpaceToDepth,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::SpaceToDepth,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsSplitterSupported(const TensorInfo& input,
@@ -1378,12 +1414,12 @@ bool LayerSupportHandle::IsSplitterSupported(const TensorInfo& input,
         infos.push_back(outInfo);
     }
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Splitter,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Splitter,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsStackSupported(const std::vector<const TensorInfo*>& inputs,
@@ -1398,12 +1434,12 @@ bool LayerSupportHandle::IsStackSupported(const std::vector<const TensorInfo*>&
     }
     infos.push_back(output);
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Stack,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Stack,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsStandInSupported(const std::vector<const TensorInfo*>& inputs,
@@ -1421,12 +1457,12 @@ bool LayerSupportHandle::IsStandInSupported(const std::vector<const TensorInfo*>
         infos.push_back(*outputInfo);
     }
 
-    return m_LayerSupport->IsLayerSupported(LayerType::StandIn,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::StandIn,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 
@@ -1437,12 +1473,12 @@ bool LayerSupportHandle::IsStridedSliceSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::StridedSlice,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::StridedSlice,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsSubtractionSupported(const TensorInfo& input0,
@@ -1452,12 +1488,12 @@ bool LayerSupportHandle::IsSubtractionSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Subtraction,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Subtraction,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsSwitchSupported(const TensorInfo& input0,
@@ -1468,12 +1504,12 @@ bool LayerSupportHandle::IsSwitchSupported(const TensorInfo& input0,
 {
     TensorInfos infos{input0, input1, output0, output1};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Switch,
-                                            infos,
-                                            BaseDescriptor(),
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Switch,
+                            infos,
+                            BaseDescriptor(),
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsTileSupported(const TensorInfo& input,
@@ -1483,12 +1519,12 @@ bool LayerSupportHandle::IsTileSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Tile,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Tile,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsTransposeConvolution2dSupported(
@@ -1502,12 +1538,12 @@ bool LayerSupportHandle::IsTransposeConvolution2dSupported(
     TensorInfo biasesVal =  biases.has_value() ? biases.value() : TensorInfo();
     TensorInfos infos{input, output, weights, biasesVal};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::TransposeConvolution2d,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::TransposeConvolution2d,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsTransposeSupported(const TensorInfo& input,
@@ -1517,12 +1553,12 @@ bool LayerSupportHandle::IsTransposeSupported(const TensorInfo& input,
 {
     TensorInfos infos{input, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::Transpose,
-                                            infos,
-                                            descriptor,
-                                            EmptyOptional(),
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::Transpose,
+                            infos,
+                            descriptor,
+                            EmptyOptional(),
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 bool LayerSupportHandle::IsUnidirectionalSequenceLstmSupported(const TensorInfo& input,
@@ -1537,12 +1573,12 @@ bool LayerSupportHandle::IsUnidirectionalSequenceLstmSupported(const TensorInfo&
 {
     TensorInfos infos{input, outputStateIn, cellStateIn, outputStateOut, cellStateOut, output};
 
-    return m_LayerSupport->IsLayerSupported(LayerType::UnidirectionalSequenceLstm,
-                                            infos,
-                                            descriptor,
-                                            paramsInfo,
-                                            EmptyOptional(),
-                                            reasonIfUnsupported);
+    return IsLayerSupported(LayerType::UnidirectionalSequenceLstm,
+                            infos,
+                            descriptor,
+                            paramsInfo,
+                            EmptyOptional(),
+                            reasonIfUnsupported);
 }
 
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017,2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -7,9 +7,11 @@
 
 #include "DeviceSpec.hpp"
 
+#include <armnn/BackendHelper.hpp>
 #include <armnn/BackendId.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 
+#include <map>
 #include <vector>
 
 namespace armnn
@@ -22,6 +24,10 @@ struct BackendSettings
     BackendIdSet    m_SelectedBackends;
     BackendIdSet    m_IgnoredBackends;
 
+    /// Handles on the layer support of the backends, created on first use with their cache enabled, so that a layer
+    /// support query is only put to a backend once during an optimization.
+    std::map<BackendId, LayerSupportHandle> m_LayerSupportHandles;
+
     BackendSettings() = default;
 
     BackendSettings(const BackendIdVector& preferredBackends,
@@ -35,6 +41,7 @@ struct BackendSettings
         , m_SupportedBackends(other.m_SupportedBackends)
         , m_SelectedBackends(other.m_SelectedBackends)
         , m_IgnoredBackends(other.m_IgnoredBackends)
+        , m_LayerSupportHandles(other.m_LayerSupportHandles)
     {
     }
 
@@ -64,6 +71,17 @@ struct BackendSettings
         return IsBackendSupported(cpuBackendId) && IsBackendPreferred(cpuBackendId);
     }
 
+    LayerSupportHandle& GetLayerSupportHandle(const BackendId& backend)
+    {
+        auto it = m_LayerSupportHandles.find(backend);
+        if (it == m_LayerSupportHandles.end())
+        {
+            it = m_LayerSupportHandles.emplace(backend, GetILayerSupportByBackendId(backend)).first;
+            it->second.EnableCache();
+        }
+        return it->second;
+    }
+
     BackendIdVector GetAvailablePreferredBackends() const
     {
         BackendIdVector availablePreferredBackends;
@@ -0,0 +1,94 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ConstantTensorCache.hpp"
+
+#include <cstring>
+#include <string_view>
+
+namespace armnn
+{
+
+namespace
+{
+
+void HashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+} // anonymous namespace
+
+size_t ConstantTensorCache::HashTensor(const ConstTensorHandle& constantTensor)
+{
+    const TensorInfo& info = constantTensor.GetTensorInfo();
+    size_t seed = std::hash<int>()(static_cast<int>(info.GetDataType()));
+    HashCombine(seed, std::hash<unsigned int>()(info.GetNumElements()));
+    HashCombine(seed, std::hash<std::string_view>()(
+        std::string_view(static_cast<const char*>(constantTensor.Map(true)), info.GetNumBytes())));
+    return seed;
+}
+
+std::shared_ptr<ConstTensorHandle> ConstantTensorCache::Share(const std::shared_ptr<ConstTensorHandle>& constantTensor)
+{
+    if (!constantTensor || !constantTensor->Map(true))
+    {
+        return constantTensor;
+    }
+    const TensorInfo& info = constantTensor->GetTensorInfo();
+    const size_t hash = HashTensor(*constantTensor);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto range = m_Tensors.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        std::shared_ptr<ConstTensorHandle> cachedTensor = it->second.lock();
+        if (!cachedTensor)
+        {
+            it = m_Tensors.erase(it);
+            continue;
+        }
+        if (cachedTensor->GetTensorInfo() == info &&
+            std::memcmp(cachedTensor->Map(true), constantTensor->Map(true), info.GetNumBytes()) == 0)
+        {
+            return cachedTensor;
+        }
+        ++it;
+    }
+
+    m_Tensors.emplace(hash, constantTensor);
+    return constantTensor;
+}
+
+size_t ConstantTensorCache::GetNumTensors() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    RemoveExpiredTensors();
+    return m_Tensors.size();
+}
+
+size_t ConstantTensorCache::GetNumBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    size_t numBytes = 0;
+    for (auto&& entry : m_Tensors)
+    {
+        if (std::shared_ptr<ConstTensorHandle> cachedTensor = entry.second.lock())
+        {
+            numBytes += cachedTensor->GetTensorInfo().GetNumBytes();
+        }
+    }
+    return numBytes;
+}
+
+void ConstantTensorCache::RemoveExpiredTensors() const
+{
+    for (auto it = m_Tensors.begin(); it != m_Tensors.end();)
+    {
+        it = it->second.expired() ? m_Tensors.erase(it) : std::next(it);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,44 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/backends/TensorHandle.hpp>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace armnn
+{
+
+/// Shares the data of identical constant tensors, such as the weights of a model loaded several times, between the
+/// networks loaded in a runtime. Tensors are looked up by a hash of their TensorInfo and content, and compared in full
+/// on a match. The cache only holds weak references, so the data is freed once no loaded network uses it anymore.
+/// The cache is thread safe.
+class ConstantTensorCache
+{
+public:
+    /// Returns a tensor in use elsewhere with the same TensorInfo and content as constantTensor, or adds constantTensor
+    /// to the cache and returns it if there is none. The data of the returned tensor must not be modified.
+    std::shared_ptr<ConstTensorHandle> Share(const std::shared_ptr<ConstTensorHandle>& constantTensor);
+
+    /// Returns the number of different constant tensors in use.
+    size_t GetNumTensors() const;
+
+    /// Returns the size in bytes of the different constant tensors in use.
+    size_t GetNumBytes() const;
+
+private:
+    static size_t HashTensor(const ConstTensorHandle& constantTensor);
+
+    /// Forgets the tensors that are not in use anymore.
+    void RemoveExpiredTensors() const;
+
+    mutable std::mutex m_Mutex;
+    mutable std::unordered_multimap<size_t, std::weak_ptr<ConstTensorHandle>> m_Tensors;
+};
+
+} // namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -17,7 +17,11 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <unordered_map>
+#include <vector>
 #include <DotSerializer.hpp>
 #include <sstream>
 
@@ -204,14 +208,63 @@ Status Graph::SerializeToDot(std::ostream& stream)
     return Status::Success;
 }
 
-Status Graph::AllocateDynamicBuffers()
+const InputSlot* Graph::FindInPlaceInputSlot(const Layer& layer, const InPlaceSlots& inPlaceSlots)
+{
+    if (layer.GetNumOutputSlots() != 1)
+    {
+        return nullptr;
+    }
+    const OutputSlot& outputSlot = layer.GetOutputSlot(0);
+    const ITensorHandle* outputHandle = outputSlot.GetOutputHandler().GetData();
+
+    for (const auto& inPlaceSlot : inPlaceSlots)
+    {
+        if (inPlaceSlot.first != 0 || inPlaceSlot.second >= layer.GetNumInputSlots())
+        {
+            continue;
+        }
+        const InputSlot& inputSlot = layer.GetInputSlot(inPlaceSlot.second);
+        const OutputSlot* connectedSlot = inputSlot.GetConnectedOutputSlot();
+        if (!connectedSlot || connectedSlot->GetNumConnections() != 1)
+        {
+            continue;
+        }
+        const Layer& connectedLayer = connectedSlot->GetOwningLayer();
+        if (connectedLayer.GetType() == LayerType::Constant || connectedLayer.GetBackendId() != layer.GetBackendId())
+        {
+            continue;
+        }
+
+        const TensorInfo& inputInfo = connectedSlot->GetTensorInfo();
+        const TensorInfo& outputInfo = outputSlot.GetTensorInfo();
+        // Reshapes only change the shape, and broadcast inputs of elementwise layers have fewer elements
+        if (inputInfo.GetNumElements() != outputInfo.GetNumElements() ||
+            inputInfo.GetDataType() != outputInfo.GetDataType())
+        {
+            continue;
+        }
+
+        // Elements of sub-tensors are not at the same positions as the elements of the tensors they would share with
+        const ITensorHandle* inputHandle = connectedSlot->GetOutputHandler().GetData();
+        if (!inputHandle || !outputHandle || inputHandle == outputHandle ||
+            inputHandle->GetParent() || outputHandle->GetParent())
+        {
+            continue;
+        }
+        return &inputSlot;
+    }
+    return nullptr;
+}
+
+Status Graph::AllocateDynamicBuffers(const std::unordered_map<const Layer*, InPlaceSlots>& inPlaceSlots,
+                                     const std::unordered_set<const ITensorHandle*>& importedConstants)
 {
     // Layers must be sorted in topological order
     ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(m_LayersInOrder, "layers must be in order.");
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_AllocateDynamicBuffers");
 
-    std::unordered_set<const ITensorHandle*> preallocatedTensors;
+    std::unordered_set<const ITensorHandle*> preallocatedTensors = importedConstants;
     std::unordered_map<const ITensorHandle*, unsigned int> handleReferenceCounts;
 
     // Finds the first TensorHandle ancestor of a SubTensorHandle. If the ITensorHandle provided
@@ -251,9 +304,42 @@ Status Graph::AllocateDynamicBuffers()
         }
     }
 
+    // Decrements the reference counter of the tensor handle connected to an input slot. Once it reaches zero, the
+    // lifetime of the tensor handle ends
+    auto ReleaseInput = [&](const InputSlot& slot)
+    {
+        ITensorHandle *tensorHandle = TraceSubTensorHandleAncestry(
+            slot.GetConnectedOutputSlot()->GetOutputHandler().GetData());
+
+        if (tensorHandle && !IsPreallocated(tensorHandle))
+        {
+            --handleReferenceCounts[tensorHandle];
+
+            if (handleReferenceCounts[tensorHandle] == 0u)
+            {
+                // Stop managing lifetime of tensor handle
+                tensorHandle->Allocate();
+                handleReferenceCounts.erase(tensorHandle);
+            }
+        }
+    };
+
     // Iterate over the network in topological order
     for (auto&& layer : m_Layers)
     {
+        // A layer computing its output in place ends the lifetime of that input before the lifetime of its output
+        // starts, so that the memory managers hand the memory of the input to the output.
+        const InputSlot* inPlaceInput = nullptr;
+        auto inPlaceSlotsOfLayer = inPlaceSlots.find(layer);
+        if (inPlaceSlotsOfLayer != inPlaceSlots.end())
+        {
+            inPlaceInput = FindInPlaceInputSlot(*layer, inPlaceSlotsOfLayer->second);
+            if (inPlaceInput)
+            {
+                ReleaseInput(*inPlaceInput);
+            }
+        }
+
         // Count the amount of times each output slot references a certain buffer (ITensorHandle).
         // The first time we encounter a new tensor handle, we start managing its lifetime.
         for (auto&& slot = layer->BeginOutputSlots(); slot != layer->EndOutputSlots(); ++slot)
@@ -284,19 +370,9 @@ Status Graph::AllocateDynamicBuffers()
         // to each tensor handle we encounter. Once it reaches zero, we end the lifetime of the tensor handle
         for (auto&& slot = layer->BeginInputSlots(); slot != layer->EndInputSlots(); ++slot)
         {
-            ITensorHandle *tensorHandle = TraceSubTensorHandleAncestry(
-                slot->GetConnectedOutputSlot()->GetOutputHandler().GetData());
-
-            if (tensorHandle && !IsPreallocated(tensorHandle))
+            if (&(*slot) != inPlaceInput)
             {
-                --handleReferenceCounts[tensorHandle];
-
-                if (handleReferenceCounts[tensorHandle] == 0u)
-                {
-                    // Stop managing lifetime of tensor handle
-                    tensorHandle->Allocate();
-                    handleReferenceCounts.erase(tensorHandle);
-                }
+                ReleaseInput(*slot);
             }
         }
     }
@@ -308,18 +384,100 @@ const Graph& Graph::TopologicalSort() const
 {
     if (!m_LayersInOrder)
     {
-        // Resets layer order.
-        for (auto&& it : m_Layers)
+        // Assigns the priorities with Kahn's algorithm, visiting each layer once all its producers have been visited,
+        // rather than recursing through the producers of every layer, which could overflow the stack of very deep
+        // graphs. While a layer waits for its producers, its priority holds the highest priority among those visited.
+        constexpr LayerPriority inputPrio = std::numeric_limits<LayerPriority>::lowest();
+        constexpr LayerPriority outputPrio = std::numeric_limits<LayerPriority>::max();
+
+        std::unordered_map<const Layer*, unsigned int> numPendingInputs;
+        numPendingInputs.reserve(m_Layers.size());
+        std::vector<Layer*> ready;
+        for (auto&& layer : m_Layers)
+        {
+            layer->ResetPriority();
+            const auto numInputs = std::count_if(layer->GetInputSlots().begin(), layer->GetInputSlots().end(),
+                                                 [](const InputSlot& slot)
+                                                 {
+                                                     return slot.GetConnectedOutputSlot() != nullptr;
+                                                 });
+            if (numInputs == 0)
+            {
+                ready.push_back(layer);
+            }
+            else
+            {
+                numPendingInputs.emplace(layer, numeric_cast<unsigned int>(numInputs));
+            }
+        }
+
+        size_t numVisited = 0;
+        while (!ready.empty())
         {
-            it->ResetPriority();
+            Layer* layer = ready.back();
+            ready.pop_back();
+            ++numVisited;
+
+            LayerPriority producerPrio = 0;
+            if (layer->GetType() == LayerType::Input)
+            {
+                layer->m_Priority = inputPrio;
+            }
+            else if (layer->GetType() == LayerType::Output)
+            {
+                layer->m_Priority = outputPrio;
+            }
+            else
+            {
+                if (layer->m_Priority >= outputPrio)
+                {
+                    throw GraphValidationException("Graph has too many edges");
+                }
+                layer->m_Priority++;
+                producerPrio = layer->m_Priority;
+            }
+
+            for (auto&& outputSlot : layer->GetOutputSlots())
+            {
+                for (auto&& connection : outputSlot.GetConnections())
+                {
+                    Layer& consumer = connection->GetOwningLayer();
+                    consumer.m_Priority = std::max(consumer.m_Priority, producerPrio);
+
+                    auto pending = numPendingInputs.find(&consumer);
+                    if (pending != numPendingInputs.end() && --pending->second == 0)
+                    {
+                        ready.push_back(&consumer);
+                    }
+                }
+            }
         }
 
-        auto compareLayerPriority = [](const LayerList::value_type& layerA, const LayerList::value_type& layerB)
+        if (numVisited != m_Layers.size())
+        {
+            for (auto&& layer : m_Layers)
             {
-                return layerA->GetPriority() < layerB->GetPriority();
-            };
+                layer->ResetPriority();
+            }
+            throw GraphValidationException("Graph has circular dependencies: cannot walk");
+        }
 
-        m_Layers.sort(compareLayerPriority);
+        // Orders the layers by priority in a vector, keeping the current order among layers of equal priority, then
+        // moves the list nodes into that order.
+        std::vector<LayerList::iterator> order;
+        order.reserve(m_Layers.size());
+        for (auto it = m_Layers.begin(); it != m_Layers.end(); ++it)
+        {
+            order.push_back(it);
+        }
+        std::stable_sort(order.begin(), order.end(), [](LayerList::iterator layerA, LayerList::iterator layerB)
+            {
+                return (*layerA)->m_Priority < (*layerB)->m_Priority;
+            });
+        for (auto it : order)
+        {
+            m_Layers.splice(m_Layers.end(), m_Layers, it);
+        }
 
         m_LayersInOrder = true;
     }
@@ -327,6 +485,240 @@ const Graph& Graph::TopologicalSort() const
     return *this;
 }
 
+std::map<BackendId, size_t> Graph::GetPeakTensorMemory(
+    const std::unordered_map<const Layer*, InPlaceSlots>& inPlaceSlots) const
+{
+    std::map<BackendId, size_t> peakBytes;
+    std::map<BackendId, size_t> liveBytes;
+    std::unordered_map<const OutputSlot*, unsigned int> remainingConsumers;
+
+    // Ends the lifetime of a tensor once its last consumer has run
+    auto ReleaseOutput = [&](const OutputSlot& slot)
+    {
+        auto it = remainingConsumers.find(&slot);
+        if (it != remainingConsumers.end() && --it->second == 0)
+        {
+            liveBytes[slot.GetOwningLayer().GetBackendId()] -= slot.GetTensorInfo().GetNumBytes();
+            remainingConsumers.erase(it);
+        }
+    };
+
+    for (auto&& layer : TopologicalSort())
+    {
+        if (layer->GetType() == LayerType::Constant)
+        {
+            continue;
+        }
+        const BackendId& backendId = layer->GetBackendId();
+
+        const InputSlot* inPlaceInput = nullptr;
+        auto inPlaceSlotsOfLayer = inPlaceSlots.find(layer);
+        if (inPlaceSlotsOfLayer != inPlaceSlots.end())
+        {
+            inPlaceInput = FindInPlaceInputSlot(*layer, inPlaceSlotsOfLayer->second);
+            if (inPlaceInput)
+            {
+                ReleaseOutput(*inPlaceInput->GetConnectedOutputSlot());
+            }
+        }
+
+        // Sub-tensors are views of their parent
+        for (auto&& slot : layer->GetOutputSlots())
+        {
+            const ITensorHandle* tensorHandle = slot.GetOutputHandler().GetData();
+            if (slot.GetNumConnections() > 0 && !(tensorHandle && tensorHandle->GetParent()))
+            {
+                remainingConsumers[&slot] = slot.GetNumConnections();
+                liveBytes[backendId] += slot.GetTensorInfo().GetNumBytes();
+            }
+        }
+        peakBytes[backendId] = std::max(peakBytes[backendId], liveBytes[backendId]);
+
+        for (auto&& slot : layer->GetInputSlots())
+        {
+            if (&slot != inPlaceInput && slot.GetConnectedOutputSlot())
+            {
+                ReleaseOutput(*slot.GetConnectedOutputSlot());
+            }
+        }
+    }
+
+    return peakBytes;
+}
+
+Graph& Graph::MemoryAwareTopologicalSort()
+{
+    auto GetTotalPeak = [this]()
+    {
+        size_t totalPeak = 0;
+        for (auto&& backendPeak : GetPeakTensorMemory())
+        {
+            totalPeak += backendPeak.second;
+        }
+        return totalPeak;
+    };
+
+    const size_t currentPeak = GetTotalPeak();
+
+    std::unordered_map<const Layer*, size_t> positions;
+    std::unordered_map<const Layer*, unsigned int> numPendingInputs;
+    std::unordered_map<const OutputSlot*, unsigned int> remainingConsumers;
+    std::vector<LayerList::iterator> currentOrder;
+    std::vector<LayerList::iterator> newOrder;
+    std::vector<LayerList::iterator> ready;
+    std::vector<LayerList::iterator> outputs;
+
+    std::unordered_map<const Layer*, LayerList::iterator> iterators;
+    for (auto it = m_Layers.begin(); it != m_Layers.end(); ++it)
+    {
+        positions.emplace(*it, currentOrder.size());
+        iterators.emplace(*it, it);
+        currentOrder.push_back(it);
+    }
+
+    // Moves a layer into the new order and makes ready the consumers it was the last producer of. Output layers
+    // are kept for the end, like in TopologicalSort.
+    auto Schedule = [&](LayerList::iterator it)
+    {
+        const Layer* layer = *it;
+        newOrder.push_back(it);
+        for (auto&& slot : layer->GetInputSlots())
+        {
+            if (slot.GetConnectedOutputSlot())
+            {
+                --remainingConsumers[slot.GetConnectedOutputSlot()];
+            }
+        }
+        for (auto&& slot : layer->GetOutputSlots())
+        {
+            remainingConsumers[&slot] = slot.GetNumConnections();
+            for (auto&& connection : slot.GetConnections())
+            {
+                const Layer& consumer = connection->GetOwningLayer();
+                if (--numPendingInputs[&consumer] == 0)
+                {
+                    auto consumerIt = iterators[&consumer];
+                    (consumer.GetType() == LayerType::Output ? outputs : ready).push_back(consumerIt);
+                }
+            }
+        }
+    };
+
+    // How much the live tensors grow when a layer runs: its outputs start their lifetime and the inputs it is the
+    // last consumer of end theirs. Constant tensors live for the whole execution.
+    auto GetGrowth = [&](const Layer& layer)
+    {
+        int64_t growth = 0;
+        if (layer.GetType() != LayerType::Constant)
+        {
+            for (auto&& slot : layer.GetOutputSlots())
+            {
+                if (slot.GetNumConnections() > 0)
+                {
+                    growth += numeric_cast<int64_t>(slot.GetTensorInfo().GetNumBytes());
+                }
+            }
+        }
+        std::unordered_map<const OutputSlot*, unsigned int> connections;
+        for (auto&& slot : layer.GetInputSlots())
+        {
+            if (slot.GetConnectedOutputSlot())
+            {
+                ++connections[slot.GetConnectedOutputSlot()];
+            }
+        }
+        for (auto&& connection : connections)
+        {
+            if (connection.first->GetOwningLayer().GetType() != LayerType::Constant &&
+                remainingConsumers[connection.first] == connection.second)
+            {
+                growth -= numeric_cast<int64_t>(connection.first->GetTensorInfo().GetNumBytes());
+            }
+        }
+        return growth;
+    };
+
+    for (auto it : currentOrder)
+    {
+        const auto numInputs = std::count_if((*it)->GetInputSlots().begin(), (*it)->GetInputSlots().end(),
+                                             [](const InputSlot& slot)
+                                             {
+                                                 return slot.GetConnectedOutputSlot() != nullptr;
+                                             });
+        numPendingInputs[*it] = numeric_cast<unsigned int>(numInputs);
+        if (numInputs == 0 && (*it)->GetType() != LayerType::Input)
+        {
+            ((*it)->GetType() == LayerType::Output ? outputs : ready).push_back(it);
+        }
+    }
+    // The inputs are first in the topological order
+    for (auto it : currentOrder)
+    {
+        if ((*it)->GetType() == LayerType::Input)
+        {
+            Schedule(it);
+        }
+    }
+
+    while (!ready.empty())
+    {
+        // Ties go to the layer that comes first in the current order
+        auto next = std::min_element(ready.begin(), ready.end(),
+                                     [&](LayerList::iterator layerA, LayerList::iterator layerB)
+                                     {
+                                         const int64_t growthA = GetGrowth(**layerA);
+                                         const int64_t growthB = GetGrowth(**layerB);
+                                         return growthA < growthB ||
+                                                (growthA == growthB && positions[*layerA] < positions[*layerB]);
+                                     });
+        auto it = *next;
+        ready.erase(next);
+        Schedule(it);
+    }
+
+    std::sort(outputs.begin(), outputs.end(), [&](LayerList::iterator layerA, LayerList::iterator layerB)
+        {
+            return positions[*layerA] < positions[*layerB];
+        });
+    newOrder.insert(newOrder.end(), outputs.begin(), outputs.end());
+
+    ARMNN_THROW_MSG_IF_FALSE(newOrder.size() == m_Layers.size(), GraphValidationException,
+                             "Graph has circular dependencies: cannot walk");
+
+    for (auto it : newOrder)
+    {
+        m_Layers.splice(m_Layers.end(), m_Layers, it);
+    }
+    if (GetTotalPeak() >= currentPeak)
+    {
+        for (auto it : currentOrder)
+        {
+            m_Layers.splice(m_Layers.end(), m_Layers, it);
+        }
+        return *this;
+    }
+
+    // Keeps the priorities consistent with the new order
+    LayerPriority priority = 0;
+    for (auto&& layer : m_Layers)
+    {
+        if (layer->GetType() == LayerType::Input)
+        {
+            layer->m_Priority = std::numeric_limits<LayerPriority>::lowest();
+        }
+        else if (layer->GetType() == LayerType::Output)
+        {
+            layer->m_Priority = std::numeric_limits<LayerPriority>::max();
+        }
+        else
+        {
+            layer->m_Priority = ++priority;
+        }
+    }
+
+    return *this;
+}
+
 void Graph::AddCompatibilityLayers(std::map<BackendId, std::unique_ptr<IBackendInternal>>& backends,
                                    TensorHandleFactoryRegistry& registry)
 {
@@ -488,11 +880,9 @@ void Graph::SubstituteSubgraph(SubgraphView& subgraph, const SubgraphView& subst
     // Look through each layer in the new subgraph and add any that are not already a member of this graph
     substituteSubgraph.ForEachIConnectableLayer([this](IConnectableLayer* iConnectableLayer)
     {
-        if (std::find(std::begin(m_Layers),
-                      std::end(m_Layers),
-                      iConnectableLayer) == std::end(m_Layers))
+        auto layer = PolymorphicDowncast<Layer*>(iConnectableLayer);
+        if (m_PosInGraphMap.find(layer) == m_PosInGraphMap.end())
         {
-            auto layer = PolymorphicDowncast<Layer*>(iConnectableLayer);
             layer->Reparent(*this, m_Layers.end());
             m_LayersInOrder = false;
         }
@@ -513,8 +903,7 @@ void Graph::ReplaceSubgraphConnections(const SubgraphView& subgraph, const Subgr
     const SubgraphView::IConnectableLayers& substituteSubgraphLayers = substituteSubgraph.GetIConnectableLayers();
     std::for_each(substituteSubgraphLayers.begin(), substituteSubgraphLayers.end(), [&](IConnectableLayer* layer)
     {
-        layer = PolymorphicDowncast<Layer*>(layer);
-        if (std::find(m_Layers.begin(), m_Layers.end(), layer) == m_Layers.end())
+        if (m_PosInGraphMap.find(PolymorphicDowncast<Layer*>(layer)) == m_PosInGraphMap.end())
         {
             throw armnn::Exception("Substitute layer is not a member of graph");
         }
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -20,6 +20,7 @@
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace armnn
@@ -204,8 +205,30 @@ public:
 
     size_t GetNumLayers() const { return m_Layers.size(); }
 
-    /// Allocates memory for all tensors under output tensor handers of each layer.
-    Status AllocateDynamicBuffers();
+    /// Pairs of (output slot, input slot) indices of a layer whose tensors may share the same memory.
+    using InPlaceSlots = std::vector<std::pair<unsigned int, unsigned int>>;
+
+    /// Allocates memory for all tensors under output tensor handers of each layer. The output of a layer reuses the
+    /// memory of an input paired with it in inPlaceSlots when FindInPlaceInputSlot allows it. The constant tensor
+    /// handles in importedConstants already have memory and are not allocated.
+    Status AllocateDynamicBuffers(const std::unordered_map<const Layer*, InPlaceSlots>& inPlaceSlots = {},
+                                  const std::unordered_set<const ITensorHandle*>& importedConstants = {});
+
+    /// Returns the input slot whose memory the output of layer can reuse, out of the pairs declared by its workload,
+    /// or nullptr. The layer must have a single output and be the only consumer of the input, and the two tensors must
+    /// have the same number of elements and data type, be on the same backend and not be sub-tensors.
+    static const InputSlot* FindInPlaceInputSlot(const Layer& layer, const InPlaceSlots& inPlaceSlots);
+
+    /// Returns, for each backend, the largest total size in bytes of the intermediate tensors alive at the same time
+    /// when the layers run in topological order. Constant tensors are not counted, and an output computed in place
+    /// shares the memory of its input like in AllocateDynamicBuffers.
+    std::map<BackendId, size_t> GetPeakTensorMemory(
+        const std::unordered_map<const Layer*, InPlaceSlots>& inPlaceSlots = {}) const;
+
+    /// Reorders the layers into a topological order that keeps fewer intermediate tensors alive at the same time,
+    /// running next, among the layers whose producers have run, the one that grows the live tensors the least.
+    /// The current order is kept when the new one does not lower the peak of GetPeakTensorMemory. Returns this.
+    Graph& MemoryAwareTopologicalSort();
 
     /// Modifies the graph in-place, removing edges connecting layers using different compute devices,
     /// and relinking them via an intermediary copy layers.
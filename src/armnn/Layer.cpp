@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include "Layer.hpp"
@@ -18,6 +18,7 @@
 #include <fmt/format.h>
 
 #include <numeric>
+#include <vector>
 
 namespace armnn
 {
@@ -362,19 +363,55 @@ LayerPriority Layer::GetPriority() const
     constexpr LayerPriority inputPrio = std::numeric_limits<LayerPriority>::lowest();
     constexpr LayerPriority outputPrio = std::numeric_limits<LayerPriority>::max();
 
-    if (GetType() == LayerType::Input)
-    {
-        m_Priority = inputPrio;
-    }
-    else if (GetType() == LayerType::Output)
+    auto isKnown = [](const Layer& layer)
+        {
+            if (layer.GetType() == LayerType::Input)
+            {
+                layer.m_Priority = inputPrio;
+                return true;
+            }
+            if (layer.GetType() == LayerType::Output)
+            {
+                layer.m_Priority = outputPrio;
+                return true;
+            }
+            return layer.m_Priority != 0;
+        };
+
+    if (isKnown(*this))
     {
-        m_Priority = outputPrio;
+        return m_Priority;
     }
-    else if (m_Priority == 0)
+
+    // Walks the producers whose priority is not known yet with an explicit stack rather than recursion, so that very
+    // deep graphs cannot overflow the call stack. A layer is marked as visiting while its producers are on the stack
+    // above it, and is given its priority once they are all known.
+    std::vector<const Layer*> stack { this };
+    while (!stack.empty())
     {
-        if (m_Visiting)
+        const Layer* layer = stack.back();
+        if (isKnown(*layer))
+        {
+            stack.pop_back();
+            continue;
+        }
+
+        if (!layer->m_Visiting)
         {
-            throw GraphValidationException("Graph has circular dependencies: cannot walk");
+            layer->m_Visiting = true;
+            for (auto&& slot : layer->GetInputSlots())
+            {
+                const OutputSlot* outputSlot = slot.GetConnectedOutputSlot();
+                if (outputSlot && !isKnown(outputSlot->GetOwningLayer()))
+                {
+                    if (outputSlot->GetOwningLayer().m_Visiting)
+                    {
+                        throw GraphValidationException("Graph has circular dependencies: cannot walk");
+                    }
+                    stack.push_back(&outputSlot->GetOwningLayer());
+                }
+            }
+            continue;
         }
 
         auto maxPrio = [](const LayerPriority prio, const InputSlot& slot) -> LayerPriority
@@ -382,8 +419,7 @@ LayerPriority Layer::GetPriority() const
                 const OutputSlot *outputSlot = slot.GetConnectedOutputSlot();
                 if (outputSlot)
                 {
-                    const Layer& input = outputSlot->GetOwningLayer();
-                    return std::max(prio, input.GetPriority());
+                    return std::max(prio, outputSlot->GetOwningLayer().m_Priority);
                 }
                 else
                 {
@@ -392,16 +428,17 @@ LayerPriority Layer::GetPriority() const
                 }
             };
 
-        m_Visiting = true;
-        LayerPriority parentPrio = std::accumulate(GetInputSlots().cbegin(), GetInputSlots().cend(), 0U, maxPrio);
-        m_Visiting = false;
+        layer->m_Visiting = false;
+        LayerPriority parentPrio = std::accumulate(layer->GetInputSlots().cbegin(), layer->GetInputSlots().cend(),
+                                                   0U, maxPrio);
 
         if (parentPrio >= outputPrio)
         {
             throw GraphValidationException("Graph has too many edges");
         }
 
-        m_Priority = parentPrio + 1U;
+        layer->m_Priority = parentPrio + 1U;
+        stack.pop_back();
     }
 
     return m_Priority;
@@ -0,0 +1,59 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayerSupportCache.hpp"
+
+namespace armnn
+{
+
+namespace
+{
+
+void HashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+} // anonymous namespace
+
+size_t LayerSupportCache::HashQuery(LayerType type, const std::vector<TensorInfo>& infos, const std::string& parameters)
+{
+    size_t seed = std::hash<int>()(static_cast<int>(type));
+    HashCombine(seed, std::hash<std::string>()(parameters));
+
+    for (const TensorInfo& info : infos)
+    {
+        HashCombine(seed, std::hash<int>()(static_cast<int>(info.GetDataType())));
+        const TensorShape& shape = info.GetShape();
+        HashCombine(seed, std::hash<int>()(static_cast<int>(shape.GetDimensionality())));
+        if (shape.GetDimensionality() == Dimensionality::Specified)
+        {
+            for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+            {
+                HashCombine(seed, shape.GetDimensionSpecificity(i) ? std::hash<unsigned int>()(shape[i]) : 0);
+            }
+        }
+        for (float scale : info.GetQuantizationScales())
+        {
+            HashCombine(seed, std::hash<float>()(scale));
+        }
+        HashCombine(seed, std::hash<int32_t>()(info.GetQuantizationOffset()));
+    }
+    return seed;
+}
+
+size_t LayerSupportCache::GetNumEntries() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Entries.size();
+}
+
+size_t LayerSupportCache::GetNumHits() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_NumHits;
+}
+
+} // namespace armnn
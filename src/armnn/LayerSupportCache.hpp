@@ -0,0 +1,152 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "SerializeLayerParameters.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Optional.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// Memoizes the answers of a backend to layer support queries, keyed on the layer type, the descriptor and the
+/// TensorInfos of the query, including their quantization. Repeated blocks of a model ask the same questions many times
+/// over. The cache is thread safe, so that all the copies of a LayerSupportHandle can share it.
+class LayerSupportCache
+{
+public:
+    using Query = std::function<bool(Optional<std::string&> reasonIfUnsupported)>;
+
+    /// Returns the cached answer for a layer of this type, descriptor and TensorInfos, appending the cached reason to
+    /// reasonIfUnsupported, or runs the query on the backend and caches its answer. Queries whose descriptor cannot be
+    /// compared are never cached.
+    template <typename DescriptorT>
+    bool IsLayerSupported(LayerType type,
+                          const std::vector<TensorInfo>& infos,
+                          const DescriptorT& descriptor,
+                          Optional<std::string&> reasonIfUnsupported,
+                          const Query& query);
+
+    /// Returns the number of different queries that have been answered by the backend.
+    size_t GetNumEntries() const;
+
+    /// Returns the number of queries that have been answered from the cache.
+    size_t GetNumHits() const;
+
+private:
+    template <typename T, typename = void>
+    struct IsEqualityComparable : std::false_type {};
+
+    template <typename T>
+    struct IsEqualityComparable<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+        : std::true_type {};
+
+    struct Entry
+    {
+        LayerType m_Type;
+        std::vector<TensorInfo> m_Infos;
+        std::type_index m_DescriptorType;
+        std::shared_ptr<const BaseDescriptor> m_Descriptor;
+        bool m_Supported;
+        std::string m_Reason;
+    };
+
+    static size_t HashQuery(LayerType type, const std::vector<TensorInfo>& infos, const std::string& parameters);
+
+    template <typename DescriptorT>
+    static bool AreDescriptorsEqual(const BaseDescriptor& cached, const DescriptorT& descriptor)
+    {
+        if constexpr (std::is_same<DescriptorT, BaseDescriptor>::value)
+        {
+            return true;
+        }
+        else
+        {
+            return static_cast<const DescriptorT&>(cached) == descriptor;
+        }
+    }
+
+    mutable std::mutex m_Mutex;
+    std::unordered_multimap<size_t, Entry> m_Entries;
+    size_t m_NumHits = 0;
+};
+
+template <typename DescriptorT>
+bool LayerSupportCache::IsLayerSupported(LayerType type,
+                                         const std::vector<TensorInfo>& infos,
+                                         const DescriptorT& descriptor,
+                                         Optional<std::string&> reasonIfUnsupported,
+                                         const Query& query)
+{
+    if constexpr (!std::is_same<DescriptorT, BaseDescriptor>::value && !IsEqualityComparable<DescriptorT>::value)
+    {
+        return query(reasonIfUnsupported);
+    }
+    else
+    {
+        std::string parameters;
+        ParameterStringifyFunction appendParameter = [&parameters](const std::string& name, const std::string& value)
+        {
+            parameters.append(name).append("=").append(value).append(";");
+        };
+        StringifyLayerParameters<DescriptorT>::Serialize(appendParameter, descriptor);
+        const size_t hash = HashQuery(type, infos, parameters);
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            auto range = m_Entries.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const Entry& entry = it->second;
+                if (entry.m_Type == type &&
+                    entry.m_DescriptorType == std::type_index(typeid(DescriptorT)) &&
+                    entry.m_Infos == infos &&
+                    AreDescriptorsEqual(*entry.m_Descriptor, descriptor))
+                {
+                    ++m_NumHits;
+                    if (reasonIfUnsupported.has_value())
+                    {
+                        reasonIfUnsupported.value() += entry.m_Reason;
+                    }
+                    return entry.m_Supported;
+                }
+            }
+        }
+
+        // The backend is queried without holding the lock. Concurrent misses on the same query both ask the backend,
+        // and both cache the same answer.
+        std::string reason;
+        const bool supported = query(Optional<std::string&>(reason));
+        if (reasonIfUnsupported.has_value())
+        {
+            reasonIfUnsupported.value() += reason;
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Entries.emplace(hash, Entry{ type,
+                                       infos,
+                                       std::type_index(typeid(DescriptorT)),
+                                       std::make_shared<DescriptorT>(descriptor),
+                                       supported,
+                                       std::move(reason) });
+        return supported;
+    }
+}
+
+} // namespace armnn
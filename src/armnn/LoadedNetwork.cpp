@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -13,6 +13,7 @@
 #include <armnn/BackendHelper.hpp>
 #include <armnn/BackendRegistry.hpp>
 #include <armnn/Logging.hpp>
+#include <armnn/utility/Timer.hpp>
 
 #include <armnn/backends/TensorHandle.hpp>
 #include <armnn/backends/IBackendInternal.hpp>
@@ -22,11 +23,16 @@
 #include <armnn/profiling/ArmNNProfiling.hpp>
 
 #include <backendsCommon/MemSyncWorkload.hpp>
+#include <backendsCommon/memoryOptimizerStrategyLibrary/MemoryOptimizerStrategyLibrary.hpp>
 
 #include <common/include/Processes.hpp>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
 namespace armnn
 {
 
@@ -84,6 +90,58 @@ void AddWorkloadStructure(std::unique_ptr<TimelineUtilityMethods>& timelineUtils
                                       LabelsAndEventClasses::CHILD_GUID);
 }
 
+size_t GetTotalBytes(const std::map<BackendId, size_t>& backendBytes)
+{
+    size_t totalBytes = 0;
+    for (auto&& bytes : backendBytes)
+    {
+        totalBytes += bytes.second;
+    }
+    return totalBytes;
+}
+
+size_t GetTotalMemBinSize(const std::vector<MemBin>& memBins)
+{
+    size_t totalSize = 0;
+    for (const MemBin& memBin : memBins)
+    {
+        totalSize += memBin.m_MemSize;
+    }
+    return totalSize;
+}
+
+size_t GetTotalMemBinSize(const std::unordered_map<BackendId, std::vector<MemBin>>& memBinMap)
+{
+    size_t totalSize = 0;
+    for (auto&& backendMemBins : memBinMap)
+    {
+        totalSize += GetTotalMemBinSize(backendMemBins.second);
+    }
+    return totalSize;
+}
+
+bool IsStateTensorInfoMatch(const TensorInfo& stateTensorInfo, const TensorInfo& tensorInfo)
+{
+    return stateTensorInfo.GetShape() == tensorInfo.GetShape() && stateTensorInfo.IsTypeSpaceMatch(tensorInfo);
+}
+
+bool ImportStateBuffer(ITensorHandle* tensorHandle, void* buffer)
+{
+    if (!tensorHandle)
+    {
+        return false;
+    }
+    try
+    {
+        return tensorHandle->CanBeImported(buffer, MemorySource::Malloc) &&
+               tensorHandle->Import(buffer, MemorySource::Malloc);
+    }
+    catch (const MemoryImportException&)
+    {
+        return false;
+    }
+}
+
 } // anonymous
 
 /**
@@ -170,7 +228,8 @@ void ValidateSourcesMatchOptimizedNetwork(std::vector<BackendOptions> optimizedO
 std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                                                                 std::string& errorMessage,
                                                                 const INetworkProperties& networkProperties,
-                                                                arm::pipe::IProfilingService* profilingService)
+                                                                arm::pipe::IProfilingService* profilingService,
+                                                                ConstantTensorCache* constantTensorCache)
 {
     std::unique_ptr<LoadedNetwork> loadedNetwork;
 
@@ -184,7 +243,8 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
     try
     {
-        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties, profilingService));
+        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties, profilingService,
+                                              constantTensorCache));
     }
     catch (const armnn::RuntimeException& error)
     {
@@ -204,7 +264,8 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
 LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                              const INetworkProperties& networkProperties,
-                             arm::pipe::IProfilingService* profilingService) :
+                             arm::pipe::IProfilingService* profilingService,
+                             ConstantTensorCache* constantTensorCache) :
                              m_OptimizedNetwork(std::move(net)),
                              m_NetworkProperties(networkProperties),
                              m_TensorHandleFactoryRegistry(),
@@ -236,6 +297,13 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
     order.SetLayersOutOfOrder();
     order.TopologicalSort();
 
+    const size_t workingMemoryBudget = m_NetworkProperties.m_WorkingMemoryBudget;
+    if (workingMemoryBudget != 0 && GetTotalBytes(order.GetPeakTensorMemory()) > workingMemoryBudget)
+    {
+        // The workloads are created in execution order, so it must be chosen before they are
+        order.MemoryAwareTopologicalSort();
+    }
+
     m_IsInputImported = std::vector<bool>(order.GetNumInputs(), false);
     m_IsOutputImported = std::vector<bool>(order.GetNumOutputs(), false);
 
@@ -264,15 +332,20 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
             IBackendInternal::IWorkloadFactoryPtr workloadFactory;
             if (backend->SupportsTensorAllocatorAPI())
             {
+                const auto& registryMemoryManagers = m_TensorHandleFactoryRegistry.GetMemoryManagers();
+                const auto numMemoryManagers = numeric_cast<std::ptrdiff_t>(registryMemoryManagers.size());
                 workloadFactory = backend->CreateWorkloadFactory(
                     m_TensorHandleFactoryRegistry,
                     m_OptimizedNetwork->pOptimizedNetworkImpl->GetModelOptions(),
                     static_cast<MemorySourceFlags>(m_NetworkProperties.m_InputSource),
                     static_cast<MemorySourceFlags>(m_NetworkProperties.m_OutputSource));
+                m_MemoryManagersByBackend[backendId].assign(registryMemoryManagers.begin() + numMemoryManagers,
+                                                            registryMemoryManagers.end());
             }
             else
             {
                 m_BackendMemoryMangers.emplace_back(backend->CreateMemoryManager());
+                m_MemoryManagersByBackend[backendId].push_back(m_BackendMemoryMangers.back());
                 workloadFactory = backend->CreateWorkloadFactory(
                         m_BackendMemoryMangers.back(), m_OptimizedNetwork->pOptimizedNetworkImpl->GetModelOptions());
             }
@@ -341,6 +414,12 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
         timelineUtils->MarkEntityWithLabel(networkGuid, ss.str(), LabelsAndEventClasses::PROCESS_ID_GUID);
     }
 
+    // The workloads of the constant layers keep a pointer to their data
+    if (constantTensorCache)
+    {
+        ShareConstantTensors(*constantTensorCache);
+    }
+
     std::vector<IWorkload*> ConstWorkloads;
 
     //Then create workloads.
@@ -384,6 +463,12 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                         AddWorkloadStructure(timelineUtils, workload, *layer);
                     }
 
+                    Graph::InPlaceSlots inPlaceSlots = workload->GetInPlaceSlots();
+                    if (!inPlaceSlots.empty())
+                    {
+                        m_InPlaceSlots.emplace(layer, std::move(inPlaceSlots));
+                    }
+
                     m_WorkloadQueue.emplace_back(std::move(workload));
 
                     if (layer->GetType() == LayerType::Constant)
@@ -530,6 +615,28 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                 m_MemBinMap[backendId] = m_ConstantStrategy->Optimize(backendMemoryProfile.second);
             }
         }
+        if (workingMemoryBudget != 0 && GetTotalMemBinSize(m_MemBinMap) > workingMemoryBudget)
+        {
+            // Fall back to the strategy of the library that packs the tensors of each backend the tightest
+            for (auto& backendMemoryProfile : m_MemBlockMap)
+            {
+                std::vector<MemBin>& memBins = m_MemBinMap[backendMemoryProfile.first];
+                for (const std::string& strategyName : GetMemoryOptimizerStrategyNames())
+                {
+                    // The validator only checks the solution of another strategy
+                    if (strategyName == "StrategyValidator")
+                    {
+                        continue;
+                    }
+                    std::vector<MemBlock> memBlocks = backendMemoryProfile.second;
+                    std::vector<MemBin> candidateBins = GetMemoryOptimizerStrategy(strategyName)->Optimize(memBlocks);
+                    if (GetTotalMemBinSize(candidateBins) < GetTotalMemBinSize(memBins))
+                    {
+                        memBins = std::move(candidateBins);
+                    }
+                }
+            }
+        }
         m_ExternalMemoryManager = CreateExternalMemoryManger(m_TensorMemory);
 
         // Sort m_TensorMemory, so it's order matches m_Tensorhandles
@@ -548,7 +655,27 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
     if (useInternalMemoryManager)
     {
         // Set up memory.
-        m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph().AllocateDynamicBuffers();
+        order.AllocateDynamicBuffers(m_InPlaceSlots, m_ImportedConstantTensorHandles);
+    }
+
+    if (workingMemoryBudget != 0)
+    {
+        size_t workingMemory = 0;
+        size_t minimumWorkingMemory = 0;
+        for (auto&& backendStatistics : GetMemoryStatistics())
+        {
+            // Backends that do not report their working memory need at least the minimum
+            const MemoryStatistics& statistics = backendStatistics.second;
+            workingMemory += std::max(statistics.m_WorkingMemoryBytes, statistics.m_MinimumWorkingMemoryBytes);
+            minimumWorkingMemory += statistics.m_MinimumWorkingMemoryBytes;
+        }
+        if (workingMemory > workingMemoryBudget)
+        {
+            throw MemoryValidationException(
+                fmt::format("The network needs {0} bytes of working memory, which exceeds the budget of {1} bytes. "
+                            "The intermediate tensors alive at the same time take {2} bytes in the best execution "
+                            "order found.", workingMemory, workingMemoryBudget, minimumWorkingMemory));
+        }
     }
 
     if (useExternalMemoryManager)
@@ -566,9 +693,157 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
     {
         workload->Execute();
     }
+
+    if (m_NetworkProperties.m_AllocateWorkingMemoryOnLoad)
+    {
+        AllocateAndPreFaultWorkingMemory();
+    }
+    if (m_NetworkProperties.m_NumWarmUpInferences != 0)
+    {
+        RunWarmUpInferences(m_NetworkProperties.m_NumWarmUpInferences);
+    }
     MARK_OPTIMIZED_NETWORK_LOADED()
 }
 
+void LoadedNetwork::AllocateAndPreFaultWorkingMemory()
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_AllocateWorkingMemory");
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+        AllocateWorkingMemory(lockGuard);
+#else
+        AllocateWorkingMemory();
+#endif
+    }
+
+    // Writing the data back rather than clearing it leaves the tensors that share the memory of a constant intact
+    constexpr size_t pageSize = 4096;
+    for (auto&& layer : m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph())
+    {
+        const LayerType layerType = layer->GetType();
+        if (layerType == LayerType::Constant || layerType == LayerType::Output)
+        {
+            continue;
+        }
+        // Inputs and outputs that import the memory of the user have none of their own
+        if (layerType == LayerType::Input && m_NetworkProperties.m_InputSource != MemorySource::Undefined)
+        {
+            continue;
+        }
+        if (m_NetworkProperties.m_OutputSource != MemorySource::Undefined &&
+            layer->GetOutputSlot(0).GetNumConnections() == 1 &&
+            layer->GetOutputSlot(0).GetConnection(0)->GetOwningLayer().GetType() == LayerType::Output)
+        {
+            continue;
+        }
+
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            ITensorHandle* tensorHandle = outputSlot.GetOutputHandler().GetData();
+            if (!tensorHandle || tensorHandle->GetParent())
+            {
+                continue;
+            }
+            auto memory = static_cast<volatile uint8_t*>(tensorHandle->Map(true));
+            const size_t numBytes = outputSlot.GetOutputHandler().GetTensorInfo().GetNumBytes();
+            for (size_t offset = 0; offset < numBytes; offset += pageSize)
+            {
+                memory[offset] = memory[offset];
+            }
+            tensorHandle->Unmap();
+        }
+    }
+}
+
+void LoadedNetwork::RunWarmUpInferences(unsigned int numInferences)
+{
+    const Graph& graph = m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph();
+
+    std::vector<std::vector<uint8_t>> buffers;
+    buffers.reserve(graph.GetNumInputs() + graph.GetNumOutputs());
+    InputTensors inputTensors;
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        TensorInfo tensorInfo = inputLayer->GetOutputSlot(0).GetTensorInfo();
+        tensorInfo.SetConstant();
+        buffers.emplace_back(tensorInfo.GetNumBytes());
+        inputTensors.emplace_back(inputLayer->GetBindingId(), ConstTensor(tensorInfo, buffers.back().data()));
+    }
+    OutputTensors outputTensors;
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        const TensorInfo& tensorInfo = outputLayer->GetInputSlot(0).GetTensorInfo();
+        buffers.emplace_back(tensorInfo.GetNumBytes());
+        outputTensors.emplace_back(outputLayer->GetBindingId(), Tensor(tensorInfo, buffers.back().data()));
+    }
+
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        const auto startTime = GetTimeNow();
+        Status status;
+        {
+            ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined,
+                                         i == 0 ? "LoadNetwork_ColdInference" : "LoadNetwork_WarmUpInference");
+            status = EnqueueWorkload(inputTensors, outputTensors);
+        }
+        if (status != Status::Success)
+        {
+            throw RuntimeException(fmt::format("Warm-up inference {} of {} failed", i + 1, numInferences));
+        }
+        ARMNN_LOG(info) << (i == 0 ? "Cold" : "Warm-up") << " inference " << i + 1 << " of " << numInferences
+                        << " time: " << std::setprecision(2) << std::fixed << GetTimeDuration(startTime).count()
+                        << " ms.";
+    }
+}
+
+void LoadedNetwork::ShareConstantTensors(ConstantTensorCache& constantTensorCache)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_ShareConstantTensors");
+    for (auto&& layer : m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph())
+    {
+        if (layer->GetType() != LayerType::Constant)
+        {
+            continue;
+        }
+        auto& constantLayer = *PolymorphicDowncast<ConstantLayer*>(layer);
+        if (!constantLayer.m_LayerOutput)
+        {
+            continue;
+        }
+        constantLayer.m_LayerOutput = constantTensorCache.Share(constantLayer.m_LayerOutput);
+
+        // The constants of backends managing their memory externally are allocated with the other tensors
+        ITensorHandle* tensorHandle = layer->GetOutputSlot(0).GetOutputHandler().GetData();
+        const TensorInfo& constantInfo = constantLayer.m_LayerOutput->GetTensorInfo();
+        const TensorInfo& outputInfo = layer->GetOutputSlot(0).GetTensorInfo();
+        if (m_SupportsExternallyManagedMemory[layer->GetBackendId()] ||
+            !tensorHandle || tensorHandle->GetParent() ||
+            outputInfo.GetDataType() != constantInfo.GetDataType() ||
+            outputInfo.GetNumBytes() != constantInfo.GetNumBytes() ||
+            tensorHandle->GetStrides() != constantLayer.m_LayerOutput->GetStrides())
+        {
+            continue;
+        }
+
+        // Nothing writes to the output of a constant layer: the constant workload skips the copy when the output
+        // holds the data already, and layers do not compute their outputs in place of a constant.
+        void* constantData = const_cast<void*>(constantLayer.m_LayerOutput->Map(true));
+        try
+        {
+            if (tensorHandle->CanBeImported(constantData, MemorySource::Malloc) &&
+                tensorHandle->Import(constantData, MemorySource::Malloc))
+            {
+                m_ImportedConstantTensorHandles.insert(tensorHandle);
+            }
+        }
+        catch (const MemoryImportException&)
+        {
+            // The output keeps a copy of the constant in memory of its own
+        }
+    }
+}
+
 void LoadedNetwork::AllocateAndExecuteConstantWorkloads()
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "LoadNetwork_AllocateAndExecuteConstants");
@@ -623,6 +898,100 @@ ProfilingGuid LoadedNetwork::GetNetworkGuid()
     return m_OptimizedNetwork->GetGuid();
 }
 
+std::map<BackendId, MemoryStatistics> LoadedNetwork::GetMemoryStatistics() const
+{
+    std::map<BackendId, MemoryStatistics> statistics;
+    Graph& graph = m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph().TopologicalSort();
+
+    for (auto&& layer : graph)
+    {
+        MemoryStatistics& backendStatistics = statistics[layer->GetBackendId()];
+        if (layer->GetType() == LayerType::Constant)
+        {
+            for (auto&& slot = layer->BeginOutputSlots(); slot != layer->EndOutputSlots(); ++slot)
+            {
+                backendStatistics.m_ConstantBytes += slot->GetTensorInfo().GetNumBytes();
+            }
+        }
+    }
+    for (auto&& backendPeak : graph.GetPeakTensorMemory(m_InPlaceSlots))
+    {
+        statistics[backendPeak.first].m_MinimumWorkingMemoryBytes = backendPeak.second;
+    }
+
+    for (auto&& backendMemoryManagers : m_MemoryManagersByBackend)
+    {
+        for (auto&& memoryManager : backendMemoryManagers.second)
+        {
+            if (memoryManager)
+            {
+                statistics[backendMemoryManagers.first].m_WorkingMemoryBytes += memoryManager->GetManagedMemorySize();
+            }
+        }
+    }
+    for (auto&& backendBins : m_MemBinMap)
+    {
+        statistics[backendBins.first].m_WorkingMemoryBytes += GetTotalMemBinSize(backendBins.second);
+    }
+
+    for (const ImportedTensorHandlePin& pin : m_PreImportedInputHandles)
+    {
+        if (!pin.m_TensorHandle || !pin.m_IsImported)
+        {
+            continue;
+        }
+        for (const BindableLayer* inputLayer : graph.GetInputLayers())
+        {
+            if (inputLayer->GetBindingId() == pin.m_LayerBindingId)
+            {
+                statistics[inputLayer->GetBackendId()].m_ImportedBytes +=
+                    inputLayer->GetOutputSlot(0).GetTensorInfo().GetNumBytes();
+            }
+        }
+    }
+    for (const ImportedTensorHandlePin& pin : m_PreImportedOutputHandles)
+    {
+        if (!pin.m_TensorHandle || !pin.m_IsImported)
+        {
+            continue;
+        }
+        for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+        {
+            if (outputLayer->GetBindingId() == pin.m_LayerBindingId)
+            {
+                statistics[outputLayer->GetBackendId()].m_ImportedBytes +=
+                    outputLayer->GetInputSlot(0).GetTensorInfo().GetNumBytes();
+            }
+        }
+    }
+    return statistics;
+}
+
+Status LoadedNetwork::SerializeMemoryProfile(std::ostream& stream) const
+{
+    if (!m_ExternalMemoryManager)
+    {
+        ARMNN_LOG(error) << "SerializeMemoryProfile: The network was not loaded with external memory management";
+        return Status::Failure;
+    }
+
+    // Writes the backends in a stable order, so that traces of the same network can be compared
+    std::map<std::string, const std::vector<MemBlock>*> memBlocksByBackend;
+    for (auto&& backendMemBlocks : m_MemBlockMap)
+    {
+        memBlocksByBackend[backendMemBlocks.first.Get()] = &backendMemBlocks.second;
+    }
+    for (auto&& backendMemBlocks : memBlocksByBackend)
+    {
+        for (const MemBlock& memBlock : *backendMemBlocks.second)
+        {
+            stream << backendMemBlocks.first << " " << memBlock.m_StartOfLife << " " << memBlock.m_EndOfLife << " "
+                   << memBlock.m_MemSize << " " << memBlock.m_Index << "\n";
+        }
+    }
+    return stream ? Status::Success : Status::Failure;
+}
+
 TensorInfo LoadedNetwork::GetInputTensorInfo(LayerBindingId layerId) const
 {
     for (auto&& inputLayer : m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph().GetInputLayers())
@@ -664,6 +1033,154 @@ TensorInfo LoadedNetwork::GetOutputTensorInfo(LayerBindingId layerId) const
     throw InvalidArgumentException(fmt::format("No output layer is associated with id {}", layerId));
 }
 
+void LoadedNetwork::AddStateTensor(LayerBindingId inputId, LayerBindingId outputId)
+{
+    const TensorInfo inputTensorInfo = GetInputTensorInfo(inputId);
+    const TensorInfo outputTensorInfo = GetOutputTensorInfo(outputId);
+    if (!IsStateTensorInfoMatch(inputTensorInfo, outputTensorInfo))
+    {
+        throw InvalidArgumentException(fmt::format(
+            "AddStateTensor: The shape and type of input {} and output {} do not match", inputId, outputId));
+    }
+    for (auto&& stateTensor : m_StateTensors)
+    {
+        if (stateTensor.first == inputId || stateTensor.second.m_OutputId == outputId)
+        {
+            throw InvalidArgumentException(fmt::format(
+                "AddStateTensor: Input {} or output {} already holds a state tensor", inputId, outputId));
+        }
+    }
+
+    StateTensor stateTensor;
+    stateTensor.m_OutputId = outputId;
+    stateTensor.m_TensorInfo = inputTensorInfo;
+    for (auto&& buffer : stateTensor.m_Buffers)
+    {
+        buffer.resize(inputTensorInfo.GetNumBytes());
+    }
+    m_StateTensors.emplace(inputId, std::move(stateTensor));
+}
+
+void LoadedNetwork::ResetStateTensors()
+{
+    for (auto&& stateTensor : m_StateTensors)
+    {
+        std::vector<uint8_t>& buffer = stateTensor.second.m_Buffers[stateTensor.second.m_CurrentBuffer];
+        std::fill(buffer.begin(), buffer.end(), 0);
+    }
+}
+
+void LoadedNetwork::GetStateTensor(LayerBindingId inputId, const Tensor& tensor) const
+{
+    auto stateTensor = m_StateTensors.find(inputId);
+    if (stateTensor == m_StateTensors.end())
+    {
+        throw InvalidArgumentException(fmt::format("GetStateTensor: Input {} holds no state tensor", inputId));
+    }
+    if (!IsStateTensorInfoMatch(stateTensor->second.m_TensorInfo, tensor.GetInfo()))
+    {
+        throw InvalidArgumentException(fmt::format(
+            "GetStateTensor: The shape and type of the tensor do not match the state tensor of input {}", inputId));
+    }
+    const std::vector<uint8_t>& buffer = stateTensor->second.m_Buffers[stateTensor->second.m_CurrentBuffer];
+    std::memcpy(tensor.GetMemoryArea(), buffer.data(), buffer.size());
+}
+
+void LoadedNetwork::SetStateTensor(LayerBindingId inputId, const ConstTensor& tensor)
+{
+    auto stateTensor = m_StateTensors.find(inputId);
+    if (stateTensor == m_StateTensors.end())
+    {
+        throw InvalidArgumentException(fmt::format("SetStateTensor: Input {} holds no state tensor", inputId));
+    }
+    if (!IsStateTensorInfoMatch(stateTensor->second.m_TensorInfo, tensor.GetInfo()))
+    {
+        throw InvalidArgumentException(fmt::format(
+            "SetStateTensor: The shape and type of the tensor do not match the state tensor of input {}", inputId));
+    }
+    std::vector<uint8_t>& buffer = stateTensor->second.m_Buffers[stateTensor->second.m_CurrentBuffer];
+    std::memcpy(buffer.data(), tensor.GetMemoryArea(), buffer.size());
+}
+
+void LoadedNetwork::BindStateTensors(InputTensors& inputTensors,
+                                     OutputTensors& outputTensors,
+                                     std::vector<ImportedInputId>& preImportedInputIds,
+                                     std::vector<ImportedOutputId>& preImportedOutputIds)
+{
+    const Graph& graph = m_OptimizedNetwork->pOptimizedNetworkImpl->GetGraph();
+
+    for (auto&& entry : m_StateTensors)
+    {
+        const LayerBindingId inputId = entry.first;
+        StateTensor& stateTensor = entry.second;
+
+        auto isInputId = [inputId](const auto& inputTensor) { return inputTensor.first == inputId; };
+        auto isOutputId = [&stateTensor](const auto& outputTensor)
+        {
+            return outputTensor.first == stateTensor.m_OutputId;
+        };
+        if (std::any_of(inputTensors.begin(), inputTensors.end(), isInputId) ||
+            std::any_of(outputTensors.begin(), outputTensors.end(), isOutputId))
+        {
+            throw InvalidArgumentException(fmt::format(
+                "Input {} and output {} hold a state tensor and must not be given to EnqueueWorkload",
+                inputId, stateTensor.m_OutputId));
+        }
+
+        void* currentBuffer = stateTensor.m_Buffers[stateTensor.m_CurrentBuffer].data();
+        void* nextBuffer = stateTensor.m_Buffers[1 - stateTensor.m_CurrentBuffer].data();
+
+        // The input reads the current state
+        unsigned int inputIndex = 0;
+        for (const BindableLayer* inputLayer : graph.GetInputLayers())
+        {
+            if (inputLayer->GetBindingId() == inputId)
+            {
+                break;
+            }
+            ++inputIndex;
+        }
+        if (inputIndex < m_PreImportedInputHandles.size() &&
+            m_PreImportedInputHandles[inputIndex].m_LayerBindingId == inputId &&
+            ImportStateBuffer(m_PreImportedInputHandles[inputIndex].m_TensorHandle.get(), currentBuffer))
+        {
+            preImportedInputIds.push_back(inputIndex);
+        }
+        else
+        {
+            TensorInfo inputTensorInfo = stateTensor.m_TensorInfo;
+            inputTensorInfo.SetConstant();
+            inputTensors.emplace_back(inputId, ConstTensor(inputTensorInfo, currentBuffer));
+        }
+
+        // The output writes the next state. An output whose tensor is also read by other layers is copied, as
+        // importing it would only replace the tensor handle of the output.
+        unsigned int outputIndex = 0;
+        const BindableLayer* outputLayer = nullptr;
+        for (const BindableLayer* layer : graph.GetOutputLayers())
+        {
+            if (layer->GetBindingId() == stateTensor.m_OutputId)
+            {
+                outputLayer = layer;
+                break;
+            }
+            ++outputIndex;
+        }
+        if (outputLayer &&
+            outputLayer->GetInputSlot(0).GetConnectedOutputSlot()->GetNumConnections() == 1 &&
+            outputIndex < m_PreImportedOutputHandles.size() &&
+            m_PreImportedOutputHandles[outputIndex].m_LayerBindingId == stateTensor.m_OutputId &&
+            ImportStateBuffer(m_PreImportedOutputHandles[outputIndex].m_TensorHandle.get(), nextBuffer))
+        {
+            preImportedOutputIds.push_back(outputIndex);
+        }
+        else
+        {
+            outputTensors.emplace_back(stateTensor.m_OutputId, Tensor(stateTensor.m_TensorInfo, nextBuffer));
+        }
+    }
+}
+
 const IWorkloadFactory& LoadedNetwork::GetWorkloadFactory(const Layer& layer) const
 {
     const IWorkloadFactory* workloadFactory = nullptr;
@@ -794,12 +1311,24 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         return Status::Failure;
     }
 
+    // The state tensors are given to the network along with the tensors of the user.
+    InputTensors inputAndStateTensors;
+    OutputTensors outputAndStateTensors;
+    if (!m_StateTensors.empty())
+    {
+        inputAndStateTensors = inputTensors;
+        outputAndStateTensors = outputTensors;
+        BindStateTensors(inputAndStateTensors, outputAndStateTensors, preImportedInputIds, preImportedOutputIds);
+    }
+    const InputTensors& networkInputTensors = m_StateTensors.empty() ? inputTensors : inputAndStateTensors;
+    const OutputTensors& networkOutputTensors = m_StateTensors.empty() ? outputTensors : outputAndStateTensors;
+
     // Data that must be kept alive for the entire execution of the workload.
-    WorkloadData workloadData(inputTensors, outputTensors);
+    WorkloadData workloadData(networkInputTensors, networkOutputTensors);
 
     // Input tensors can be provided as parameters or pre imported. Either way the number of
     // tensors should match the number of inputs.
-    if (graph.GetNumInputs() != (inputTensors.size() + preImportedInputIds.size()))
+    if (graph.GetNumInputs() != (networkInputTensors.size() + preImportedInputIds.size()))
     {
         throw InvalidArgumentException("Number of inputs provided does not match network.");
     }
@@ -977,6 +1506,15 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         timelineUtils->Commit();
     }
 
+    if (executionSucceeded)
+    {
+        // The state written by this execution is read by the next one
+        for (auto&& stateTensor : m_StateTensors)
+        {
+            stateTensor.second.m_CurrentBuffer = 1 - stateTensor.second.m_CurrentBuffer;
+        }
+    }
+
     return executionSucceeded ? Status::Success : Status::Failure;
 }
 
@@ -1181,6 +1719,11 @@ void LoadedNetwork::AllocateWorkingMemory(
         {
             m_Tensorhandles[i]->Import(m_TensorMemory[i].first->m_Data, m_TensorMemory[i].second);
         }
+        for (auto& inPlaceTensorHandle : m_InPlaceTensorHandles)
+        {
+            const auto& tensorMemory = m_TensorMemory[inPlaceTensorHandle.second];
+            inPlaceTensorHandle.first->Import(tensorMemory.first->m_Data, tensorMemory.second);
+        }
     }
 
     for (auto&& memoryManager : m_BackendMemoryMangers)
@@ -1449,6 +1992,7 @@ std::vector<ImportedInputId> LoadedNetwork::ImportInputs(const InputTensors& inp
                 && (outputTensorHandle->Import(passThroughTensorHandle->Map(), forceImportMemorySource)))
             {
                 importedInputs.push_back(inputIndex);
+                m_PreImportedInputHandles[inputIndex].m_IsImported = true;
             }
             passThroughTensorHandle->Unmap();
         }
@@ -1510,6 +2054,7 @@ std::vector<ImportedOutputId> LoadedNetwork::ImportOutputs(const OutputTensors&
                 && inputTensorHandle->Import(outputTensor.second.GetMemoryArea(), forceImportMemorySource))
             {
                 importedOutputs.push_back(outputIndex);
+                m_PreImportedOutputHandles[outputIndex].m_IsImported = true;
             }
         }
         catch(const MemoryImportException& exception)
@@ -1633,6 +2178,15 @@ void LoadedNetwork::CreateMemoryProfile()
             continue;
         }
 
+        // A layer computing its output in place hands the memory block of that input over to its output, extending
+        // the lifetime of the block instead of starting a new one
+        const InputSlot* inPlaceInput = nullptr;
+        auto inPlaceSlots = m_InPlaceSlots.find(layer);
+        if (inPlaceSlots != m_InPlaceSlots.end())
+        {
+            inPlaceInput = Graph::FindInPlaceInputSlot(*layer, inPlaceSlots->second);
+        }
+
         BackendId backendId = layer->GetBackendId();
         for (auto& outputSlot : layer->GetOutputSlots())
         {
@@ -1644,7 +2198,40 @@ void LoadedNetwork::CreateMemoryProfile()
             ITensorHandle* tensorHandle = outputSlot.GetOutputHandler().GetData();
             tensorHandle = TraceSubTensorHandleAncestry(tensorHandle);
 
-            if (memBlockTrackerMap.find(tensorHandle) == memBlockTrackerMap.end())
+            auto inPlaceBlock = memBlockTrackerMap.end();
+            if (inPlaceInput)
+            {
+                ITensorHandle* inputHandle = inPlaceInput->GetConnectedOutputSlot()->GetOutputHandler().GetData();
+                inPlaceBlock = memBlockTrackerMap.find(inputHandle);
+                if (inPlaceBlock == memBlockTrackerMap.end() || inPlaceBlock->second.m_Lifetime != 1)
+                {
+                    // The input is not managed here, or is not released by this layer
+                    inPlaceBlock = memBlockTrackerMap.end();
+                    inPlaceInput = nullptr;
+                }
+            }
+
+            if (inPlaceBlock != memBlockTrackerMap.end())
+            {
+                PartialBlock partialBlock = inPlaceBlock->second;
+                memBlockTrackerMap.erase(inPlaceBlock);
+                partialBlock.m_Lifetime = outputSlot.GetNumConnections();
+
+                if (partialBlock.m_Lifetime == 0)
+                {
+                    m_MemBlockMap[partialBlock.m_BackendId].emplace_back(partialBlock.m_StartOfLife,
+                                                                         timestep,
+                                                                         partialBlock.m_MemSize,
+                                                                         0,
+                                                                         partialBlock.m_Index);
+                }
+                else
+                {
+                    memBlockTrackerMap[tensorHandle] = partialBlock;
+                }
+                m_InPlaceTensorHandles.emplace_back(tensorHandle, partialBlock.m_Index);
+            }
+            else if (memBlockTrackerMap.find(tensorHandle) == memBlockTrackerMap.end())
             {
                 PartialBlock partialBlock;
 
@@ -1679,6 +2266,12 @@ void LoadedNetwork::CreateMemoryProfile()
 
         for (auto& inputSlot : layer->GetInputSlots())
         {
+            if (&inputSlot == inPlaceInput)
+            {
+                // The memory block of this input now belongs to the output
+                continue;
+            }
+
             const Layer& connectedInputLayer = inputSlot.GetConnectedOutputSlot()->GetOwningLayer();
             const LayerType& owningLayerType = connectedInputLayer.GetType();
 
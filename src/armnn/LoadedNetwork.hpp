@@ -1,13 +1,15 @@
 //
-// Copyright © 2017, 2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017, 2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
 
+#include "ConstantTensorCache.hpp"
 #include "Network.hpp"
 #include "LayerFwd.hpp"
 #include "Profiling.hpp"
 
+#include <armnn/IRuntime.hpp>
 #include <armnn/Tensor.hpp>
 
 #include <armnn/backends/IBackendInternal.hpp>
@@ -25,9 +27,12 @@
 
 #include <common/include/LabelsAndEventClasses.hpp>
 
+#include <array>
+#include <map>
 #include <mutex>
 #include <condition_variable>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace cl
 {
@@ -68,7 +73,8 @@ public:
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                                                             std::string& errorMessage,
                                                             const INetworkProperties& networkProperties,
-                                                            arm::pipe::IProfilingService* profilingService);
+                                                            arm::pipe::IProfilingService* profilingService,
+                                                            ConstantTensorCache* constantTensorCache = nullptr);
 
     // NOTE we return by reference as the purpose of this method is only to provide
     // access to the private m_Profiler and in theory we should not need to increment
@@ -83,6 +89,19 @@ public:
 
     arm::pipe::ProfilingGuid GetNetworkGuid();
 
+    /// Gets the memory used by the network on each of its backends.
+    std::map<BackendId, MemoryStatistics> GetMemoryStatistics() const;
+
+    /// Writes the memory blocks planned for the intermediate tensors. See IRuntime::SerializeMemoryProfile.
+    Status SerializeMemoryProfile(std::ostream& stream) const;
+
+    /// Makes the given input and output a state tensor that the network keeps between executions.
+    /// See IRuntime::AddStateTensor.
+    void AddStateTensor(LayerBindingId inputId, LayerBindingId outputId);
+    void ResetStateTensors();
+    void GetStateTensor(LayerBindingId inputId, const Tensor& tensor) const;
+    void SetStateTensor(LayerBindingId inputId, const ConstTensor& tensor);
+
 private:
 
 
@@ -93,6 +112,13 @@ private:
     );
     void AllocateAndExecuteConstantWorkloads();
 
+    /// Allocates the working memory and writes each of its pages back with its content, so that they are mapped
+    /// before the first inference.
+    void AllocateAndPreFaultWorkingMemory();
+
+    /// Runs inferences on inputs of zeros, timing each of them.
+    void RunWarmUpInferences(unsigned int numInferences);
+
     std::unordered_map<LayerGuid, std::unique_ptr<IWorkload>> m_ConstantWorkloads;
     std::unordered_map<LayerGuid, ITensorHandle*> m_ConstantTensorHandles;
 
@@ -100,7 +126,19 @@ private:
 
     LoadedNetwork(std::unique_ptr<IOptimizedNetwork> net,
                   const INetworkProperties& networkProperties,
-                  arm::pipe::IProfilingService* profilingService);
+                  arm::pipe::IProfilingService* profilingService,
+                  ConstantTensorCache* constantTensorCache);
+
+    /// Makes the constant layers use the same data as equal constants of the other loaded networks, and their outputs
+    /// import that data rather than hold a copy of it where the tensor handles allow it.
+    void ShareConstantTensors(ConstantTensorCache& constantTensorCache);
+
+    /// Adds the state tensors to the tensors of an execution. The state is imported by the tensor handles of its input
+    /// and output where they allow it, and copied otherwise.
+    void BindStateTensors(InputTensors& inputTensors,
+                          OutputTensors& outputTensors,
+                          std::vector<ImportedInputId>& preImportedInputIds,
+                          std::vector<ImportedOutputId>& preImportedOutputIds);
 
     void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
 
@@ -128,6 +166,10 @@ private:
     BackendPtrMap  m_Backends;
     std::vector<IBackendInternal::IMemoryManagerSharedPtr> m_BackendMemoryMangers;
 
+    // The memory managers of each backend, whether they are in m_BackendMemoryMangers or registered in
+    // m_TensorHandleFactoryRegistry, to report the memory they manage
+    std::unordered_map<BackendId, std::vector<IBackendInternal::IMemoryManagerSharedPtr>> m_MemoryManagersByBackend;
+
     using WorkloadFactoryMap = std::unordered_map<BackendId, IBackendInternal::IWorkloadFactoryPtr>;
     WorkloadFactoryMap  m_WorkloadFactories;
 
@@ -173,6 +215,8 @@ private:
 
         LayerBindingId m_LayerBindingId;
         std::unique_ptr<ITensorHandle> m_TensorHandle;
+        // Whether m_TensorHandle holds an imported user buffer
+        bool m_IsImported = false;
     };
 
     std::vector<ImportedTensorHandlePin> m_PreImportedInputHandles;
@@ -183,6 +227,16 @@ private:
 
     std::vector<ITensorHandle*> m_Tensorhandles;
 
+    // Tensor handles that share the memory of the tensor handle at the given index of m_Tensorhandles, because their
+    // layer computes them in place
+    std::vector<std::pair<ITensorHandle*, unsigned int>> m_InPlaceTensorHandles;
+
+    // The slots whose tensors the workload of each layer allows to share memory
+    std::unordered_map<const Layer*, Graph::InPlaceSlots> m_InPlaceSlots;
+
+    // Outputs of constant layers that imported the shared data of their constant, and need no memory of their own
+    std::unordered_set<const ITensorHandle*> m_ImportedConstantTensorHandles;
+
     std::vector<std::pair<std::shared_ptr<TensorMemory>, MemorySource>> m_TensorMemory;
 
     std::unique_ptr<MemoryManager> m_ExternalMemoryManager;
@@ -207,6 +261,18 @@ private:
     std::vector<bool> m_IsInputImported;
     std::vector<bool> m_IsOutputImported;
 
+    // A tensor that the network keeps between executions. Each execution reads the current buffer through the input
+    // and writes the other one through the output, then the buffers swap.
+    struct StateTensor
+    {
+        LayerBindingId m_OutputId;
+        TensorInfo m_TensorInfo;
+        std::array<std::vector<uint8_t>, 2> m_Buffers;
+        unsigned int m_CurrentBuffer = 0;
+    };
+    // The state tensors by the binding id of their input
+    std::map<LayerBindingId, StateTensor> m_StateTensors;
+
 };
 
 }
@@ -783,6 +783,18 @@ void ReportWarning(const std::string& warningMessage,
     }
 }
 
+void ReportInfo(const std::string& infoMessage,
+                Optional<std::vector<std::string>&> infoMessages)
+{
+    std::stringstream fullInfoMessage;
+    fullInfoMessage << "INFO: " << infoMessage;
+    ARMNN_LOG(info) << fullInfoMessage.str();
+    if (infoMessages)
+    {
+        infoMessages.value().push_back(fullInfoMessage.str());
+    }
+}
+
 // Given an OptimizationResult, build and add an error message to the errMessages vector. Then return the result.
 OptimizationResult ReturnWithError(OptimizationResult res,
                                    const Layer* layer,
@@ -867,7 +879,10 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
     // To run FP16 operations on CpuAcc we need at least v8.2 architecture. If the available architecture 
     // is older than v8.2, we can check if the operator is supported by changing operator inputs & outputs
     // to be FP32 and inserting convert layers around the FP32 operator.
-    bool isLayerSupported = IWorkloadFactory::IsLayerSupported(*layer, EmptyOptional(), currentReasonIfUnsupported);
+    bool isLayerSupported = IWorkloadFactory::IsLayerSupported(backendSettings.GetLayerSupportHandle(backend),
+                                                               *layer,
+                                                               EmptyOptional(),
+                                                               currentReasonIfUnsupported);
     reasonIfUnsupported += currentReasonIfUnsupported;
     if (!isLayerSupported && HasCapability("AllOrNothing", backend))
     {
@@ -896,7 +911,10 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
     {
         if (dataTypeIn == DataType::Float16 || dataTypeOut == DataType::Float16)
         {
-            if (IWorkloadFactory::IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported)
+            if (IWorkloadFactory::IsLayerSupported(backendSettings.GetLayerSupportHandle(backend),
+                                                   *layer,
+                                                   DataType::Float32,
+                                                   reasonIfUnsupported)
                 && layer->GetType() != LayerType::ConvertFp32ToFp16
                 && layer->GetType() != LayerType::ConvertFp16ToFp32)
             {
@@ -966,7 +984,8 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
 
                         // Try preferred backend first
                         layer->SetBackendId(preferredBackend);
-                        if (IWorkloadFactory::IsLayerSupported(*layer,
+                        if (IWorkloadFactory::IsLayerSupported(backendSettings.GetLayerSupportHandle(preferredBackend),
+                                                               *layer,
                                                                EmptyOptional(),
                                                                reasonIfUnsupported))
                         {
@@ -983,7 +1002,8 @@ OptimizationResult AttemptBackendAssignment(BackendSettings& backendSettings,
                                 }
 
                                 layer->SetBackendId(backend);
-                                if (IWorkloadFactory::IsLayerSupported(*layer,
+                                if (IWorkloadFactory::IsLayerSupported(backendSettings.GetLayerSupportHandle(backend),
+                                                                       *layer,
                                                                        EmptyOptional(),
                                                                        reasonIfUnsupported))
                                 {
@@ -2131,6 +2151,18 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
     // FusePermuteIntoConstantLayer must happen before FoldPadIntoDepthwiseConvolution2d and
     // FuseBatchNormIntoDepthwiseConvolution2D.
     Optimizer::Pass(optGraph, MakeOptimizations(FusePermuteIntoConstLayer()));
+    // Evaluate any remaining layers that only depend on constants, so the optimisations below see the results as
+    // ConstantLayers.
+    Optimizer::Pass(optGraph, MakeOptimizations(FoldConstantLayers()));
+    // Merge layers that compute the same values from the same inputs.
+    EliminateCommonSubexpressions(optGraph);
+    // Bypass layers that forward their input unchanged, such as zero Pads, full Slices or Muls by a constant 1.
+    unsigned int numIdentityLayers = 0;
+    Optimizer::Pass(optGraph, MakeOptimizations(EliminateIdentityLayers(&numIdentityLayers)));
+    if (numIdentityLayers > 0)
+    {
+        ReportInfo("Eliminated " + std::to_string(numIdentityLayers) + " identity layer(s)", messages);
+    }
     // Perform optimisation passes
     Optimizer::Pass(optGraph, MakeOptimizations(SquashEqualPermuteSiblings(),
                                                 SquashEqualTransposeSiblings(),
@@ -2148,7 +2180,20 @@ IOptimizedNetworkPtr Optimize(const Graph& inGraph,
                                                 FuseBatchNormIntoConvolution2DFloat32(),
                                                 FuseBatchNormIntoConvolution2DFloat16(),
                                                 FuseBatchNormIntoDepthwiseConvolution2DFloat32(),
-                                                FuseBatchNormIntoDepthwiseConvolution2DFloat16()));
+                                                FuseBatchNormIntoDepthwiseConvolution2DFloat16(),
+                                                FoldScaleShiftIntoConvolution2dFloat32(),
+                                                FoldScaleShiftIntoConvolution2dFloat16(),
+                                                FoldScaleShiftIntoDepthwiseConvolution2dFloat32(),
+                                                FoldScaleShiftIntoDepthwiseConvolution2dFloat16(),
+                                                FoldScaleShiftIntoFullyConnectedFloat32(),
+                                                FoldScaleShiftIntoFullyConnectedFloat16()));
+    // Move the Transposes that survived the local rewrites above through whole regions of layout agnostic layers,
+    // where that lowers the total transposed volume.
+    const unsigned int numLayoutRegions = PropagateDataLayouts(optGraph);
+    if (numLayoutRegions > 0)
+    {
+        ReportInfo("Propagated data layouts through " + std::to_string(numLayoutRegions) + " region(s)", messages);
+    }
 
     const std::vector<BackendId> mappedGpuBackends = BackendRegistryInstance().GetMappedGpuBackends();
 
@@ -1,14 +1,145 @@
 //
-// Copyright © 2017,2024 Arm Ltd. All rights reserved.
+// Copyright © 2017,2024,2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include "Optimizer.hpp"
 #include "Observable.hpp"
 #include "optimizations/All.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 namespace armnn
 {
 
+namespace
+{
+
+/// Schedules the layers of a graph for a single optimization pass. Every layer is visited once, sinks first, and the
+/// graph is only sorted when the pass starts rather than every time an optimization adds or erases a layer. Erased
+/// layers are dropped from the worklist. Layers added by an optimization are visited later in the pass, unless they
+/// read from a layer that has already been visited: like the layers around them, they are not revisited, as some
+/// optimizations, such as InsertDebugLayer, would apply again.
+class PassWorklist
+{
+public:
+    explicit PassWorklist(Graph& graph)
+    {
+        graph.TopologicalSort();
+        m_Stack.reserve(graph.GetNumLayers());
+        m_Scheduled.reserve(graph.GetNumLayers());
+        for (Layer* layer : graph)
+        {
+            m_Stack.push_back(layer);
+            m_Scheduled.emplace(layer, false);
+        }
+    }
+
+    /// Returns the next layer to visit, or nullptr once every scheduled layer has been visited.
+    Layer* Pop()
+    {
+        while (!m_Stack.empty())
+        {
+            Layer* layer = m_Stack.back();
+            m_Stack.pop_back();
+            // Layers erased while waiting in the worklist are no longer scheduled.
+            auto scheduled = m_Scheduled.find(layer);
+            if (scheduled != m_Scheduled.end() && !scheduled->second)
+            {
+                scheduled->second = true;
+                return layer;
+            }
+        }
+        return nullptr;
+    }
+
+    void OnLayerAdded(Layer* layer)
+    {
+        m_Added.push_back(layer);
+    }
+
+    void OnLayerErased(Layer* layer)
+    {
+        m_Scheduled.erase(layer);
+        m_Added.erase(std::remove(m_Added.begin(), m_Added.end(), layer), m_Added.end());
+    }
+
+    /// Schedules the layers added since the last call, once the optimization that added them has connected them.
+    void ScheduleAddedLayers()
+    {
+        for (Layer* layer : m_Added)
+        {
+            if (!ReadsFromVisitedLayer(*layer) && m_Scheduled.emplace(layer, false).second)
+            {
+                m_Stack.push_back(layer);
+            }
+        }
+        m_Added.clear();
+    }
+
+private:
+    bool ReadsFromVisitedLayer(const Layer& layer) const
+    {
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            const OutputSlot* connection = layer.GetInputSlot(i).GetConnectedOutputSlot();
+            if (connection)
+            {
+                auto scheduled = m_Scheduled.find(&connection->GetOwningLayer());
+                if (scheduled != m_Scheduled.end() && scheduled->second)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    std::vector<Layer*> m_Stack;
+    /// The layers of the worklist, mapped to whether they have been visited yet.
+    std::unordered_map<const Layer*, bool> m_Scheduled;
+    std::vector<Layer*> m_Added;
+};
+
+/// Forwards the graph events of one kind to the worklist of a pass as they happen, so that a layer erased and a new
+/// layer later created at the same address are told apart.
+class PassWorklistObserver : public IGraphObservable
+{
+public:
+    PassWorklistObserver(Graph& graph, GraphEvent event, PassWorklist& worklist)
+        : m_Graph(graph)
+        , m_Event(event)
+        , m_Worklist(worklist)
+    {
+        m_Graph.AttachObservable(this, m_Event);
+    }
+
+    ~PassWorklistObserver()
+    {
+        m_Graph.DetachObservable(this, m_Event);
+    }
+
+    void Update(Layer* graphLayer) override
+    {
+        if (m_Event == GraphEvent::LayerAdded)
+        {
+            m_Worklist.OnLayerAdded(graphLayer);
+        }
+        else
+        {
+            m_Worklist.OnLayerErased(graphLayer);
+        }
+    }
+
+private:
+    Graph& m_Graph;
+    GraphEvent m_Event;
+    PassWorklist& m_Worklist;
+};
+
+} // anonymous namespace
+
 Optimizer::Optimizer()
 {
 }
@@ -20,28 +151,20 @@ void Optimizer::Pass(Graph& graph, const Optimizations& optimizations)
     AddedLayerObservable addedLayerObservable(graph);
     ErasedLayerNamesObservable erasedLayerNamesObservable(graph);
 
-    bool graphNeedsSorting = false;
-    auto it = graph.TopologicalSort().end();
+    PassWorklist worklist(graph);
+    PassWorklistObserver addedLayerObserver(graph, GraphEvent::LayerAdded, worklist);
+    PassWorklistObserver erasedLayerObserver(graph, GraphEvent::LayerErased, worklist);
 
-    // Calls TopologicalSort() for every iteration to re-order the list in case layers were added/removed.
-    while (it != graph.TopologicalSort().begin())
+    while (Layer* layer = worklist.Pop())
     {
-        --it;
         for (auto&& optimization : optimizations)
         {
-            if (!*it)
-            {
-                throw armnn::NullPointerException("Layer must not be null.");
-            }
-
-            optimization->Run(graph, **it);
+            optimization->Run(graph, *layer);
 
-            if ((*it)->IsOutputUnconnected())
+            const bool erased = layer->IsOutputUnconnected();
+            if (erased)
             {
-                auto next = std::next(graph.GetPosInGraph(**it));
-                graph.EraseLayer(it);
-                it = next;
-                graphNeedsSorting = true;
+                graph.EraseLayer(layer);
             }
 
             // Add the names of erased layers as related layers to the new added layers
@@ -55,14 +178,16 @@ void Optimizer::Pass(Graph& graph, const Optimizations& optimizations)
 
             erasedLayerNamesObservable.Clear();
             addedLayerObservable.Clear();
+            worklist.ScheduleAddedLayers();
 
-            if (graphNeedsSorting)
+            if (erased)
             {
-                graphNeedsSorting = false;
                 break;
             }
         }
     }
+    // Leave the graph in topological order for the code that walks it after the pass.
+    graph.TopologicalSort();
 }
 
 } // namespace armnn
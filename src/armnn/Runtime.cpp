@@ -1,5 +1,5 @@
 //
-// Copyright © 2017, 2022-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017, 2022-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -30,7 +30,9 @@
 
 #include <common/include/LabelsAndEventClasses.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 
 using namespace armnn;
@@ -131,6 +133,36 @@ void IRuntime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFun
     return pRuntimeImpl->RegisterDebugCallback(networkId, func);
 }
 
+std::map<BackendId, MemoryStatistics> IRuntime::GetMemoryStatistics(NetworkId networkId) const
+{
+    return pRuntimeImpl->GetMemoryStatistics(networkId);
+}
+
+Status IRuntime::SerializeMemoryProfile(NetworkId networkId, std::ostream& stream) const
+{
+    return pRuntimeImpl->SerializeMemoryProfile(networkId, stream);
+}
+
+void IRuntime::AddStateTensor(NetworkId networkId, LayerBindingId inputId, LayerBindingId outputId)
+{
+    pRuntimeImpl->AddStateTensor(networkId, inputId, outputId);
+}
+
+void IRuntime::ResetStateTensors(NetworkId networkId)
+{
+    pRuntimeImpl->ResetStateTensors(networkId);
+}
+
+void IRuntime::GetStateTensor(NetworkId networkId, LayerBindingId inputId, const Tensor& tensor) const
+{
+    pRuntimeImpl->GetStateTensor(networkId, inputId, tensor);
+}
+
+void IRuntime::SetStateTensor(NetworkId networkId, LayerBindingId inputId, const ConstTensor& tensor)
+{
+    pRuntimeImpl->SetStateTensor(networkId, inputId, tensor);
+}
+
 int RuntimeImpl::GenerateNetworkId()
 {
     return m_NetworkIdCounter++;
@@ -172,7 +204,8 @@ Status RuntimeImpl::LoadNetwork(NetworkId& networkIdOut,
         std::unique_ptr<IOptimizedNetwork>(rawNetwork),
         errorMessage,
         networkProperties,
-        m_ProfilingService.get());
+        m_ProfilingService.get(),
+        &m_ConstantTensorCache);
 
     if (!loadedNetwork)
     {
@@ -197,6 +230,7 @@ Status RuntimeImpl::LoadNetwork(NetworkId& networkIdOut,
     {
         m_ProfilingService->IncrementCounterValue(arm::pipe::NETWORK_LOADS);
     }
+    UpdateMemoryCounters();
 
     return Status::Success;
 }
@@ -251,6 +285,7 @@ Status RuntimeImpl::UnloadNetwork(NetworkId networkId)
     {
         context.second->AfterUnloadNetwork(networkId);
     }
+    UpdateMemoryCounters();
 
     // Unregister the profiler
     ProfilerManager::GetInstance().RegisterProfiler(nullptr);
@@ -598,22 +633,28 @@ TensorInfo RuntimeImpl::GetOutputTensorInfo(NetworkId networkId, LayerBindingId
 std::vector<ImportedInputId> RuntimeImpl::ImportInputs(NetworkId networkId, const InputTensors& inputTensors,
                                                        MemorySource forceImportMemorySource)
 {
-    return GetLoadedNetworkPtr(networkId)->ImportInputs(inputTensors, forceImportMemorySource);
+    auto importedInputs = GetLoadedNetworkPtr(networkId)->ImportInputs(inputTensors, forceImportMemorySource);
+    UpdateMemoryCounters();
+    return importedInputs;
 }
 
 std::vector<ImportedOutputId> RuntimeImpl::ImportOutputs(NetworkId networkId, const OutputTensors& outputTensors,
                                                          MemorySource forceImportMemorySource)
 {
-    return GetLoadedNetworkPtr(networkId)->ImportOutputs(outputTensors, forceImportMemorySource);
+    auto importedOutputs = GetLoadedNetworkPtr(networkId)->ImportOutputs(outputTensors, forceImportMemorySource);
+    UpdateMemoryCounters();
+    return importedOutputs;
 }
 
 void RuntimeImpl::ClearImportedInputs(NetworkId networkId, const std::vector<ImportedInputId> inputIds)
 {
-    return GetLoadedNetworkPtr(networkId)->ClearImportedInputs(inputIds);
+    GetLoadedNetworkPtr(networkId)->ClearImportedInputs(inputIds);
+    UpdateMemoryCounters();
 }
 void RuntimeImpl::ClearImportedOutputs(NetworkId networkId, const std::vector<ImportedOutputId> outputIds)
 {
-    return GetLoadedNetworkPtr(networkId)->ClearImportedOutputs(outputIds);
+    GetLoadedNetworkPtr(networkId)->ClearImportedOutputs(outputIds);
+    UpdateMemoryCounters();
 }
 
 Status RuntimeImpl::EnqueueWorkload(NetworkId networkId,
@@ -668,6 +709,86 @@ void RuntimeImpl::RegisterDebugCallback(NetworkId networkId, const DebugCallback
     loadedNetwork->RegisterDebugCallback(func);
 }
 
+std::map<BackendId, MemoryStatistics> RuntimeImpl::GetMemoryStatistics(NetworkId networkId) const
+{
+#if !defined(ARMNN_DISABLE_THREADS)
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+#endif
+    auto iter = m_LoadedNetworks.find(networkId);
+    if (iter == m_LoadedNetworks.end())
+    {
+        return {};
+    }
+    return iter->second->GetMemoryStatistics();
+}
+
+Status RuntimeImpl::SerializeMemoryProfile(NetworkId networkId, std::ostream& stream) const
+{
+#if !defined(ARMNN_DISABLE_THREADS)
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+#endif
+    auto iter = m_LoadedNetworks.find(networkId);
+    if (iter == m_LoadedNetworks.end())
+    {
+        ARMNN_LOG(error) << "A Network with an id of " << networkId << " does not exist.";
+        return Status::Failure;
+    }
+    return iter->second->SerializeMemoryProfile(stream);
+}
+
+void RuntimeImpl::AddStateTensor(NetworkId networkId, LayerBindingId inputId, LayerBindingId outputId)
+{
+    GetLoadedNetworkPtr(networkId)->AddStateTensor(inputId, outputId);
+}
+
+void RuntimeImpl::ResetStateTensors(NetworkId networkId)
+{
+    GetLoadedNetworkPtr(networkId)->ResetStateTensors();
+}
+
+void RuntimeImpl::GetStateTensor(NetworkId networkId, LayerBindingId inputId, const Tensor& tensor) const
+{
+    GetLoadedNetworkPtr(networkId)->GetStateTensor(inputId, tensor);
+}
+
+void RuntimeImpl::SetStateTensor(NetworkId networkId, LayerBindingId inputId, const ConstTensor& tensor)
+{
+    GetLoadedNetworkPtr(networkId)->SetStateTensor(inputId, tensor);
+}
+
+void RuntimeImpl::UpdateMemoryCounters()
+{
+    if (!m_ProfilingService->IsProfilingEnabled())
+    {
+        return;
+    }
+
+    MemoryStatistics total;
+    {
+#if !defined(ARMNN_DISABLE_THREADS)
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+#endif
+        for (auto&& loadedNetwork : m_LoadedNetworks)
+        {
+            for (auto&& backendStatistics : loadedNetwork.second->GetMemoryStatistics())
+            {
+                total.m_ConstantBytes += backendStatistics.second.m_ConstantBytes;
+                total.m_WorkingMemoryBytes += backendStatistics.second.m_WorkingMemoryBytes;
+                total.m_ImportedBytes += backendStatistics.second.m_ImportedBytes;
+            }
+        }
+    }
+
+    // The counters count kilobytes, so that they do not overflow for networks of up to 4TB
+    auto toKilobytes = [](size_t bytes)
+    {
+        return static_cast<uint32_t>(std::min<size_t>((bytes + 1023) / 1024, std::numeric_limits<uint32_t>::max()));
+    };
+    m_ProfilingService->SetCounterValue(arm::pipe::CONSTANT_MEMORY, toKilobytes(total.m_ConstantBytes));
+    m_ProfilingService->SetCounterValue(arm::pipe::WORKING_MEMORY, toKilobytes(total.m_WorkingMemoryBytes));
+    m_ProfilingService->SetCounterValue(arm::pipe::IMPORTED_MEMORY, toKilobytes(total.m_ImportedBytes));
+}
+
 #if !defined(ARMNN_DISABLE_DYNAMIC_BACKENDS)
 void RuntimeImpl::LoadDynamicBackends(const std::string& overrideBackendPath)
 {
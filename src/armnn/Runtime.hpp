@@ -1,5 +1,5 @@
 //
-// Copyright © 2017, 2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017, 2023, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -89,6 +89,20 @@ public:
     /// @param func callback function to pass to the debug layer.
     void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func);
 
+    /// Gets the memory used by a loaded network on each of its backends.
+    /// @param networkId The id of the network for which to get the statistics.
+    /// @return The statistics of each backend used by the network, or an empty map if the network is not found.
+    std::map<BackendId, MemoryStatistics> GetMemoryStatistics(NetworkId networkId) const;
+
+    /// Writes the memory blocks planned for the intermediate tensors of a loaded network.
+    /// See IRuntime::SerializeMemoryProfile.
+    Status SerializeMemoryProfile(NetworkId networkId, std::ostream& stream) const;
+
+    void AddStateTensor(NetworkId networkId, LayerBindingId inputId, LayerBindingId outputId);
+    void ResetStateTensors(NetworkId networkId);
+    void GetStateTensor(NetworkId networkId, LayerBindingId inputId, const Tensor& tensor) const;
+    void SetStateTensor(NetworkId networkId, LayerBindingId inputId, const ConstTensor& tensor);
+
     /// Creates a runtime for workload execution.
     RuntimeImpl(const IRuntime::CreationOptions& options);
 
@@ -105,6 +119,8 @@ private:
 
     friend arm::pipe::IProfilingService& GetProfilingService(RuntimeImpl* runtime); // See RuntimeTests.cpp
 
+    friend const ConstantTensorCache& GetConstantTensorCache(RuntimeImpl* runtime); // See RuntimeTests.cpp
+
     int GenerateNetworkId();
 
     LoadedNetwork* GetLoadedNetworkPtr(NetworkId networkId) const;
@@ -122,6 +138,9 @@ private:
         }
     }
 
+    /// Sets the memory profiling counters to the memory used by all the loaded networks.
+    void UpdateMemoryCounters();
+
     /// Loads any available/compatible dynamic backend in the runtime.
     void LoadDynamicBackends(const std::string& overrideBackendPath);
 
@@ -132,6 +151,9 @@ private:
     /// Map of Loaded Networks with associated GUID as key
     LoadedNetworks m_LoadedNetworks;
 
+    /// Constant tensors shared by the loaded networks
+    ConstantTensorCache m_ConstantTensorCache;
+
     std::unordered_map<BackendId, IBackendInternal::IBackendContextPtr> m_BackendContexts;
 
     int m_NetworkIdCounter;
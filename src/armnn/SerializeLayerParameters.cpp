@@ -331,7 +331,10 @@ void StringifyLayerParameters<FusedDescriptor>::Serialize(ParameterStringifyFunc
     fn("NumInputSlots", std::to_string(desc.m_NumInputSlots));
     fn("NumOutputSlots", std::to_string(desc.m_NumOutputSlots));
     fn("PaddingMode", GetFusedTypeAsCString(desc.m_FusedKernelType));
-
+    if (desc.m_FusedKernelType == FusedKernelType::Elementwise)
+    {
+        fn("NumOperations", std::to_string(desc.m_ElementwiseProgram.size()));
+    }
 }
 
 void StringifyLayerParameters<Pooling2dDescriptor>::Serialize(ParameterStringifyFunction& fn,
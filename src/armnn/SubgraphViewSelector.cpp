@@ -1,5 +1,5 @@
 //
-// Copyright © 2017,2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017,2024,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -7,13 +7,14 @@
 #include "Graph.hpp"
 
 #include <armnn/utility/Assert.hpp>
-#include <armnn/utility/IgnoreUnused.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
 
 #include <algorithm>
-#include <map>
+#include <deque>
+#include <iterator>
 #include <queue>
-#include <unordered_set>
+#include <unordered_map>
+#include <vector>
 
 namespace armnn
 {
@@ -32,156 +33,264 @@ namespace
 /// to two PartialSubgraphs to check if two layers belong in the same subgraph. Instead you
 /// should use IsMergedWith().
 ///
-/// This structure also stores information about the dependencies of each subgraph, which is needed
-/// to determine whether certain subgraphs can be merged. Checking whether a subgraph
-/// depends on another subgraph is a frequent operation in the algorithm (see AssignSplitId) and so this is optimized
-/// in preference to the merging of subgraphs. This leads to an approach where each subgraph stores
-/// a set of all the subgraphs it depends on (for a fast lookup). In order to efficiently update this
-/// set as subgraphs are merged means we also store a set of subgraphs which *depend on us* (i.e. the
-/// complement of our dependencies).
+/// The representative of each subgraph also stores the direct dependencies between subgraphs, and a topological index
+/// which orders the subgraphs such that every subgraph comes after the subgraphs it depends on. These are maintained by
+/// PartialSubgraphs.
 class PartialSubgraph
 {
 public:
+    explicit PartialSubgraph(size_t topologicalIndex)
+    : m_Parent{nullptr}
+    , m_TopologicalIndex{topologicalIndex}
+    , m_VisitedMark{0}
+    {
+    }
+
     /// If this subgraph has been merged with another then there is an agreed "representative" for the combined
     /// subgraph, which uniquely identifies the subgraph.
     PartialSubgraph* GetRepresentative()
     {
-        // Recurse up the tree to find the root node.
-        if (m_Parent == nullptr)
+        PartialSubgraph* result = this;
+        while (result->m_Parent != nullptr)
         {
-            return this;
+            result = result->m_Parent;
         }
-        else
+
+        // Update the parent pointers on the way to point directly to the root in order to speed up future calls to
+        // this method. This essentially "flattens" the tree.
+        PartialSubgraph* node = this;
+        while (node != result)
         {
-            PartialSubgraph* result = m_Parent->GetRepresentative();
-            // Update our parent pointer to point directly to the root in order to speed up future calls to this method.
-            // This essentially "flattens" the tree.
-            m_Parent = result;
-            return result;
+            PartialSubgraph* parent = node->m_Parent;
+            node->m_Parent = result;
+            node = parent;
         }
+        return result;
+    }
+
+    /// Checks if this subgraph has been merged with the given subgraph.
+    bool IsMergedWith(PartialSubgraph* other)
+    {
+        return GetRepresentative() == other->GetRepresentative();
+    }
+
+private:
+    friend class PartialSubgraphs;
+
+    /// Pointer to the parent node in the tree. If this is null then we are the representative for our merged subgraph.
+    PartialSubgraph* m_Parent;
+    /// Position of this subgraph in a topological order of the subgraphs. Only valid for a representative.
+    size_t m_TopologicalIndex;
+    /// The subgraphs which we directly depend on. These may have been merged since, so the entries need to be
+    /// resolved to their representative, and there may be duplicates. Only valid for a representative.
+    std::vector<PartialSubgraph*> m_Antecedents;
+    /// The subgraphs which directly depend on us, with the same caveats as m_Antecedents.
+    std::vector<PartialSubgraph*> m_Dependants;
+    /// Used to mark the subgraphs that have been visited by a search.
+    unsigned int m_VisitedMark;
+};
+
+/// Owns the PartialSubgraphs of the algorithm and keeps the dependencies between them acyclic and topologically ordered.
+///
+/// Checking whether a subgraph depends on another subgraph is a frequent operation in the algorithm (see AssignSplitId).
+/// Storing the full set of direct and indirect dependencies of every subgraph makes this check cheap, but is quadratic
+/// in the number of subgraphs, which is large when the layers of a big graph alternate between backends. Instead only
+/// the direct dependencies are stored, and the check searches them, bounded by the topological indices: a subgraph can
+/// only depend on subgraphs that come before it in the order, so the search never needs to visit a subgraph that comes
+/// before the antecedent we are looking for. The order is maintained incrementally as dependencies are added and
+/// subgraphs are merged, by only reordering the subgraphs between the two ends of an out-of-order dependency
+/// (Pearce and Kelly, "A dynamic topological sort algorithm for directed acyclic graphs").
+class PartialSubgraphs
+{
+public:
+    PartialSubgraphs()
+    : m_VisitedMark{0}
+    {
+    }
+
+    /// Creates a new subgraph, ordered after all the existing ones.
+    PartialSubgraph* Create()
+    {
+        m_Subgraphs.emplace_back(m_Subgraphs.size());
+        return &m_Subgraphs.back();
     }
 
-    /// Merges this subgraph with another.
-    void MergeWith(PartialSubgraph* other)
+    /// Merges the two given subgraphs, neither of which may depend on the other.
+    void Merge(PartialSubgraph* first, PartialSubgraph* second)
     {
-        if (m_Parent == nullptr)
+        first = first->GetRepresentative();
+        second = second->GetRepresentative();
+        if (first == second)
         {
-            other = other->GetRepresentative();
-            if (this == other)
-            {
-                // Already merged - no-op
-                return;
-            }
-            m_Parent = other;
+            // Already merged - no-op
+            return;
+        }
 
-            // Update others' dependency sets to point to the new representative rather than us.
-            // Keeping these up-to-date means we can rely on these sets containing representatives when
-            // we perform a lookup in HasAntecedent() and so don't need to resolve the representative for each element
-            // of the set. See description at the top of this class for more rationale.
-            for (PartialSubgraph* a : m_Antecedents)
-            {
-                size_t numErased = a->m_Dependants.erase(this);
-                if (numErased != 1)
-                {
-                    throw armnn::Exception("number of dependents erased must only be 1.");
-                }
-                a->m_Dependants.insert(m_Parent);
-            }
-            for (PartialSubgraph* a : m_Dependants)
-            {
-                size_t numErased = a->m_Antecedents.erase(this);
-                if (numErased != 1)
-                {
-                    throw armnn::Exception("number of antecedents erased must only be 1.");
-                }
-                IgnoreUnused(numErased);
-                a->m_Antecedents.insert(m_Parent);
-            }
+        // Attach the subgraph with the fewest dependencies to the other one, so that every dependency is moved to a
+        // new representative only a logarithmic number of times.
+        if (first->m_Antecedents.size() + first->m_Dependants.size() <
+            second->m_Antecedents.size() + second->m_Dependants.size())
+        {
+            std::swap(first, second);
+        }
+        second->m_Parent = first;
+
+        // The merged subgraph inherits the dependencies of the attached subgraph, which may not respect the order of
+        // the representative.
+        std::vector<PartialSubgraph*> antecedents = std::move(second->m_Antecedents);
+        std::vector<PartialSubgraph*> dependants = std::move(second->m_Dependants);
+        second->m_Antecedents.clear();
+        second->m_Dependants.clear();
+        for (PartialSubgraph* antecedent : antecedents)
+        {
+            AddDirectAntecedent(first, antecedent);
+        }
+        for (PartialSubgraph* dependant : dependants)
+        {
+            AddDirectAntecedent(dependant, first);
+        }
+    }
 
-            // Merge our dependency sets into our new representative.
-            // We no longer need to maintain our own sets, as requests will always be forwarded to the representative.
-            m_Parent->m_Antecedents.insert(m_Antecedents.begin(), m_Antecedents.end());
-            m_Antecedents.clear();
-            m_Parent->m_Dependants.insert(m_Dependants.begin(), m_Dependants.end());
-            m_Dependants.clear();
+    /// Marks the given antecedent subgraph as a direct dependency of the given subgraph.
+    void AddDirectAntecedent(PartialSubgraph* subgraph, PartialSubgraph* antecedent)
+    {
+        subgraph = subgraph->GetRepresentative();
+        antecedent = antecedent->GetRepresentative();
+        if (subgraph == antecedent)
+        {
+            return;
         }
-        else
+
+        subgraph->m_Antecedents.push_back(antecedent);
+        antecedent->m_Dependants.push_back(subgraph);
+        if (antecedent->m_TopologicalIndex > subgraph->m_TopologicalIndex)
         {
-            // Defer request to the representative
-            GetRepresentative()->MergeWith(other);
+            Reorder(antecedent, subgraph);
         }
     }
 
-    /// Checks if this subgraph has been merged with the given subgraph.
-    bool IsMergedWith(PartialSubgraph* other)
+    /// Checks if the given subgraph depends on the given antecedent subgraph, either directly or indirectly.
+    bool HasAntecedent(PartialSubgraph* subgraph, PartialSubgraph* antecedent)
     {
-        return GetRepresentative() == other->GetRepresentative();
+        subgraph = subgraph->GetRepresentative();
+        antecedent = antecedent->GetRepresentative();
+        if (subgraph == antecedent || antecedent->m_TopologicalIndex > subgraph->m_TopologicalIndex)
+        {
+            return false;
+        }
+
+        bool found = false;
+        Search(subgraph, &PartialSubgraph::m_Antecedents, [&](PartialSubgraph* visited)
+        {
+            found = found || visited == antecedent;
+            return !found && visited->m_TopologicalIndex > antecedent->m_TopologicalIndex;
+        });
+        return found;
     }
 
-    /// Marks the given subgraph as a direct antecedent (dependency) of this one.
-    void AddDirectAntecedent(PartialSubgraph* antecedent)
+private:
+    /// Visits the subgraphs reachable from the given one by following the given direct dependencies. The visitor
+    /// returns whether the search should continue through the visited subgraph.
+    template<typename Visitor>
+    void Search(PartialSubgraph* start, std::vector<PartialSubgraph*> PartialSubgraph::* dependencies, Visitor visitor)
     {
-        if (m_Parent == nullptr)
+        ++m_VisitedMark;
+        start->m_VisitedMark = m_VisitedMark;
+        std::vector<PartialSubgraph*> stack{ start };
+        while (!stack.empty())
         {
-            antecedent = antecedent->GetRepresentative();
+            PartialSubgraph* current = stack.back();
+            stack.pop_back();
+            for (PartialSubgraph*& next : current->*dependencies)
+            {
+                // Resolve the entry in place, so that later searches don't need to.
+                next = next->GetRepresentative();
+                if (next->m_VisitedMark != m_VisitedMark)
+                {
+                    next->m_VisitedMark = m_VisitedMark;
+                    if (visitor(next))
+                    {
+                        stack.push_back(next);
+                    }
+                }
+            }
+        }
+    }
 
-            m_Antecedents.insert(antecedent);
-            // Also record all of its antecedents, so that we end up with direct and indirect antecedents.
-            // This makes the lookup in HasAntecedent() faster.
-            m_Antecedents.insert(antecedent->m_Antecedents.begin(), antecedent->m_Antecedents.end());
-            // All of our dependents also need to include the new antecedents
-            for (PartialSubgraph* d : m_Dependants)
+    /// Restores the topological order after the dependant subgraph has been made to depend on the antecedent subgraph,
+    /// which currently comes after it. Only the subgraphs in between that depend on the dependant, or that the
+    /// antecedent depends on, need to move.
+    void Reorder(PartialSubgraph* antecedent, PartialSubgraph* dependant)
+    {
+        const size_t lowerBound = dependant->m_TopologicalIndex;
+        const size_t upperBound = antecedent->m_TopologicalIndex;
+
+        std::vector<PartialSubgraph*> forward{ dependant };
+        Search(dependant, &PartialSubgraph::m_Dependants, [&](PartialSubgraph* visited)
+        {
+            if (visited == antecedent)
+            {
+                throw armnn::Exception("Merging the subgraphs would cause a dependency cycle.");
+            }
+            if (visited->m_TopologicalIndex < upperBound)
             {
-                d->m_Antecedents.insert(antecedent);
-                d->m_Antecedents.insert(antecedent->m_Antecedents.begin(), antecedent->m_Antecedents.end());
+                forward.push_back(visited);
+                return true;
             }
+            return false;
+        });
 
-            // Store reverse dependencies as well, required so that we can efficiently navigate the graph
-            // when making updates.
-            antecedent->m_Dependants.insert(this);
-            antecedent->m_Dependants.insert(m_Dependants.begin(), m_Dependants.end());
-            for (PartialSubgraph* a : antecedent->m_Antecedents)
+        std::vector<PartialSubgraph*> backward{ antecedent };
+        Search(antecedent, &PartialSubgraph::m_Antecedents, [&](PartialSubgraph* visited)
+        {
+            if (visited->m_TopologicalIndex > lowerBound)
             {
-                a->m_Dependants.insert(this);
-                a->m_Dependants.insert(m_Dependants.begin(), m_Dependants.end());
+                backward.push_back(visited);
+                return true;
             }
+            return false;
+        });
+
+        // Reuse the indices of the moved subgraphs, giving the lowest ones to the antecedent and its antecedents.
+        auto byIndex = [](const PartialSubgraph* a, const PartialSubgraph* b)
+        {
+            return a->m_TopologicalIndex < b->m_TopologicalIndex;
+        };
+        std::sort(forward.begin(), forward.end(), byIndex);
+        std::sort(backward.begin(), backward.end(), byIndex);
+
+        std::vector<size_t> indices;
+        indices.reserve(forward.size() + backward.size());
+        for (const PartialSubgraph* subgraph : backward)
+        {
+            indices.push_back(subgraph->m_TopologicalIndex);
         }
-        else
+        for (const PartialSubgraph* subgraph : forward)
         {
-            // Defer request to the representative
-            GetRepresentative()->AddDirectAntecedent(antecedent);
+            indices.push_back(subgraph->m_TopologicalIndex);
         }
-    }
+        std::sort(indices.begin(), indices.end());
 
-    /// Checks if this subgraph is dependent on the given subgraph, either directly or indirectly.
-    bool HasAntecedent(PartialSubgraph* antecedent)
-    {
-        if (m_Parent == nullptr)
+        auto index = indices.begin();
+        for (PartialSubgraph* subgraph : backward)
         {
-            antecedent = antecedent->GetRepresentative();
-            // Thanks to keeping this set updated in MergeWith and AddDirectAntecedent, we can do an efficient lookup.
-            return m_Antecedents.count(antecedent) > 0;
+            subgraph->m_TopologicalIndex = *index++;
         }
-        else
+        for (PartialSubgraph* subgraph : forward)
         {
-            // Defer request to the representative
-            return GetRepresentative()->HasAntecedent(antecedent);
+            subgraph->m_TopologicalIndex = *index++;
         }
     }
 
-private:
-    /// Pointer to the parent node in the tree. If this is null then we are the representative for our merged subgraph.
-    PartialSubgraph* m_Parent;
-    /// The representatives of all the subgraphs which we depend on, either directly or indirectly.
-    std::unordered_set<PartialSubgraph*> m_Antecedents;
-    /// The representatives of all the subgraphs which depend on us, either directly or indirectly.
-    std::unordered_set<PartialSubgraph*> m_Dependants;
+    /// A deque, so that the subgraphs don't move as more are created.
+    std::deque<PartialSubgraph> m_Subgraphs;
+    unsigned int m_VisitedMark;
 };
 
 /// Intermediate data structure to store information associated with a particular layer.
 struct LayerSelectionInfo
 {
-    using LayerInfoContainer = std::map<IConnectableLayer*, LayerSelectionInfo>;
+    using LayerInfoContainer = std::unordered_map<IConnectableLayer*, LayerSelectionInfo>;
     using LayerInfoQueue = std::queue<LayerSelectionInfo*>;
 
     LayerSelectionInfo(Layer* layer, const SubgraphViewSelector::LayerSelectorFunction& selector)
@@ -189,6 +298,7 @@ struct LayerSelectionInfo
     , m_Subgraph{nullptr}
     , m_IsSelected{selector(*layer)}
     , m_IsProcessed(false)
+    , m_NumPendingInputs(0)
     {
     }
 
@@ -216,14 +326,10 @@ struct LayerSelectionInfo
                 Layer& parentLayer = parentLayerOutputSlot->GetOwningLayer();
                 auto parentInfo = layerInfos.find(&parentLayer);
                 if (parentInfo == layerInfos.end() ||
-                        !m_Subgraph->IsMergedWith(parentInfo->second.m_Subgraph.get()))
+                        !m_Subgraph->IsMergedWith(parentInfo->second.m_Subgraph))
                 {
-                    // Avoid collecting duplicate input slots
-                    InputSlot* inputSlot = &(*slot);
-                    if (std::find(inputSlots.begin(), inputSlots.end(), inputSlot) == inputSlots.end())
-                    {
-                        inputSlots.push_back(inputSlot);
-                    }
+                    // Each input slot is only visited once, so there are no duplicates to avoid
+                    inputSlots.push_back(&(*slot));
                 }
             }
         }
@@ -241,14 +347,12 @@ struct LayerSelectionInfo
                 Layer& childLayer = childLayerInputSlot->GetOwningLayer();
                 auto childInfo = layerInfos.find(&childLayer);
                 if (childInfo == layerInfos.end() ||
-                        !m_Subgraph->IsMergedWith(childInfo->second.m_Subgraph.get()))
+                        !m_Subgraph->IsMergedWith(childInfo->second.m_Subgraph))
                 {
-                    // Avoid collecting duplicate output slots
-                    OutputSlot* outputSlot = &(*slot);
-                    if (std::find(outputSlots.begin(), outputSlots.end(), outputSlot) == outputSlots.end())
-                    {
-                        outputSlots.push_back(outputSlot);
-                    }
+                    // Avoid collecting duplicate output slots: each output slot is only visited once, so it is
+                    // enough to stop at its first connection leaving the subgraph
+                    outputSlots.push_back(&(*slot));
+                    break;
                 }
             }
         }
@@ -258,21 +362,15 @@ struct LayerSelectionInfo
     /// Which subgraph this layer has been assigned to. Only valid once m_IsProcessed is true.
     /// Two layers with different m_Subgraph pointers may in fact have been merged into the same subgraph -
     /// see the description of the PartialSubgraph class.
-    std::shared_ptr<PartialSubgraph> m_Subgraph;
+    PartialSubgraph* m_Subgraph;
     bool m_IsSelected;
     bool m_IsProcessed;
+    /// The number of inputs of this layer from layers that have not been processed yet.
+    unsigned int m_NumPendingInputs;
 };
 
 } // namespace <anonymous>
 
-SubgraphViewSelector::Subgraphs
-SubgraphViewSelector::SelectSubgraphs(Graph& graph, const LayerSelectorFunction& selector)
-{
-    SubgraphView subgraph(graph);
-    return SubgraphViewSelector::SelectSubgraphs(subgraph, selector);
-}
-
-
 template<typename Delegate>
 void ForEachLayerInput(LayerSelectionInfo::LayerInfoContainer& layerInfos,
                        LayerSelectionInfo& layerInfo,
@@ -280,9 +378,9 @@ void ForEachLayerInput(LayerSelectionInfo::LayerInfoContainer& layerInfos,
 {
     Layer& layer = *PolymorphicDowncast<Layer*>(layerInfo.m_Layer);
 
-    for (auto inputSlot : layer.GetInputSlots())
+    for (auto& inputSlot : layer.GetInputSlots())
     {
-        auto connectedInput = PolymorphicDowncast<OutputSlot*>(inputSlot.GetConnection());
+        const OutputSlot* connectedInput = inputSlot.GetConnectedOutputSlot();
         if (!connectedInput)
         {
             throw armnn::Exception("Dangling input slot detected.");
@@ -319,7 +417,9 @@ void ForEachLayerOutput(LayerSelectionInfo::LayerInfoContainer& layerInfos,
     }
 }
 
-void AssignSplitId(LayerSelectionInfo::LayerInfoContainer& layerInfos, LayerSelectionInfo& layerInfo)
+void AssignSplitId(LayerSelectionInfo::LayerInfoContainer& layerInfos,
+                   LayerSelectionInfo& layerInfo,
+                   PartialSubgraphs& subgraphs)
 {
     // Check each input to see if we can attach ourselves to any of the subgraphs that have already been assigned.
     ForEachLayerInput(layerInfos, layerInfo, [&](LayerSelectionInfo& parentInfo)
@@ -341,8 +441,8 @@ void AssignSplitId(LayerSelectionInfo::LayerInfoContainer& layerInfos, LayerSele
             ForEachLayerInput(layerInfos, layerInfo, [&](LayerSelectionInfo& otherParentInfo)
             {
                 // We call HasAntecedent() ~ n^2 times, where n is the number of inputs to this layer.
-                // Hence it is important that this is efficient - see PartialSubgraph class description.
-                if (otherParentInfo.m_Subgraph->HasAntecedent(parentInfo.m_Subgraph.get()))
+                // Hence it is important that this is efficient - see PartialSubgraphs class description.
+                if (subgraphs.HasAntecedent(otherParentInfo.m_Subgraph, parentInfo.m_Subgraph))
                 {
                     dependenciesOk = false;
                 }
@@ -358,9 +458,9 @@ void AssignSplitId(LayerSelectionInfo::LayerInfoContainer& layerInfos, LayerSele
                 }
                 else
                 {
-                    // We call MergeWith() ~ n times, where n is the number of inputs to this layer.
+                    // We call Merge() ~ n times, where n is the number of inputs to this layer.
                     // Therefore it does not need to be as performant as HasAntecedent().
-                    layerInfo.m_Subgraph->MergeWith(parentInfo.m_Subgraph.get());
+                    subgraphs.Merge(layerInfo.m_Subgraph, parentInfo.m_Subgraph);
                 }
             }
         }
@@ -369,7 +469,7 @@ void AssignSplitId(LayerSelectionInfo::LayerInfoContainer& layerInfos, LayerSele
     // If we weren't able to merge into an existing subgraph then we need to make a new one
     if (layerInfo.m_Subgraph == nullptr)
     {
-        layerInfo.m_Subgraph = std::make_shared<PartialSubgraph>();
+        layerInfo.m_Subgraph = subgraphs.Create();
     }
 
     // Record dependencies of the chosen subgraph based on the inputs of this layer.
@@ -377,48 +477,47 @@ void AssignSplitId(LayerSelectionInfo::LayerInfoContainer& layerInfos, LayerSele
     {
         // These functions are called ~n times, where n is the number of inputs to this layer.
         // Therefore it does not need to be as performant as HasAntecedent().
-        if (!layerInfo.m_Subgraph->IsMergedWith(parentInfo.m_Subgraph.get()))
+        if (!layerInfo.m_Subgraph->IsMergedWith(parentInfo.m_Subgraph))
         {
-            layerInfo.m_Subgraph->AddDirectAntecedent(parentInfo.m_Subgraph.get());
+            subgraphs.AddDirectAntecedent(layerInfo.m_Subgraph, parentInfo.m_Subgraph);
         }
     });
 }
 
-bool IsReadyForSplitAssignment(LayerSelectionInfo::LayerInfoContainer& layerInfos, LayerSelectionInfo& layerInfo)
+template<typename LayerRange>
+SubgraphViewSelector::Subgraphs SelectSubgraphsFromLayers(LayerRange& subgraphLayers,
+                                                          const SubgraphView::IInputSlots& subgraphInputSlots,
+                                                          const SubgraphViewSelector::LayerSelectorFunction& selector)
 {
-    bool ready = true;
-    ForEachLayerInput(layerInfos, layerInfo,
-                      [&ready](LayerSelectionInfo& parentInfo)
-                          {
-                              if (!parentInfo.m_IsProcessed)
-                              {
-                                  ready = false;
-                              }
-                          });
-    return ready;
-}
+    using Subgraphs = SubgraphViewSelector::Subgraphs;
 
-SubgraphViewSelector::Subgraphs
-SubgraphViewSelector::SelectSubgraphs(SubgraphView& subgraph, const LayerSelectorFunction& selector)
-{
     LayerSelectionInfo::LayerInfoContainer layerInfos;
+    PartialSubgraphs subgraphs;
 
     LayerSelectionInfo::LayerInfoQueue processQueue;
-    const SubgraphView::IConnectableLayers& subgraphLayers = subgraph.GetIConnectableLayers();
+    std::vector<LayerSelectionInfo*> constantInfos;
+    layerInfos.reserve(static_cast<size_t>(std::distance(subgraphLayers.begin(), subgraphLayers.end())));
     for (auto& layer : subgraphLayers)
     {
 
         auto emplaced = layerInfos.emplace(layer, LayerSelectionInfo{PolymorphicDowncast<Layer*>(layer), selector});
         LayerSelectionInfo& layerInfo = emplaced.first->second;
 
-        // Start with Input type layers
-        if (layerInfo.IsInputLayer())
+        // Start with Input type layers, followed by the Constant layers as in the priority order of a SubgraphView
+        if (layerInfo.m_Layer->GetType() == LayerType::Input)
         {
             processQueue.push(&layerInfo);
         }
+        else if (layerInfo.IsInputLayer())
+        {
+            constantInfos.push_back(&layerInfo);
+        }
+    }
+    for (LayerSelectionInfo* constantInfo : constantInfos)
+    {
+        processQueue.push(constantInfo);
     }
 
-    const SubgraphView::IInputSlots& subgraphInputSlots = subgraph.GetIInputSlots();
     for (auto& inputSlot : subgraphInputSlots)
     {
         Layer& layer = PolymorphicDowncast<InputSlot*>(inputSlot)->GetOwningLayer();
@@ -428,39 +527,46 @@ SubgraphViewSelector::SelectSubgraphs(SubgraphView& subgraph, const LayerSelecto
         processQueue.push(&layerInfo);
     }
 
+    // Count the inputs of each layer, so that it is only queued once all of them have been processed
+    for (auto& info : layerInfos)
+    {
+        ForEachLayerOutput(layerInfos, info.second, [](LayerSelectionInfo& childInfo)
+            {
+                ++childInfo.m_NumPendingInputs;
+            });
+    }
+
     while (!processQueue.empty())
     {
         LayerSelectionInfo& layerInfo = *processQueue.front();
         processQueue.pop(); // remove front from queue
 
-        // This layerInfo may have been added to the queue multiple times, so skip if we have already processed it
-        if (!layerInfo.m_IsProcessed)
+        // This layerInfo may have been added to the queue multiple times, so skip if we have already processed it.
+        // A starting layer which also has inputs is queued again once they have all been processed.
+        if (layerInfo.m_IsProcessed || layerInfo.m_NumPendingInputs != 0)
         {
-            // Only process this layerInfo if all inputs have been processed
-            if (!IsReadyForSplitAssignment(layerInfos, layerInfo))
-            {
-                // Put back of the process queue if we can't process it just yet
-                processQueue.push(&layerInfo);
-                continue; // Skip to next iteration
-            }
+            continue;
+        }
+
+        // Now we do the processing
+        AssignSplitId(layerInfos, layerInfo, subgraphs);
 
-            // Now we do the processing
-            AssignSplitId(layerInfos, layerInfo);
+        // We don't need to process this node again
+        layerInfo.m_IsProcessed = true;
 
-            // Queue any child nodes for processing
-            ForEachLayerOutput(layerInfos, layerInfo, [&processQueue](LayerSelectionInfo& childInfo)
+        // Queue any child nodes which are now ready for processing
+        ForEachLayerOutput(layerInfos, layerInfo, [&processQueue](LayerSelectionInfo& childInfo)
+            {
+                if (--childInfo.m_NumPendingInputs == 0)
                 {
                     processQueue.push(&childInfo);
-                });
-
-            // We don't need to process this node again
-            layerInfo.m_IsProcessed = true;
-        }
+                }
+            });
     }
 
     // Collect all selected layers keyed by subgraph representative into a map
     using SelectionInfoPtrs = std::vector<LayerSelectionInfo*>;
-    std::map<PartialSubgraph*, SelectionInfoPtrs> splitMap;
+    std::unordered_map<PartialSubgraph*, SelectionInfoPtrs> splitMap;
     for (auto& info : layerInfos)
     {
         if (info.second.m_IsSelected)
@@ -546,4 +652,18 @@ SubgraphViewSelector::SelectSubgraphs(SubgraphView& subgraph, const LayerSelecto
     return result;
 }
 
+SubgraphViewSelector::Subgraphs
+SubgraphViewSelector::SelectSubgraphs(Graph& graph, const LayerSelectorFunction& selector)
+{
+    // Select from the layers of the graph directly, rather than from a SubgraphView of the whole graph, which would
+    // need to be sorted and checked first.
+    return SelectSubgraphsFromLayers(graph, SubgraphView::IInputSlots{}, selector);
+}
+
+SubgraphViewSelector::Subgraphs
+SubgraphViewSelector::SelectSubgraphs(SubgraphView& subgraph, const LayerSelectorFunction& selector)
+{
+    return SelectSubgraphsFromLayers(subgraph.GetIConnectableLayers(), subgraph.GetIInputSlots(), selector);
+}
+
 } // namespace armnn
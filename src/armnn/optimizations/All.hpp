@@ -11,7 +11,11 @@
 #include "ConvertConstPermuteLayersToConstLayers.hpp"
 #include "ConvertFp32NetworkToFp16.hpp"
 #include "DeleteBroadcastTo.hpp"
+#include "EliminateCommonSubexpressions.hpp"
+#include "EliminateIdentityLayers.hpp"
+#include "FoldConstantLayers.hpp"
 #include "FoldPadIntoLayer2d.hpp"
+#include "FoldScaleShift.hpp"
 #include "FuseBatchNorm.hpp"
 #include "MaxMinIntoBoundedRelu.hpp"
 #include "MovePermuteUp.hpp"
@@ -22,6 +26,7 @@
 #include "PermuteAsReshape.hpp"
 #include "PermuteAndBatchToSpaceAsDepthToSpace.hpp"
 #include "PermuteDepthwiseConv2dWeights.hpp"
+#include "PropagateDataLayouts.hpp"
 #include "SquashEqualSiblings.hpp"
 #include "TransposeAsReshape.hpp"
 #include "TurboConvertConstDequantisationLayersToConstLayers.hpp"
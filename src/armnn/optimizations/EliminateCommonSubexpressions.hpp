@@ -0,0 +1,276 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/backends/TensorHandle.hpp>
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+namespace cse
+{
+
+inline void HashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+template <typename T, typename = void>
+struct IsEqualityComparable : std::false_type {};
+
+template <typename T>
+struct IsEqualityComparable<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+    : std::true_type {};
+
+/// Compares the descriptors of two layers of type LayerT. Layers without a descriptor are always equal, and layers
+/// whose descriptor cannot be compared are never considered equal.
+template <typename LayerT, typename = void>
+struct ParametersComparer
+{
+    static bool Equal(const Layer&, const Layer&)
+    {
+        return true;
+    }
+};
+
+template <typename LayerT>
+struct ParametersComparer<LayerT, std::void_t<typename LayerT::DescriptorType>>
+{
+    static bool Equal(const Layer& lhs, const Layer& rhs)
+    {
+        if constexpr (IsEqualityComparable<typename LayerT::DescriptorType>::value)
+        {
+            return PolymorphicDowncast<const LayerT*>(&lhs)->GetParameters() ==
+                   PolymorphicDowncast<const LayerT*>(&rhs)->GetParameters();
+        }
+        else
+        {
+            return false;
+        }
+    }
+};
+
+inline bool AreParametersEqual(const Layer& lhs, const Layer& rhs)
+{
+    switch (lhs.GetType())
+    {
+#define X(name) \
+        case LayerType::name: \
+            return ParametersComparer<LayerTypeOf<LayerType::name>>::Equal(lhs, rhs);
+        LIST_OF_LAYER_TYPE
+#undef X
+        default:
+            return false;
+    }
+}
+
+inline bool IsEligible(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        // Constant layers are not merged as other optimizations rewrite their data in place for a single consumer.
+        case LayerType::Constant:
+        case LayerType::Debug:
+        case LayerType::Input:
+        case LayerType::MemCopy:
+        case LayerType::MemImport:
+        case LayerType::Output:
+        case LayerType::PreCompiled:
+        case LayerType::StandIn:
+            return false;
+        default:
+            return layer.GetNumInputSlots() > 0 && layer.GetNumOutputSlots() > 0;
+    }
+}
+
+inline IConnectableLayer::ImmutableConstantTensors GetConstantTensors(const Layer& layer)
+{
+    return static_cast<const IConnectableLayer&>(layer).GetConstantTensorsByRef();
+}
+
+/// Hashes everything AreLayersEqual compares: the layer type, its parameters, its inputs and its constant tensors.
+inline size_t HashLayer(const Layer& layer)
+{
+    size_t seed = std::hash<int>()(static_cast<int>(layer.GetType()));
+
+    std::string parameters;
+    ParameterStringifyFunction appendParameter = [&parameters](const std::string& name, const std::string& value)
+    {
+        // The guid and name are unique to each layer and must not contribute to the hash.
+        if (name != "Guid" && name != "LayerName")
+        {
+            parameters.append(name).append("=").append(value).append(";");
+        }
+    };
+    layer.SerializeLayerParameters(appendParameter);
+    HashCombine(seed, std::hash<std::string>()(parameters));
+
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        const OutputSlot* connection = layer.GetInputSlot(i).GetConnectedOutputSlot();
+        HashCombine(seed, std::hash<const OutputSlot*>()(connection));
+    }
+
+    for (const std::shared_ptr<ConstTensorHandle>& constant : GetConstantTensors(layer))
+    {
+        if (constant)
+        {
+            const char* data = static_cast<const char*>(constant->Map(true));
+            HashCombine(seed, std::hash<std::string_view>()(
+                std::string_view(data, constant->GetTensorInfo().GetNumBytes())));
+            constant->Unmap();
+        }
+    }
+    return seed;
+}
+
+inline bool AreConstantTensorsEqual(const Layer& lhs, const Layer& rhs)
+{
+    auto lhsConstants = GetConstantTensors(lhs);
+    auto rhsConstants = GetConstantTensors(rhs);
+    if (lhsConstants.size() != rhsConstants.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < lhsConstants.size(); ++i)
+    {
+        const std::shared_ptr<ConstTensorHandle>& lhsConstant = lhsConstants[i];
+        const std::shared_ptr<ConstTensorHandle>& rhsConstant = rhsConstants[i];
+        if (!lhsConstant || !rhsConstant)
+        {
+            if (lhsConstant || rhsConstant)
+            {
+                return false;
+            }
+            continue;
+        }
+        if (lhsConstant == rhsConstant)
+        {
+            continue;
+        }
+        if (lhsConstant->GetTensorInfo() != rhsConstant->GetTensorInfo())
+        {
+            return false;
+        }
+
+        const unsigned int numBytes = lhsConstant->GetTensorInfo().GetNumBytes();
+        const bool equal = std::memcmp(lhsConstant->Map(true), rhsConstant->Map(true), numBytes) == 0;
+        lhsConstant->Unmap();
+        rhsConstant->Unmap();
+        if (!equal)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Two layers are equal if they compute the same outputs: same type, parameters, fused activation, inputs, tensor
+/// infos and constant tensors.
+inline bool AreLayersEqual(const Layer& lhs, const Layer& rhs)
+{
+    if (lhs.GetType() != rhs.GetType() ||
+        lhs.GetNumInputSlots() != rhs.GetNumInputSlots() ||
+        lhs.GetNumOutputSlots() != rhs.GetNumOutputSlots())
+    {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < lhs.GetNumInputSlots(); ++i)
+    {
+        const InputSlot& lhsInput = lhs.GetInputSlot(i);
+        const InputSlot& rhsInput = rhs.GetInputSlot(i);
+        if (lhsInput.GetConnectedOutputSlot() != rhsInput.GetConnectedOutputSlot() ||
+            lhsInput.GetTensorInfo() != rhsInput.GetTensorInfo())
+        {
+            return false;
+        }
+    }
+
+    for (unsigned int i = 0; i < lhs.GetNumOutputSlots(); ++i)
+    {
+        if (lhs.GetOutputSlot(i).GetTensorInfo() != rhs.GetOutputSlot(i).GetTensorInfo())
+        {
+            return false;
+        }
+    }
+
+    auto lhsActivation = lhs.GetAdditionalInformation<ActivationDescriptor>();
+    auto rhsActivation = rhs.GetAdditionalInformation<ActivationDescriptor>();
+    if (static_cast<bool>(lhsActivation) != static_cast<bool>(rhsActivation) ||
+        (lhsActivation && !(*lhsActivation == *rhsActivation)))
+    {
+        return false;
+    }
+
+    return AreParametersEqual(lhs, rhs) && AreConstantTensorsEqual(lhs, rhs);
+}
+
+} // namespace cse
+
+/// Hash-based common subexpression elimination over the whole graph. Layers are visited in topological order and
+/// each layer is looked up among the previously visited layers with the same hash; if an equal layer exists, the
+/// consumers of the duplicate are moved onto it and the duplicate is removed. Because consumers are visited after
+/// their producers, chains of duplicated layers collapse in a single pass. Returns the number of removed layers.
+inline unsigned int EliminateCommonSubexpressions(Graph& graph)
+{
+    std::unordered_multimap<size_t, Layer*> visited;
+    std::vector<Layer*> duplicates;
+
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        if (!cse::IsEligible(*layer) || layer->IsOutputUnconnected())
+        {
+            continue;
+        }
+
+        const size_t hash = cse::HashLayer(*layer);
+        Layer* original = nullptr;
+        auto candidates = visited.equal_range(hash);
+        for (auto it = candidates.first; it != candidates.second; ++it)
+        {
+            if (cse::AreLayersEqual(*it->second, *layer))
+            {
+                original = it->second;
+                break;
+            }
+        }
+
+        if (!original)
+        {
+            visited.emplace(hash, layer);
+            continue;
+        }
+
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            layer->GetOutputSlot(i).MoveAllConnections(original->GetOutputSlot(i));
+        }
+        original->AddRelatedLayerName(layer->GetNameStr());
+        duplicates.push_back(layer);
+    }
+
+    for (Layer* duplicate : duplicates)
+    {
+        graph.EraseLayer(duplicate);
+    }
+    return static_cast<unsigned int>(duplicates.size());
+}
+
+} // namespace optimizations
+} // namespace armnn
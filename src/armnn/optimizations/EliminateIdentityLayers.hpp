@@ -0,0 +1,283 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/TypesUtils.hpp>
+#include <armnn/utility/IgnoreUnused.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
+#include <Half.hpp>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Bypasses layers that pass their input through unchanged: Pad without padding, Slice and StridedSlice covering the
+/// whole tensor, Cast to the same type, Linear activation with a = 1 and b = 0, identity Permute and Transpose, and
+/// Add/Sub of a constant 0 or Mul/Div by a constant 1. A layer is only bypassed if its output tensor info matches
+/// the input it forwards, so the consumers see the same tensor. Bypassed layers are removed by the optimizer once they
+/// are left unconnected. If numEliminated is given, it is incremented for every bypassed layer.
+class EliminateIdentityLayersImpl
+{
+public:
+    explicit EliminateIdentityLayersImpl(unsigned int* numEliminated = nullptr)
+        : m_NumEliminated(numEliminated)
+    {}
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        IgnoreUnused(graph);
+
+        if (layer.GetNumOutputSlots() != 1 || layer.GetOutputSlot(0).GetNumConnections() == 0)
+        {
+            return;
+        }
+
+        Optional<unsigned int> forwardedInput = GetForwardedInput(layer);
+        if (!forwardedInput.has_value())
+        {
+            return;
+        }
+
+        InputSlot& inputSlot = layer.GetInputSlot(forwardedInput.value());
+        OutputSlot* source = inputSlot.GetConnectedOutputSlot();
+        if (!source || inputSlot.GetTensorInfo() != layer.GetOutputSlot(0).GetTensorInfo())
+        {
+            return;
+        }
+
+        layer.GetOutputSlot(0).MoveAllConnections(*source);
+        if (m_NumEliminated)
+        {
+            ++(*m_NumEliminated);
+        }
+    }
+
+protected:
+    ~EliminateIdentityLayersImpl() = default;
+
+private:
+    /// Returns the index of the input slot whose tensor the layer forwards unchanged, if any.
+    static Optional<unsigned int> GetForwardedInput(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Activation:
+            {
+                const auto& descriptor = PolymorphicDowncast<const ActivationLayer*>(&layer)->GetParameters();
+                return IsLinearIdentity(descriptor) ? Optional<unsigned int>(0) : EmptyOptional();
+            }
+            case LayerType::Cast:
+                return 0;
+            case LayerType::Pad:
+            {
+                const auto& descriptor = PolymorphicDowncast<const PadLayer*>(&layer)->GetParameters();
+                for (const auto& padding : descriptor.m_PadList)
+                {
+                    if (padding.first != 0 || padding.second != 0)
+                    {
+                        return EmptyOptional();
+                    }
+                }
+                return 0;
+            }
+            case LayerType::Permute:
+                return IsIdentity(PolymorphicDowncast<const PermuteLayer*>(&layer)->GetPermutation()) ?
+                       Optional<unsigned int>(0) : EmptyOptional();
+            case LayerType::Transpose:
+                return IsIdentity(PolymorphicDowncast<const TransposeLayer*>(&layer)->GetPermutation()) ?
+                       Optional<unsigned int>(0) : EmptyOptional();
+            case LayerType::Slice:
+            {
+                // The output tensor info is compared to the input, so a slice from the origin covers the whole tensor.
+                const auto& descriptor = PolymorphicDowncast<const SliceLayer*>(&layer)->GetParameters();
+                for (unsigned int begin : descriptor.m_Begin)
+                {
+                    if (begin != 0)
+                    {
+                        return EmptyOptional();
+                    }
+                }
+                return 0;
+            }
+            case LayerType::StridedSlice:
+            {
+                const auto& descriptor = PolymorphicDowncast<const StridedSliceLayer*>(&layer)->GetParameters();
+                return IsFullStridedSlice(descriptor, layer.GetInputSlot(0).GetTensorInfo().GetShape()) ?
+                       Optional<unsigned int>(0) : EmptyOptional();
+            }
+            case LayerType::Addition:
+                return GetForwardedInput(layer, BinaryOperation::Add);
+            case LayerType::Multiplication:
+                return GetForwardedInput(layer, BinaryOperation::Mul);
+            case LayerType::Subtraction:
+                return GetForwardedInput(layer, BinaryOperation::Sub);
+            case LayerType::Division:
+                return GetForwardedInput(layer, BinaryOperation::Div);
+            case LayerType::ElementwiseBinary:
+                return GetForwardedInput(
+                    layer, PolymorphicDowncast<const ElementwiseBinaryLayer*>(&layer)->GetParameters().m_Operation);
+            default:
+                return EmptyOptional();
+        }
+    }
+
+    /// Binary operations forward one input if the other one is a constant neutral element: 0 for Add and Sub, and
+    /// 1 for Mul and Div. Sub and Div are only neutral for a constant second operand.
+    static Optional<unsigned int> GetForwardedInput(const Layer& layer, BinaryOperation operation)
+    {
+        switch (operation)
+        {
+            case BinaryOperation::Add:
+            case BinaryOperation::Mul:
+            {
+                const float neutral = operation == BinaryOperation::Add ? 0.0f : 1.0f;
+                if (IsConstantFilledWith(layer.GetInputSlot(1), neutral))
+                {
+                    return 0;
+                }
+                if (IsConstantFilledWith(layer.GetInputSlot(0), neutral))
+                {
+                    return 1;
+                }
+                return EmptyOptional();
+            }
+            case BinaryOperation::Sub:
+                return IsConstantFilledWith(layer.GetInputSlot(1), 0.0f) ?
+                       Optional<unsigned int>(0) : EmptyOptional();
+            case BinaryOperation::Div:
+                return IsConstantFilledWith(layer.GetInputSlot(1), 1.0f) ?
+                       Optional<unsigned int>(0) : EmptyOptional();
+            default:
+                return EmptyOptional();
+        }
+    }
+
+    static bool IsLinearIdentity(const ActivationDescriptor& descriptor)
+    {
+        return descriptor.m_Function == ActivationFunction::Linear && descriptor.m_A == 1.0f && descriptor.m_B == 0.0f;
+    }
+
+    static bool IsIdentity(const PermutationVector& permutation)
+    {
+        for (unsigned int i = 0; i < permutation.GetSize(); ++i)
+        {
+            if (permutation[i] != i)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool IsFullStridedSlice(const StridedSliceDescriptor& descriptor, const TensorShape& inputShape)
+    {
+        if (descriptor.m_ShrinkAxisMask != 0 || descriptor.m_EllipsisMask != 0 || descriptor.m_NewAxisMask != 0 ||
+            descriptor.m_Begin.size() != inputShape.GetNumDimensions() ||
+            descriptor.m_End.size() != inputShape.GetNumDimensions() ||
+            descriptor.m_Stride.size() != inputShape.GetNumDimensions())
+        {
+            return false;
+        }
+
+        for (unsigned int axis = 0; axis < inputShape.GetNumDimensions(); ++axis)
+        {
+            if (descriptor.m_Stride[axis] != 1)
+            {
+                return false;
+            }
+            const int start = descriptor.GetStartForAxis(inputShape, axis);
+            const int stop  = descriptor.GetStopForAxis(inputShape, axis, start);
+            if (start != 0 || stop != static_cast<int>(inputShape[axis]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Checks whether the input slot is fed by a ConstantLayer in which every element equals the given value.
+    static bool IsConstantFilledWith(const InputSlot& inputSlot, float value)
+    {
+        const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+        if (!connection || connection->GetOwningLayer().GetType() != LayerType::Constant)
+        {
+            return false;
+        }
+
+        const auto& constant = PolymorphicDowncast<const ConstantLayer*>(&connection->GetOwningLayer())->m_LayerOutput;
+        if (!constant)
+        {
+            return false;
+        }
+
+        const TensorInfo& info = constant->GetTensorInfo();
+        if (info.HasPerAxisQuantization())
+        {
+            return false;
+        }
+
+        switch (info.GetDataType())
+        {
+            case DataType::Float32:
+                return AllElementsEqual(constant->GetConstTensor<float>(), info.GetNumElements(),
+                                        [](float element) { return element; }, value);
+            case DataType::Float16:
+                return AllElementsEqual(constant->GetConstTensor<Half>(), info.GetNumElements(),
+                                        [](Half element) { return static_cast<float>(element); }, value);
+            case DataType::Signed32:
+                return AllElementsEqual(constant->GetConstTensor<int32_t>(), info.GetNumElements(),
+                                        [](int32_t element) { return static_cast<float>(element); }, value);
+            case DataType::QAsymmU8:
+                return AllElementsEqual(constant->GetConstTensor<uint8_t>(), info.GetNumElements(),
+                                        [&info](uint8_t element)
+                                        {
+                                            return Dequantize(element, info.GetQuantizationScale(),
+                                                              info.GetQuantizationOffset());
+                                        }, value);
+            case DataType::QAsymmS8:
+            case DataType::QSymmS8:
+                return AllElementsEqual(constant->GetConstTensor<int8_t>(), info.GetNumElements(),
+                                        [&info](int8_t element)
+                                        {
+                                            return Dequantize(element, info.GetQuantizationScale(),
+                                                              info.GetQuantizationOffset());
+                                        }, value);
+            case DataType::QSymmS16:
+                return AllElementsEqual(constant->GetConstTensor<int16_t>(), info.GetNumElements(),
+                                        [&info](int16_t element)
+                                        {
+                                            return Dequantize(element, info.GetQuantizationScale(),
+                                                              info.GetQuantizationOffset());
+                                        }, value);
+            default:
+                return false;
+        }
+    }
+
+    template <typename T, typename Decode>
+    static bool AllElementsEqual(const T* data, unsigned int numElements, Decode decode, float value)
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            if (decode(data[i]) != value)
+            {
+                return false;
+            }
+        }
+        return numElements > 0;
+    }
+
+    unsigned int* m_NumEliminated;
+};
+
+using EliminateIdentityLayers = OptimizeForType<Layer, EliminateIdentityLayersImpl>;
+
+} // namespace optimizations
+} // namespace armnn
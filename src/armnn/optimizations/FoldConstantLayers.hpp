@@ -0,0 +1,267 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/BackendRegistry.hpp>
+#include <armnn/Logging.hpp>
+#include <armnn/backends/IBackendInternal.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+#include <armnn/backends/WorkloadFactory.hpp>
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Replaces layers whose inputs are all (directly or through other foldable layers) ConstantLayers by ConstantLayers
+/// holding their outputs. The constant subgraph is evaluated once at optimization time with the CpuRef workloads, so
+/// the pass does nothing when the reference backend is not available. Tensors larger than MaxFoldedTensorBytes are
+/// never folded so that folding cannot noticeably grow the memory held by the network.
+class FoldConstantLayersImpl
+{
+public:
+    static constexpr unsigned int MaxFoldedTensorBytes = 1024 * 1024;
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        if (!BackendRegistryInstance().IsBackendRegistered(Compute::CpuRef))
+        {
+            return;
+        }
+
+        if (!IsFoldable(layer))
+        {
+            return;
+        }
+
+        std::vector<std::vector<uint8_t>> outputs;
+        if (!Evaluate(layer, outputs))
+        {
+            return;
+        }
+
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& outputSlot = layer.GetOutputSlot(i);
+            TensorInfo constantInfo = outputSlot.GetTensorInfo();
+            constantInfo.SetConstant(true);
+
+            std::string name = layer.GetNameStr() + "-folded";
+            if (layer.GetNumOutputSlots() > 1)
+            {
+                name += "-" + std::to_string(i);
+            }
+
+            auto constantLayer = graph.AddLayer<ConstantLayer>(name.c_str());
+            constantLayer->m_LayerOutput =
+                std::make_shared<ScopedTensorHandle>(ConstTensor(constantInfo, outputs[i].data()));
+
+            // The folded layer is removed by the optimizer once it is left unconnected.
+            outputSlot.MoveAllConnections(constantLayer->GetOutputSlot(0));
+            constantLayer->GetOutputSlot(0).SetTensorInfo(constantInfo);
+        }
+
+        ARMNN_LOG(debug) << "FoldConstantLayers: folded " << GetLayerTypeAsCString(layer.GetType())
+                         << " layer \"" << layer.GetNameStr() << "\" into a constant";
+    }
+
+protected:
+    FoldConstantLayersImpl()  = default;
+    ~FoldConstantLayersImpl() = default;
+
+private:
+    static bool IsFoldableType(LayerType type)
+    {
+        switch (type)
+        {
+            case LayerType::Constant:
+            case LayerType::Debug:
+            case LayerType::Input:
+            case LayerType::MemCopy:
+            case LayerType::MemImport:
+            case LayerType::Output:
+            case LayerType::PreCompiled:
+            case LayerType::StandIn:
+                return false;
+            default:
+                return true;
+        }
+    }
+
+    static bool HasFoldableOutputs(const Layer& layer)
+    {
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            const OutputSlot& outputSlot = layer.GetOutputSlot(i);
+            if (!outputSlot.IsTensorInfoSet())
+            {
+                return false;
+            }
+            const TensorInfo& info = outputSlot.GetTensorInfo();
+            if (info.GetShape().GetDimensionality() != Dimensionality::Specified ||
+                !info.GetShape().AreAllDimensionsSpecified() ||
+                info.GetNumBytes() > MaxFoldedTensorBytes)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// A layer is foldable if the reference backend supports it and every input comes from a ConstantLayer or from
+    /// another foldable layer. The producers are resolved with an explicit stack rather than recursion, as a chain of
+    /// producers can be as deep as the graph.
+    bool IsFoldable(const Layer& root) const
+    {
+        std::vector<const Layer*> stack { &root };
+        while (!stack.empty())
+        {
+            const Layer* layer = stack.back();
+            if (m_Foldable.count(layer->GetGuid()) > 0)
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            bool result = IsFoldableType(layer->GetType()) &&
+                          layer->GetNumInputSlots() > 0 &&
+                          layer->GetNumOutputSlots() > 0 &&
+                          HasFoldableOutputs(*layer);
+
+            std::vector<const Layer*> unresolvedProducers;
+            for (unsigned int i = 0; result && i < layer->GetNumInputSlots(); ++i)
+            {
+                const OutputSlot* connection = layer->GetInputSlot(i).GetConnectedOutputSlot();
+                if (!connection)
+                {
+                    result = false;
+                    break;
+                }
+                const Layer& producer = connection->GetOwningLayer();
+                if (producer.GetType() == LayerType::Constant)
+                {
+                    continue;
+                }
+                auto it = m_Foldable.find(producer.GetGuid());
+                if (it == m_Foldable.end())
+                {
+                    unresolvedProducers.push_back(&producer);
+                }
+                else
+                {
+                    result = it->second;
+                }
+            }
+
+            if (result && !unresolvedProducers.empty())
+            {
+                // Comes back to this layer once its producers are resolved.
+                stack.insert(stack.end(), unresolvedProducers.begin(), unresolvedProducers.end());
+                continue;
+            }
+
+            if (result)
+            {
+                std::string reasonIfUnsupported;
+                result = IWorkloadFactory::IsLayerSupported(Compute::CpuRef, *layer, EmptyOptional(),
+                                                            reasonIfUnsupported);
+            }
+
+            m_Foldable[layer->GetGuid()] = result;
+            stack.pop_back();
+        }
+        return m_Foldable.at(root.GetGuid());
+    }
+
+    /// Clones the constant subgraph that produces the outputs of the given layer into a separate graph.
+    static Layer* CloneSubgraph(const Layer& layer, Graph& subgraph, std::unordered_map<const Layer*, Layer*>& clones)
+    {
+        auto it = clones.find(&layer);
+        if (it != clones.end())
+        {
+            return it->second;
+        }
+
+        Layer* clone = layer.Clone(subgraph);
+        clone->SetBackendId(Compute::CpuRef);
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            clone->GetOutputSlot(i).SetTensorInfo(layer.GetOutputSlot(i).GetTensorInfo());
+        }
+        clones[&layer] = clone;
+
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            const OutputSlot* connection = layer.GetInputSlot(i).GetConnectedOutputSlot();
+            Layer* producer = CloneSubgraph(connection->GetOwningLayer(), subgraph, clones);
+            producer->GetOutputSlot(connection->CalculateIndexOnOwner()).Connect(clone->GetInputSlot(i));
+        }
+        return clone;
+    }
+
+    /// Runs the constant subgraph that produces the outputs of the given layer on the reference backend.
+    static bool Evaluate(const Layer& layer, std::vector<std::vector<uint8_t>>& outputs)
+    {
+        try
+        {
+            Graph subgraph;
+            std::unordered_map<const Layer*, Layer*> clones;
+            Layer* root = CloneSubgraph(layer, subgraph, clones);
+
+            auto backend = BackendRegistryInstance().GetFactory(Compute::CpuRef)();
+            // Tensor handles are created unmanaged, so the factory does not need a memory manager.
+            auto workloadFactory = backend->CreateWorkloadFactory();
+            TensorHandleFactoryRegistry registry;
+
+            std::vector<std::unique_ptr<IWorkload>> workloads;
+            for (Layer* subgraphLayer : subgraph.TopologicalSort())
+            {
+                subgraphLayer->CreateTensorHandles(registry, *workloadFactory, false);
+                for (unsigned int i = 0; i < subgraphLayer->GetNumOutputSlots(); ++i)
+                {
+                    subgraphLayer->GetOutputHandler(i).GetData()->Allocate();
+                }
+                workloads.push_back(subgraphLayer->CreateWorkload(*workloadFactory));
+            }
+
+            for (auto& workload : workloads)
+            {
+                workload->Execute();
+            }
+
+            outputs.resize(root->GetNumOutputSlots());
+            for (unsigned int i = 0; i < root->GetNumOutputSlots(); ++i)
+            {
+                ITensorHandle* handle = root->GetOutputHandler(i).GetData();
+                outputs[i].resize(root->GetOutputSlot(i).GetTensorInfo().GetNumBytes());
+                std::memcpy(outputs[i].data(), handle->Map(true), outputs[i].size());
+                handle->Unmap();
+            }
+        }
+        catch (const armnn::Exception& e)
+        {
+            ARMNN_LOG(debug) << "FoldConstantLayers: unable to fold layer \"" << layer.GetNameStr()
+                             << "\": " << e.what();
+            return false;
+        }
+        return true;
+    }
+
+    // Layers are visited from the outputs towards the inputs, and folding a layer can only change the result for
+    // layers that consume it, which have already been visited. The results can therefore be kept for the whole pass.
+    mutable std::unordered_map<LayerGuid, bool> m_Foldable;
+};
+
+using FoldConstantLayers = OptimizeForType<Layer, FoldConstantLayersImpl>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,337 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+#include <armnnUtils/DataLayoutIndexed.hpp>
+#include <ResolveType.hpp>
+
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+template<typename LayerT, armnn::DataType ArmnnType,
+         typename T = armnn::ResolveType<ArmnnType>>
+class FoldScaleShift
+{
+public:
+    /// Run for every exclusive connection between a Convolution2d, DepthwiseConvolution2d or FullyConnected layer and
+    /// a child ElementwiseBinary layer that multiplies, divides, adds or subtracts a per-output-channel constant.
+    /// Consecutive exclusive children of this kind are folded together, e.g. the Mul followed by Add a framework emits
+    /// for a lowered batch norm. A new layer is added whose weights and bias are the ones of the base layer scaled and
+    /// shifted by the constants. The children are removed, the base will be removed if it's left unconnected.
+    /// Only float layers are handled, as folding into quantized weights would change their quantization parameters.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        Layer& base = connection.GetConnectedOutputSlot()->GetOwningLayer();
+        auto layer = PolymorphicDowncast<LayerT*>(&base);
+        auto descriptor = layer->GetParameters();
+
+        if (base.GetDataType() != ArmnnType || !IsConstantInput(base, 1) ||
+            (descriptor.m_BiasEnabled && !IsConstantInput(base, 2)))
+        {
+            return;
+        }
+
+        const TensorInfo& outputInfo = base.GetOutputSlot(0).GetTensorInfo();
+        const unsigned int channelsIndex  = GetChannelsIndex(descriptor, outputInfo);
+        const unsigned int outputChannels = outputInfo.GetShape()[channelsIndex];
+
+        // Accumulates the children as output * scale + shift per output channel.
+        std::vector<float> scale(outputChannels, 1.0f);
+        std::vector<float> shift(outputChannels, 0.0f);
+        std::vector<Layer*> children;
+
+        const InputSlot* childInput = &connection;
+        while (FoldChild(*childInput, outputInfo, channelsIndex, scale, shift))
+        {
+            Layer& child = childInput->GetOwningLayer();
+            children.push_back(&child);
+
+            const OutputSlot& childOutput = child.GetOutputSlot(0);
+            if (childOutput.GetNumConnections() != 1)
+            {
+                break;
+            }
+            childInput = childOutput.GetConnection(0);
+        }
+        if (children.empty())
+        {
+            return;
+        }
+
+        ConstantLayer* weightsLayer = PolymorphicDowncast<ConstantLayer*>(
+            &base.GetInputSlot(1).GetConnectedOutputSlot()->GetOwningLayer());
+        const TensorInfo& weightsInfo = weightsLayer->m_LayerOutput->GetTensorInfo();
+        const T* weights = weightsLayer->m_LayerOutput->template GetConstTensor<T>();
+
+        // Output channels are the outermost dimension of Convolution2d weights [O, H, W, I] or [O, I, H, W] and of
+        // transposed FullyConnected weights [O, I], and the innermost one of DepthwiseConvolution2d weights
+        // [1, H, W, O] and FullyConnected weights [I, O].
+        const bool outputChannelsOutermost = IsOutputChannelOutermost(descriptor);
+        const unsigned int numWeights = weightsInfo.GetNumElements();
+        const unsigned int blockSize  = numWeights / outputChannels;
+
+        std::vector<T> fusedWeights(numWeights);
+        for (unsigned int i = 0; i < numWeights; ++i)
+        {
+            const unsigned int cOut = outputChannelsOutermost ? i / blockSize : i % outputChannels;
+            fusedWeights[i] = static_cast<T>(static_cast<float>(weights[i]) * scale[cOut]);
+        }
+        ConstTensor fusedWeightsTensor(weightsInfo, fusedWeights);
+
+        const bool biasWasEnabledBeforeOpt = descriptor.m_BiasEnabled;
+        std::vector<T> fusedBias(outputChannels);
+        ConstantLayer* biasLayer = nullptr;
+        if (biasWasEnabledBeforeOpt)
+        {
+            biasLayer = PolymorphicDowncast<ConstantLayer*>(
+                &base.GetInputSlot(2).GetConnectedOutputSlot()->GetOwningLayer());
+            const T* bias = biasLayer->m_LayerOutput->template GetConstTensor<T>();
+            for (unsigned int cOut = 0; cOut < outputChannels; ++cOut)
+            {
+                fusedBias[cOut] = static_cast<T>(static_cast<float>(bias[cOut]) * scale[cOut] + shift[cOut]);
+            }
+        }
+        else
+        {
+            descriptor.m_BiasEnabled = true;
+            for (unsigned int cOut = 0; cOut < outputChannels; ++cOut)
+            {
+                fusedBias[cOut] = static_cast<T>(shift[cOut]);
+            }
+        }
+        ConstTensor fusedBiasTensor(TensorInfo({outputChannels}, ArmnnType, 0.0f, 0, true), fusedBias);
+
+        // Insert the new layer that has the scale and shift folded into its weights and bias.
+        std::string name = "fused";
+        for (Layer* child : children)
+        {
+            name += std::string("-") + child->GetName();
+        }
+        name += std::string("-into-") + base.GetName();
+
+        OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+        auto& newLayer = *graph.InsertNewLayer<LayerT>(base.GetInputSlot(0), descriptor, name.c_str());
+        newLayer.GetOutputSlot().MoveAllConnections(*parentOut);
+
+        weightsLayer->GetOutputSlot(0).Disconnect(base.GetInputSlot(1));
+        weightsLayer->GetOutputSlot(0).Connect(newLayer.GetInputSlot(1));
+        weightsLayer->m_LayerOutput = std::make_unique<ScopedTensorHandle>(fusedWeightsTensor);
+
+        if (biasWasEnabledBeforeOpt)
+        {
+            biasLayer->GetOutputSlot(0).Disconnect(base.GetInputSlot(2));
+        }
+        else
+        {
+            biasLayer = graph.AddLayer<ConstantLayer>("Bias");
+            biasLayer->GetOutputSlot(0).SetTensorInfo(fusedBiasTensor.GetInfo());
+        }
+        biasLayer->GetOutputSlot(0).Connect(newLayer.GetInputSlot(2));
+        biasLayer->m_LayerOutput = std::make_unique<ScopedTensorHandle>(fusedBiasTensor);
+
+        // Moves the connections of the last child to the new layer. The first child is removed by the wrapper as it's
+        // left unconnected, the ones after it are erased here, starting with the last one.
+        children.back()->GetOutputSlot().MoveAllConnections(newLayer.GetOutputSlot());
+        for (auto it = children.rbegin(); std::next(it) != children.rend(); ++it)
+        {
+            graph.EraseLayer(*it);
+        }
+    }
+
+protected:
+    FoldScaleShift()  = default;
+    ~FoldScaleShift() = default;
+
+private:
+    static bool IsConstantInput(const Layer& layer, unsigned int index)
+    {
+        if (index >= layer.GetNumInputSlots())
+        {
+            return false;
+        }
+        const OutputSlot* connection = layer.GetInputSlot(index).GetConnectedOutputSlot();
+        // The constant is modified in place, so it must not be shared with other layers.
+        return connection && connection->GetNumConnections() == 1 &&
+               connection->GetOwningLayer().GetType() == LayerType::Constant &&
+               PolymorphicDowncast<const ConstantLayer*>(&connection->GetOwningLayer())->m_LayerOutput != nullptr;
+    }
+
+    static unsigned int GetChannelsIndex(const FullyConnectedDescriptor&, const TensorInfo& outputInfo)
+    {
+        return outputInfo.GetNumDimensions() - 1;
+    }
+
+    template<typename Descriptor>
+    static unsigned int GetChannelsIndex(const Descriptor& descriptor, const TensorInfo&)
+    {
+        return armnnUtils::DataLayoutIndexed(descriptor.m_DataLayout).GetChannelsIndex();
+    }
+
+    static bool IsOutputChannelOutermost(const FullyConnectedDescriptor& descriptor)
+    {
+        return descriptor.m_TransposeWeightMatrix;
+    }
+
+    static bool IsOutputChannelOutermost(const Convolution2dDescriptor&)
+    {
+        return true;
+    }
+
+    static bool IsOutputChannelOutermost(const DepthwiseConvolution2dDescriptor&)
+    {
+        return false;
+    }
+
+    /// Folds the ElementwiseBinary layer owning the input slot into scale and shift, if the layer applies a constant
+    /// that is either a scalar or holds one value per output channel to the output of the base layer.
+    static bool FoldChild(const InputSlot& childInput,
+                          const TensorInfo& outputInfo,
+                          unsigned int channelsIndex,
+                          std::vector<float>& scale,
+                          std::vector<float>& shift)
+    {
+        const Layer& child = childInput.GetOwningLayer();
+        if (child.GetType() != LayerType::ElementwiseBinary || child.GetDataType() != ArmnnType ||
+            child.GetOutputSlot(0).GetTensorInfo().GetShape() != outputInfo.GetShape())
+        {
+            return false;
+        }
+
+        const BinaryOperation operation =
+            PolymorphicDowncast<const ElementwiseBinaryLayer*>(&child)->GetParameters().m_Operation;
+        const unsigned int inputIndex = childInput.GetSlotIndex();
+        // Sub and Div can only be folded when the output of the base is the first operand.
+        if ((operation == BinaryOperation::Sub || operation == BinaryOperation::Div) && inputIndex != 0)
+        {
+            return false;
+        }
+        if (operation != BinaryOperation::Add && operation != BinaryOperation::Sub &&
+            operation != BinaryOperation::Mul && operation != BinaryOperation::Div)
+        {
+            return false;
+        }
+
+        std::vector<float> values;
+        if (!GetPerChannelConstant(child.GetInputSlot(1 - inputIndex), outputInfo, channelsIndex, values))
+        {
+            return false;
+        }
+
+        for (unsigned int cOut = 0; cOut < scale.size(); ++cOut)
+        {
+            const float value = values.size() == 1 ? values[0] : values[cOut];
+            switch (operation)
+            {
+                case BinaryOperation::Add:
+                    shift[cOut] += value;
+                    break;
+                case BinaryOperation::Sub:
+                    shift[cOut] -= value;
+                    break;
+                case BinaryOperation::Mul:
+                    scale[cOut] *= value;
+                    shift[cOut] *= value;
+                    break;
+                default:
+                    scale[cOut] /= value;
+                    shift[cOut] /= value;
+                    break;
+            }
+        }
+        return true;
+    }
+
+    /// Reads the constant feeding the input slot if it is a scalar, or if all of its dimensions are 1 except the one
+    /// aligned with the channels of the output, which matches the number of output channels.
+    static bool GetPerChannelConstant(const InputSlot& inputSlot,
+                                      const TensorInfo& outputInfo,
+                                      unsigned int channelsIndex,
+                                      std::vector<float>& values)
+    {
+        const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+        if (!connection || connection->GetOwningLayer().GetType() != LayerType::Constant)
+        {
+            return false;
+        }
+        const auto& constant = PolymorphicDowncast<const ConstantLayer*>(&connection->GetOwningLayer())->m_LayerOutput;
+        if (!constant || constant->GetTensorInfo().GetDataType() != ArmnnType)
+        {
+            return false;
+        }
+
+        const TensorShape& shape = constant->GetTensorInfo().GetShape();
+        const unsigned int numElements = shape.GetNumElements();
+        if (numElements != 1)
+        {
+            const unsigned int outputRank = outputInfo.GetNumDimensions();
+            if (shape.GetNumDimensions() > outputRank)
+            {
+                return false;
+            }
+            // Shapes are aligned on their innermost dimension when broadcasting.
+            const unsigned int offset = outputRank - shape.GetNumDimensions();
+            for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+            {
+                const unsigned int expected = i + offset == channelsIndex ? outputInfo.GetShape()[channelsIndex] : 1;
+                if (shape[i] != expected)
+                {
+                    return false;
+                }
+            }
+            if (channelsIndex < offset)
+            {
+                return false;
+            }
+        }
+
+        const T* data = constant->template GetConstTensor<T>();
+        values.resize(numElements);
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            values[i] = static_cast<float>(data[i]);
+        }
+        return true;
+    }
+};
+
+using FoldScaleShiftIntoConvolution2dFloat32 =
+        OptimizeForExclusiveConnection<Convolution2dLayer,
+                                       ElementwiseBinaryLayer,
+                                       FoldScaleShift<Convolution2dLayer, armnn::DataType::Float32>>;
+
+using FoldScaleShiftIntoConvolution2dFloat16 =
+        OptimizeForExclusiveConnection<Convolution2dLayer,
+                                       ElementwiseBinaryLayer,
+                                       FoldScaleShift<Convolution2dLayer, armnn::DataType::Float16>>;
+
+using FoldScaleShiftIntoDepthwiseConvolution2dFloat32 =
+        OptimizeForExclusiveConnection<DepthwiseConvolution2dLayer,
+                                       ElementwiseBinaryLayer,
+                                       FoldScaleShift<DepthwiseConvolution2dLayer, armnn::DataType::Float32>>;
+
+using FoldScaleShiftIntoDepthwiseConvolution2dFloat16 =
+        OptimizeForExclusiveConnection<DepthwiseConvolution2dLayer,
+                                       ElementwiseBinaryLayer,
+                                       FoldScaleShift<DepthwiseConvolution2dLayer, armnn::DataType::Float16>>;
+
+using FoldScaleShiftIntoFullyConnectedFloat32 =
+        OptimizeForExclusiveConnection<FullyConnectedLayer,
+                                       ElementwiseBinaryLayer,
+                                       FoldScaleShift<FullyConnectedLayer, armnn::DataType::Float32>>;
+
+using FoldScaleShiftIntoFullyConnectedFloat16 =
+        OptimizeForExclusiveConnection<FullyConnectedLayer,
+                                       ElementwiseBinaryLayer,
+                                       FoldScaleShift<FullyConnectedLayer, armnn::DataType::Float16>>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,434 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <armnn/utility/PolymorphicDowncast.hpp>
+#include <armnnUtils/Transpose.hpp>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+namespace layout
+{
+
+/// Returns the permutation undoing the given Transpose permutation: transposing by the result after transposing by
+/// the permutation gives back the original tensor.
+inline PermutationVector GetInverse(const PermutationVector& permutation)
+{
+    std::vector<unsigned int> inverse(permutation.GetSize());
+    for (unsigned int i = 0; i < permutation.GetSize(); ++i)
+    {
+        inverse[permutation[i]] = i;
+    }
+    return PermutationVector(inverse.data(), static_cast<unsigned int>(inverse.size()));
+}
+
+inline bool IsTransposeWith(const Layer& layer, const PermutationVector& permutation)
+{
+    return layer.GetType() == LayerType::Transpose &&
+           PolymorphicDowncast<const TransposeLayer*>(&layer)->GetPermutation().IsEqual(permutation);
+}
+
+/// Layers whose computation does not depend on the order of the dimensions of their tensors, provided the axes in their
+/// descriptor are remapped.
+inline bool IsLayoutAgnostic(const Layer& layer, unsigned int numDimensions)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Activation:
+        case LayerType::Addition:
+        case LayerType::Concat:
+        case LayerType::Division:
+        case LayerType::ElementwiseBinary:
+        case LayerType::ElementwiseUnary:
+        case LayerType::Floor:
+        case LayerType::Maximum:
+        case LayerType::Minimum:
+        case LayerType::Multiplication:
+        case LayerType::Pad:
+        case LayerType::Subtraction:
+            break;
+        case LayerType::Mean:
+            // Reductions dropping dimensions change the rank, so the permutation would not apply to the output.
+            if (!PolymorphicDowncast<const MeanLayer*>(&layer)->GetParameters().m_KeepDims)
+            {
+                return false;
+            }
+            break;
+        case LayerType::Reduce:
+            if (!PolymorphicDowncast<const ReduceLayer*>(&layer)->GetParameters().m_KeepDims)
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    if (layer.GetNumOutputSlots() != 1 ||
+        layer.GetOutputSlot(0).GetTensorInfo().GetNumDimensions() != numDimensions)
+    {
+        return false;
+    }
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        if (!layer.GetInputSlot(i).GetConnectedOutputSlot() ||
+            layer.GetInputSlot(i).GetTensorInfo().GetNumDimensions() != numDimensions)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// A set of layout agnostic layers fed by a Transpose that can run on the tensors before the Transpose instead,
+/// together with the connections crossing its boundary.
+struct LayoutRegion
+{
+    std::vector<Layer*> m_Layers;
+    std::set<const Layer*> m_Members;
+    std::vector<InputSlot*> m_Inputs;   ///< Input slots of the region fed from outside of it.
+    std::vector<InputSlot*> m_Outputs;  ///< Input slots outside of the region fed from inside of it.
+};
+
+/// Collects the layout agnostic layers reachable from the consumers of the transpose. Returns false if one of the
+/// consumers of the transpose cannot join the region, since the transpose would then have to stay, or if the region
+/// feeds itself through a Transpose.
+inline bool CollectRegion(TransposeLayer& transpose, LayoutRegion& region)
+{
+    const unsigned int numDimensions = transpose.GetPermutation().GetSize();
+
+    std::vector<Layer*> pending;
+    for (InputSlot* consumer : transpose.GetOutputSlot(0).GetConnections())
+    {
+        Layer& layer = consumer->GetOwningLayer();
+        if (!IsLayoutAgnostic(layer, numDimensions))
+        {
+            return false;
+        }
+        pending.push_back(&layer);
+    }
+
+    while (!pending.empty())
+    {
+        Layer* layer = pending.back();
+        pending.pop_back();
+        if (!region.m_Members.insert(layer).second)
+        {
+            continue;
+        }
+        region.m_Layers.push_back(layer);
+
+        for (InputSlot* consumer : layer->GetOutputSlot(0).GetConnections())
+        {
+            Layer& next = consumer->GetOwningLayer();
+            if (IsLayoutAgnostic(next, numDimensions))
+            {
+                pending.push_back(&next);
+            }
+        }
+    }
+
+    for (Layer* layer : region.m_Layers)
+    {
+        for (unsigned int i = 0; i < layer->GetNumInputSlots(); ++i)
+        {
+            InputSlot& input = layer->GetInputSlot(i);
+            const Layer& producer = input.GetConnectedOutputSlot()->GetOwningLayer();
+            if (region.m_Members.count(&producer) > 0)
+            {
+                continue;
+            }
+            // A Transpose between two layers of the region would see its input and output change layout.
+            if (producer.GetType() == LayerType::Transpose &&
+                region.m_Members.count(&producer.GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer()) > 0)
+            {
+                return false;
+            }
+            region.m_Inputs.push_back(&input);
+        }
+        for (InputSlot* consumer : layer->GetOutputSlot(0).GetConnections())
+        {
+            if (region.m_Members.count(&consumer->GetOwningLayer()) == 0)
+            {
+                region.m_Outputs.push_back(consumer);
+            }
+        }
+    }
+    return true;
+}
+
+/// Transpose volume, in elements, saved by running the region on the tensors before the transposes. Inputs coming from
+/// a Transpose by the same permutation and outputs going to a Transpose by the inverse one are read and written
+/// directly, and those transposes are removed when the region is their only consumer or producer. Constant inputs are
+/// permuted at optimization time. Any other input needs a Transpose by the inverse permutation and any other output a
+/// Transpose by the permutation.
+inline int64_t GetTransposeVolumeSaving(const LayoutRegion& region,
+                                        const PermutationVector& permutation,
+                                        const PermutationVector& inverse)
+{
+    int64_t saving = 0;
+    std::set<const Layer*> removed;
+    for (const InputSlot* input : region.m_Inputs)
+    {
+        const OutputSlot& source = *input->GetConnectedOutputSlot();
+        const Layer& producer = source.GetOwningLayer();
+        const int64_t volume = source.GetTensorInfo().GetNumElements();
+        if (IsTransposeWith(producer, permutation))
+        {
+            bool onlyFeedsRegion = true;
+            for (const InputSlot* consumer : source.GetConnections())
+            {
+                onlyFeedsRegion &= region.m_Members.count(&consumer->GetOwningLayer()) > 0;
+            }
+            if (onlyFeedsRegion && removed.insert(&producer).second)
+            {
+                saving += volume;
+            }
+        }
+        else if (producer.GetType() != LayerType::Constant)
+        {
+            saving -= volume;
+        }
+    }
+    for (const InputSlot* output : region.m_Outputs)
+    {
+        const Layer& consumer = output->GetOwningLayer();
+        const int64_t volume = output->GetTensorInfo().GetNumElements();
+        saving += IsTransposeWith(consumer, inverse) ? volume : -volume;
+    }
+    return saving;
+}
+
+inline std::vector<unsigned int> RemapAxes(const std::vector<unsigned int>& axes, const PermutationVector& permutation)
+{
+    std::vector<unsigned int> remapped;
+    for (unsigned int axis : axes)
+    {
+        remapped.push_back(permutation[axis]);
+    }
+    std::sort(remapped.begin(), remapped.end());
+    return remapped;
+}
+
+/// Replaces the layer with a new one of the same type using the given descriptor and takes over its connections.
+template <typename LayerT, typename Descriptor>
+void ReplaceWithDescriptor(Graph& graph, Layer& layer, const Descriptor& descriptor)
+{
+    LayerT* replacement = graph.AddLayer<LayerT>(descriptor, layer.GetName());
+    for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+    {
+        OutputSlot* source = layer.GetInputSlot(i).GetConnectedOutputSlot();
+        source->Disconnect(layer.GetInputSlot(i));
+        source->Connect(replacement->GetInputSlot(i));
+    }
+    replacement->GetOutputSlot(0).SetTensorInfo(layer.GetOutputSlot(0).GetTensorInfo());
+    layer.GetOutputSlot(0).MoveAllConnections(replacement->GetOutputSlot(0));
+    Layer* replaced = &layer;
+    graph.EraseLayer(replaced);
+}
+
+/// Rewrites the axes in the descriptor of the layer for tensors transposed by inverse. The old axis a becomes axis
+/// permutation[a], as inverse[permutation[a]] is a.
+inline void RemapDescriptor(Graph& graph,
+                            Layer& layer,
+                            const PermutationVector& permutation,
+                            const PermutationVector& inverse)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Concat:
+        {
+            const OriginsDescriptor& old = PolymorphicDowncast<const ConcatLayer*>(&layer)->GetParameters();
+            OriginsDescriptor descriptor(old.GetNumViews(), old.GetNumDimensions());
+            for (unsigned int view = 0; view < old.GetNumViews(); ++view)
+            {
+                for (unsigned int i = 0; i < old.GetNumDimensions(); ++i)
+                {
+                    descriptor.SetViewOriginCoord(view, i, old.GetViewOrigin(view)[inverse[i]]);
+                }
+            }
+            descriptor.SetConcatAxis(permutation[old.GetConcatAxis()]);
+            ReplaceWithDescriptor<ConcatLayer>(graph, layer, descriptor);
+            break;
+        }
+        case LayerType::Pad:
+        {
+            const PadDescriptor& old = PolymorphicDowncast<const PadLayer*>(&layer)->GetParameters();
+            PadDescriptor descriptor = old;
+            for (unsigned int i = 0; i < inverse.GetSize(); ++i)
+            {
+                descriptor.m_PadList[i] = old.m_PadList[inverse[i]];
+            }
+            ReplaceWithDescriptor<PadLayer>(graph, layer, descriptor);
+            break;
+        }
+        case LayerType::Mean:
+        {
+            MeanDescriptor descriptor = PolymorphicDowncast<const MeanLayer*>(&layer)->GetParameters();
+            descriptor.m_Axis = RemapAxes(descriptor.m_Axis, permutation);
+            ReplaceWithDescriptor<MeanLayer>(graph, layer, descriptor);
+            break;
+        }
+        case LayerType::Reduce:
+        {
+            ReduceDescriptor descriptor = PolymorphicDowncast<const ReduceLayer*>(&layer)->GetParameters();
+            descriptor.m_vAxis = RemapAxes(descriptor.m_vAxis, permutation);
+            ReplaceWithDescriptor<ReduceLayer>(graph, layer, descriptor);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/// Runs the region on the tensors before the transposes by the permutation: cancels or moves the transposes on its
+/// boundary, permutes its constant inputs, transposes its tensor infos and remaps the axes of its layers.
+inline void ApplyRegion(Graph& graph,
+                        const LayoutRegion& region,
+                        const PermutationVector& permutation,
+                        const PermutationVector& inverse)
+{
+    std::vector<TensorInfo> newInfos;
+    for (Layer* layer : region.m_Layers)
+    {
+        newInfos.push_back(armnnUtils::TransposeTensorShape(layer->GetOutputSlot(0).GetTensorInfo(), inverse));
+    }
+    std::set<Layer*> bypassed;
+
+    // Outputs either skip a Transpose by the inverse permutation or get a Transpose by the permutation.
+    for (InputSlot* output : region.m_Outputs)
+    {
+        OutputSlot& source = *output->GetConnectedOutputSlot();
+        Layer& consumer = output->GetOwningLayer();
+        if (IsTransposeWith(consumer, inverse))
+        {
+            const TensorInfo info = source.GetTensorInfo();
+            consumer.GetOutputSlot(0).MoveAllConnections(source);
+            source.SetTensorInfo(info);
+            source.Disconnect(*output);
+            bypassed.insert(&consumer);
+        }
+        else
+        {
+            const TensorInfo info = source.GetTensorInfo();
+            const std::string name = std::string("layout-") + source.GetOwningLayer().GetName();
+            auto transpose = graph.InsertNewLayer<TransposeLayer>(*output, TransposeDescriptor(permutation),
+                                                                  name.c_str());
+            transpose->GetOutputSlot(0).SetTensorInfo(info);
+        }
+    }
+
+    // Inputs either skip a Transpose by the permutation, read a permuted copy of a constant or get a Transpose by the
+    // inverse permutation.
+    std::map<const OutputSlot*, ConstantLayer*> permutedConstants;
+    for (InputSlot* input : region.m_Inputs)
+    {
+        OutputSlot& source = *input->GetConnectedOutputSlot();
+        Layer& producer = source.GetOwningLayer();
+        if (IsTransposeWith(producer, permutation))
+        {
+            source.Disconnect(*input);
+            producer.GetInputSlot(0).GetConnectedOutputSlot()->Connect(*input);
+            bypassed.insert(&producer);
+        }
+        else if (producer.GetType() == LayerType::Constant)
+        {
+            ConstantLayer*& permutedConstant = permutedConstants[&source];
+            if (!permutedConstant)
+            {
+                const auto& constant = PolymorphicDowncast<ConstantLayer*>(&producer)->m_LayerOutput;
+                const TensorInfo& info = constant->GetTensorInfo();
+                std::vector<uint8_t> permuted(info.GetNumBytes());
+                armnnUtils::Transpose(info.GetShape(), inverse, constant->Map(true), permuted.data(),
+                                      GetDataTypeSize(info.GetDataType()));
+                constant->Unmap();
+
+                const TensorInfo permutedInfo = armnnUtils::TransposeTensorShape(info, inverse);
+                const std::string name = std::string("layout-") + producer.GetName();
+                permutedConstant = graph.AddLayer<ConstantLayer>(name.c_str());
+                permutedConstant->m_LayerOutput =
+                    std::make_shared<ScopedTensorHandle>(ConstTensor(permutedInfo, permuted.data()));
+                permutedConstant->GetOutputSlot(0).SetTensorInfo(permutedInfo);
+            }
+            source.Disconnect(*input);
+            permutedConstant->GetOutputSlot(0).Connect(*input);
+            bypassed.insert(&producer);
+        }
+        else
+        {
+            const TensorInfo info = armnnUtils::TransposeTensorShape(source.GetTensorInfo(), inverse);
+            const std::string name = std::string("layout-") + producer.GetName();
+            auto transpose = graph.InsertNewLayer<TransposeLayer>(*input, TransposeDescriptor(inverse), name.c_str());
+            transpose->GetOutputSlot(0).SetTensorInfo(info);
+        }
+    }
+
+    for (size_t i = 0; i < region.m_Layers.size(); ++i)
+    {
+        region.m_Layers[i]->GetOutputSlot(0).SetTensorInfo(newInfos[i]);
+        RemapDescriptor(graph, *region.m_Layers[i], permutation, inverse);
+    }
+
+    for (Layer* layer : bypassed)
+    {
+        if (layer->IsOutputUnconnected())
+        {
+            graph.EraseLayer(layer);
+        }
+    }
+}
+
+} // namespace layout
+
+/// Moves Transposes through regions of layout agnostic layers, such as activations, elementwise operations and
+/// concatenations, so that whole regions run in the layout of the tensors before the Transposes. Rather than looking at
+/// one connection at a time, like MoveTransposeUp and OptimizeInverseTransposes, the Transposes on the whole boundary
+/// of a region are weighed: a region is only rewritten if the volume of the Transposes it removes exceeds the volume of
+/// those it inserts. Returns the number of regions rewritten.
+inline unsigned int PropagateDataLayouts(Graph& graph)
+{
+    unsigned int numRegions = 0;
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (Layer* layer : graph.TopologicalSort())
+        {
+            if (layer->GetType() != LayerType::Transpose)
+            {
+                continue;
+            }
+            auto transpose = PolymorphicDowncast<TransposeLayer*>(layer);
+            const PermutationVector permutation = transpose->GetPermutation();
+            const PermutationVector inverse = layout::GetInverse(permutation);
+
+            layout::LayoutRegion region;
+            if (layout::CollectRegion(*transpose, region) &&
+                layout::GetTransposeVolumeSaving(region, permutation, inverse) > 0)
+            {
+                // Every rewrite strictly reduces the transposed volume, so the search always ends.
+                layout::ApplyRegion(graph, region, permutation, inverse);
+                ++numRegions;
+                changed = true;
+                break;
+            }
+        }
+    }
+    return numRegions;
+}
+
+} // namespace optimizations
+} // namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2023,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include <GraphUtils.hpp>
@@ -71,6 +71,124 @@ TEST_CASE("TopologicalSort")
     CHECK(CheckOrder(graph, layerB, layerC));
 }
 
+TEST_CASE("TopologicalSortVeryDeepGraph")
+{
+    // Deep enough to overflow the stack if the sort recursed through the producers of each layer.
+    const unsigned int numLayers = 200000;
+    armnn::Graph graph;
+
+    // Adds the chain from the output backwards, so that the sort has to reverse it.
+    armnn::Layer* consumer = graph.AddLayer<armnn::OutputLayer>(0, "output");
+    std::vector<armnn::Layer*> chain;
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        armnn::Layer* layer = graph.AddLayer<armnn::ActivationLayer>(armnn::ActivationDescriptor(), "");
+        layer->GetOutputSlot(0).Connect(consumer->GetInputSlot(0));
+        chain.push_back(layer);
+        consumer = layer;
+    }
+    graph.AddLayer<armnn::InputLayer>(0, "input")->GetOutputSlot(0).Connect(consumer->GetInputSlot(0));
+
+    auto it = graph.TopologicalSort().begin();
+    CHECK((*it)->GetType() == armnn::LayerType::Input);
+    for (auto layer = chain.rbegin(); layer != chain.rend(); ++layer)
+    {
+        CHECK(*(++it) == *layer);
+    }
+    CHECK((*(++it))->GetType() == armnn::LayerType::Output);
+
+    // The priorities of layers can also be computed on their own.
+    for (armnn::Layer* layer : graph)
+    {
+        layer->ResetPriority();
+    }
+    CHECK(chain.front()->GetPriority() == numLayers);
+}
+
+TEST_CASE("TopologicalSortThrowsOnCycle")
+{
+    armnn::Graph graph;
+    armnn::Layer* const input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    armnn::Layer* const add = graph.AddLayer<armnn::ElementwiseBinaryLayer>(armnn::BinaryOperation::Add, "add");
+    armnn::Layer* const activation = graph.AddLayer<armnn::ActivationLayer>(armnn::ActivationDescriptor(), "act");
+
+    input->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    add->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+
+    CHECK_THROWS_AS(graph.TopologicalSort(), armnn::GraphValidationException);
+    CHECK_THROWS_AS(activation->GetPriority(), armnn::GraphValidationException);
+
+    // Breaks the cycle so that the graph can be destroyed.
+    activation->GetOutputSlot(0).Disconnect(add->GetInputSlot(1));
+}
+
+TEST_CASE("MemoryAwareTopologicalSort")
+{
+    armnn::Graph graph;
+    const armnn::TensorInfo smallInfo({ 1, 4 }, armnn::DataType::Float32);
+    const armnn::TensorInfo largeInfo({ 1, 400 }, armnn::DataType::Float32);
+
+    // Two branches each grow the input into a large tensor and shrink it back before they are added.
+    //      input
+    //     /     \'
+    //   A1       B1   (large)
+    //   |        |
+    //   A2       B2   (small)
+    //     \     /
+    //       add
+    armnn::Layer* const input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    armnn::Layer* const add = graph.AddLayer<armnn::ElementwiseBinaryLayer>(armnn::BinaryOperation::Add, "add");
+    armnn::Layer* const output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+    input->GetOutputSlot(0).SetTensorInfo(smallInfo);
+    add->GetOutputSlot(0).SetTensorInfo(smallInfo);
+    add->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    std::vector<armnn::Layer*> branches[2];
+    for (unsigned int branch = 0; branch < 2; ++branch)
+    {
+        const std::string name = branch == 0 ? "A" : "B";
+        armnn::Layer* const grow = graph.AddLayer<armnn::ActivationLayer>(armnn::ActivationDescriptor(),
+                                                                          (name + "1").c_str());
+        armnn::Layer* const shrink = graph.AddLayer<armnn::ActivationLayer>(armnn::ActivationDescriptor(),
+                                                                            (name + "2").c_str());
+        input->GetOutputSlot(0).Connect(grow->GetInputSlot(0));
+        grow->GetOutputSlot(0).Connect(shrink->GetInputSlot(0));
+        shrink->GetOutputSlot(0).Connect(add->GetInputSlot(branch));
+        grow->GetOutputSlot(0).SetTensorInfo(largeInfo);
+        shrink->GetOutputSlot(0).SetTensorInfo(smallInfo);
+        branches[branch] = { grow, shrink };
+    }
+
+    // By default both large tensors are alive at the same time
+    const armnn::BackendId backendId = input->GetBackendId();
+    const size_t largeBytes = largeInfo.GetNumBytes();
+    const size_t smallBytes = smallInfo.GetNumBytes();
+    CHECK(graph.TopologicalSort().GetPeakTensorMemory()[backendId] == smallBytes + 2 * largeBytes);
+
+    // Finishing a branch before starting the other only keeps one
+    graph.MemoryAwareTopologicalSort();
+    CHECK(graph.GetPeakTensorMemory()[backendId] == 2 * smallBytes + largeBytes);
+    CHECK(CheckOrder(graph, branches[0][0], branches[0][1]));
+    CHECK(CheckOrder(graph, branches[0][1], branches[1][0]));
+    CHECK(CheckOrder(graph, branches[1][0], branches[1][1]));
+    CHECK(CheckOrder(graph, branches[1][1], add));
+    std::vector<armnn::Layer*> order;
+    for (armnn::Layer* layer : graph)
+    {
+        order.push_back(layer);
+    }
+    CHECK(order.front() == input);
+    CHECK(order.back() == output);
+    CHECK(branches[0][1]->GetPriority() < branches[1][0]->GetPriority());
+
+    // The order is kept by the next topological sorts, and is not changed again when it cannot be improved
+    graph.TopologicalSort();
+    CHECK(CheckOrder(graph, branches[0][1], branches[1][0]));
+    graph.MemoryAwareTopologicalSort();
+    CHECK(CheckOrder(graph, branches[0][1], branches[1][0]));
+}
+
 TEST_CASE("InsertNewLayerBefore")
 {
     armnn::Graph graph;
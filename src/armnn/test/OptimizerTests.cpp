@@ -1,5 +1,5 @@
 //
-// Copyright © 2017,2022-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017,2022-2024,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -993,4 +993,38 @@ TEST_CASE("OptimizeForExclusiveConnectionsWithoutFuseTest")
                         &IsLayerOfType<armnn::OutputLayer>,
                         &IsLayerOfType<armnn::OutputLayer>));
 }
+
+// Tests that a single pass follows the layers an optimization inserts upstream, moving a Transpose from the end of a
+// long chain of activations to its input.
+TEST_CASE("OptimizerPassVisitsLayersAddedUpstream")
+{
+    const TensorInfo info({ 1, 5, 2, 3 }, DataType::Float32);
+    const TensorInfo transposed({ 1, 3, 5, 2 }, DataType::Float32);
+    const unsigned int numActivations = 1000;
+
+    Graph graph;
+    Layer* head = graph.AddLayer<OutputLayer>(0, "output");
+    head = graph.InsertNewLayer<TransposeLayer>(head->GetInputSlot(0), TransposeDescriptor({ 0, 3, 1, 2 }), "");
+    head->GetOutputHandler().SetTensorInfo(transposed);
+    for (unsigned int i = 0; i < numActivations; ++i)
+    {
+        head = graph.InsertNewLayer<ActivationLayer>(head->GetInputSlot(0), ActivationDescriptor{}, "");
+        head->GetOutputHandler().SetTensorInfo(info);
+    }
+    graph.InsertNewLayer<InputLayer>(head->GetInputSlot(0), 0, "")->GetOutputHandler().SetTensorInfo(info);
+
+    Optimizer::Pass(graph, MakeOptimizations(MoveTransposeUp()));
+
+    CHECK(graph.GetNumLayers() == numActivations + 3);
+    auto it = graph.TopologicalSort().begin();
+    CHECK(IsLayerOfType<InputLayer>(*it));
+    CHECK(IsLayerOfType<TransposeLayer>(*(++it)));
+    for (unsigned int i = 0; i < numActivations; ++i)
+    {
+        const Layer* activation = *(++it);
+        CHECK(IsLayerOfType<ActivationLayer>(activation));
+        CHECK(activation->GetOutputSlot(0).GetTensorInfo() == transposed);
+    }
+    CHECK(IsLayerOfType<OutputLayer>(*(++it)));
+}
 } // Optimizer TestSuite
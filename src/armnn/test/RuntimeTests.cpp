@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -26,6 +26,8 @@
 #include "RuntimeTests.hpp"
 #include <TestUtils.hpp>
 
+#include <sstream>
+
 #ifdef ARMNN_LEAK_CHECKING_ENABLED
 #include <HeapProfiling.hpp>
 #include <LeakChecking.hpp>
@@ -39,6 +41,11 @@ void RuntimeLoadedNetworksReserve(armnn::RuntimeImpl* runtime)
     runtime->m_LoadedNetworks.reserve(1);
 }
 
+const ConstantTensorCache& GetConstantTensorCache(RuntimeImpl* runtime)
+{
+    return runtime->m_ConstantTensorCache;
+}
+
 } // namespace armnn
 
 TEST_SUITE("Runtime")
@@ -1277,4 +1284,396 @@ TEST_CASE("SyncExecutePreImportInputsHappyPath")
                                         std::vector<ImportedOutputId>());
     REQUIRE(ret == Status::Success);
 }
+
+TEST_CASE("RuntimeMemoryStatisticsCpuRef")
+{
+    // input -> add (with a constant) -> output
+    // The add computes its output in place of the input, so a single tensor is alive at any time.
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+    armnn::INetworkPtr testNetwork(armnn::INetwork::Create());
+
+    TensorInfo tensorInfo{ { 4 }, armnn::DataType::Float32 };
+    TensorInfo constantInfo{ { 4 }, armnn::DataType::Float32, 0.0f, 0, true };
+    std::vector<float> constantData(4, 1.0f);
+
+    auto inputLayer    = testNetwork->AddInputLayer(0, "input");
+    auto constantLayer = testNetwork->AddConstantLayer(ConstTensor(constantInfo, constantData), "constant");
+    auto addLayer      = testNetwork->AddElementwiseBinaryLayer(BinaryOperation::Add, "add");
+    auto outputLayer   = testNetwork->AddOutputLayer(0, "output");
+
+    inputLayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(0));
+    constantLayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(1));
+    addLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+
+    inputLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    constantLayer->GetOutputSlot(0).SetTensorInfo(constantInfo);
+    addLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+
+    // An unknown network has no statistics
+    CHECK(runtime->GetMemoryStatistics(42).empty());
+
+    armnn::NetworkId networkId;
+    std::string er;
+    armnn::INetworkProperties networkProperties(MemorySource::Undefined, MemorySource::Undefined);
+    CHECK(runtime->LoadNetwork(networkId, Optimize(*testNetwork, backends, runtime->GetDeviceSpec()), er,
+                               networkProperties) == Status::Success);
+
+    std::map<BackendId, MemoryStatistics> statistics = runtime->GetMemoryStatistics(networkId);
+    REQUIRE(statistics.size() == 1);
+    const MemoryStatistics& refStatistics = statistics[armnn::Compute::CpuRef];
+    CHECK(refStatistics.m_ConstantBytes == constantInfo.GetNumBytes());
+    CHECK(refStatistics.m_MinimumWorkingMemoryBytes == tensorInfo.GetNumBytes());
+    CHECK(refStatistics.m_WorkingMemoryBytes >= refStatistics.m_MinimumWorkingMemoryBytes);
+    CHECK(refStatistics.m_ImportedBytes == 0);
+
+    std::vector<float> inputData(4, 2.0f);
+    ConstTensor inputTensor({ { 4 }, armnn::DataType::Float32, 0.0f, 0, true }, inputData.data());
+    std::vector<ImportedInputId> importedInputs =
+        runtime->ImportInputs(networkId, { { 0, inputTensor } }, MemorySource::Malloc);
+    REQUIRE(importedInputs.size() == 1);
+    CHECK(runtime->GetMemoryStatistics(networkId)[armnn::Compute::CpuRef].m_ImportedBytes ==
+          tensorInfo.GetNumBytes());
+}
+
+TEST_CASE("RuntimeMemoryStatisticsExternalMemoryCpuRef")
+{
+    // input -> relu -> output, with the working memory planned by the memory optimizer strategies
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+    armnn::INetworkPtr testNetwork(armnn::INetwork::Create());
+
+    TensorInfo tensorInfo{ { 4 }, armnn::DataType::Float32 };
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+
+    auto inputLayer  = testNetwork->AddInputLayer(0, "input");
+    auto reluLayer   = testNetwork->AddActivationLayer(reluDescriptor, "relu");
+    auto outputLayer = testNetwork->AddOutputLayer(0, "output");
+
+    inputLayer->GetOutputSlot(0).Connect(reluLayer->GetInputSlot(0));
+    reluLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+    inputLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    reluLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+
+    armnn::NetworkId networkId;
+    std::string er;
+    armnn::INetworkProperties networkProperties(MemorySource::Undefined, MemorySource::Undefined, false,
+                                                ProfilingDetailsMethod::Undefined, true);
+    CHECK(runtime->LoadNetwork(networkId, Optimize(*testNetwork, backends, runtime->GetDeviceSpec()), er,
+                               networkProperties) == Status::Success);
+
+    std::map<BackendId, MemoryStatistics> statistics = runtime->GetMemoryStatistics(networkId);
+    REQUIRE(statistics.size() == 1);
+    const MemoryStatistics& refStatistics = statistics[armnn::Compute::CpuRef];
+    CHECK(refStatistics.m_ConstantBytes == 0);
+    CHECK(refStatistics.m_MinimumWorkingMemoryBytes == tensorInfo.GetNumBytes());
+    CHECK(refStatistics.m_WorkingMemoryBytes >= refStatistics.m_MinimumWorkingMemoryBytes);
+
+    // The planned memory blocks can be written out, to replay them in MemoryStrategyBenchmark
+    std::stringstream memoryProfile;
+    CHECK(runtime->SerializeMemoryProfile(networkId, memoryProfile) == Status::Success);
+    std::string backendId;
+    unsigned int startOfLife = 0;
+    unsigned int endOfLife = 0;
+    size_t memSize = 0;
+    unsigned int index = 0;
+    unsigned int numMemBlocks = 0;
+    while (memoryProfile >> backendId >> startOfLife >> endOfLife >> memSize >> index)
+    {
+        CHECK(backendId == "CpuRef");
+        CHECK(startOfLife <= endOfLife);
+        CHECK(memSize == tensorInfo.GetNumBytes());
+        ++numMemBlocks;
+    }
+    CHECK(numMemBlocks > 0);
+    CHECK(runtime->SerializeMemoryProfile(networkId + 1, memoryProfile) == Status::Failure);
+}
+
+TEST_CASE("RuntimeWorkingMemoryBudgetCpuRef")
+{
+    // Two branches pad the input to a large tensor, on either side, and slice it back, then their results are added:
+    //   input -> pad -> slice -> add -> output
+    //        \-> pad -> slice -/
+    // Running both pads first keeps both large tensors alive at the same time, finishing one branch before starting
+    // the other does not.
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+    armnn::INetworkPtr testNetwork(armnn::INetwork::Create());
+
+    TensorInfo tensorInfo{ { 1, 4 }, armnn::DataType::Float32 };
+    TensorInfo paddedInfo{ { 1, 400 }, armnn::DataType::Float32 };
+
+    auto inputLayer  = testNetwork->AddInputLayer(0, "input");
+    auto addLayer    = testNetwork->AddElementwiseBinaryLayer(BinaryOperation::Add, "add");
+    auto outputLayer = testNetwork->AddOutputLayer(0, "output");
+    for (unsigned int branch = 0; branch < 2; ++branch)
+    {
+        PadDescriptor padDescriptor({ { 0, 0 }, { 396 * branch, 396 * (1 - branch) } });
+        SliceDescriptor sliceDescriptor({ 0, 396 * branch }, { 1, 4 });
+        auto padLayer   = testNetwork->AddPadLayer(padDescriptor, ("pad" + std::to_string(branch)).c_str());
+        auto sliceLayer = testNetwork->AddSliceLayer(sliceDescriptor, ("slice" + std::to_string(branch)).c_str());
+        inputLayer->GetOutputSlot(0).Connect(padLayer->GetInputSlot(0));
+        padLayer->GetOutputSlot(0).Connect(sliceLayer->GetInputSlot(0));
+        sliceLayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(branch));
+        padLayer->GetOutputSlot(0).SetTensorInfo(paddedInfo);
+        sliceLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    }
+    addLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+    inputLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    addLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    auto LoadWithBudget = [&](size_t budget, armnn::NetworkId& networkId, std::string& er)
+    {
+        armnn::INetworkProperties networkProperties(MemorySource::Undefined, MemorySource::Undefined, false,
+                                                    ProfilingDetailsMethod::Undefined, false, budget);
+        return runtime->LoadNetwork(networkId, Optimize(*testNetwork, backends, runtime->GetDeviceSpec()), er,
+                                    networkProperties);
+    };
+
+    // Without a budget both large tensors are alive at the same time
+    armnn::NetworkId networkId;
+    std::string er;
+    REQUIRE(LoadWithBudget(0, networkId, er) == Status::Success);
+    const size_t defaultWorkingMemory = runtime->GetMemoryStatistics(networkId)[armnn::Compute::CpuRef]
+                                                .m_WorkingMemoryBytes;
+    CHECK(defaultWorkingMemory >= 2 * paddedInfo.GetNumBytes());
+
+    // Finishing one branch before starting the other fits in a smaller budget
+    const size_t budget = paddedInfo.GetNumBytes() + 2 * tensorInfo.GetNumBytes() + 256;
+    REQUIRE(budget < defaultWorkingMemory);
+    REQUIRE(LoadWithBudget(budget, networkId, er) == Status::Success);
+    CHECK(runtime->GetMemoryStatistics(networkId)[armnn::Compute::CpuRef].m_WorkingMemoryBytes <= budget);
+
+    std::vector<float> inputData{ 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> outputData(4);
+    TensorInfo inputTensorInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputTensorInfo.SetConstant(true);
+    InputTensors inputTensors{ { 0, ConstTensor(inputTensorInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>{ 2.0f, 4.0f, 6.0f, 8.0f });
+
+    // No execution order fits in less than one large tensor
+    CHECK(LoadWithBudget(paddedInfo.GetNumBytes(), networkId, er) == Status::Failure);
+    CHECK(er.find("exceeds the budget") != std::string::npos);
+}
+
+TEST_CASE("ConstantTensorCacheSharesEqualTensors")
+{
+    using namespace armnn;
+    ConstantTensorCache cache;
+
+    TensorInfo info({ 2, 2 }, DataType::Float32, 0.0f, 0, true);
+    TensorInfo reshapedInfo({ 4 }, DataType::Float32, 0.0f, 0, true);
+    std::vector<float> data{ 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<float> otherData{ 1.0f, 2.0f, 3.0f, 5.0f };
+
+    auto tensor = std::make_shared<ScopedTensorHandle>(ConstTensor(info, data));
+    auto equalTensor = std::make_shared<ScopedTensorHandle>(ConstTensor(info, data));
+    auto otherTensor = std::make_shared<ScopedTensorHandle>(ConstTensor(info, otherData));
+    auto reshapedTensor = std::make_shared<ScopedTensorHandle>(ConstTensor(reshapedInfo, data));
+
+    CHECK(cache.Share(tensor) == tensor);
+    CHECK(cache.Share(equalTensor) == tensor);
+    CHECK(cache.Share(otherTensor) == otherTensor);
+    CHECK(cache.Share(reshapedTensor) == reshapedTensor);
+    CHECK(cache.GetNumTensors() == 3);
+    CHECK(cache.GetNumBytes() == 3 * info.GetNumBytes());
+
+    // Tensors nobody uses anymore are forgotten
+    otherTensor.reset();
+    CHECK(cache.GetNumTensors() == 2);
+    equalTensor = std::make_shared<ScopedTensorHandle>(ConstTensor(info, data));
+    tensor.reset();
+    CHECK(cache.Share(equalTensor) == equalTensor);
+    CHECK(cache.GetNumTensors() == 2);
+}
+
+TEST_CASE("RuntimeSharesConstantsBetweenNetworksCpuRef")
+{
+    using namespace armnn;
+
+    // input -> add (with a constant) -> output, built twice like a model loaded for two tenants
+    TensorInfo tensorInfo{ { 4 }, DataType::Float32 };
+    TensorInfo constantInfo{ { 4 }, DataType::Float32, 0.0f, 0, true };
+    std::vector<float> constantData{ 10.0f, 20.0f, 30.0f, 40.0f };
+    auto CreateNetwork = [&]()
+    {
+        INetworkPtr network(INetwork::Create());
+        auto inputLayer    = network->AddInputLayer(0, "input");
+        auto constantLayer = network->AddConstantLayer(ConstTensor(constantInfo, constantData), "constant");
+        auto addLayer      = network->AddElementwiseBinaryLayer(BinaryOperation::Add, "add");
+        auto outputLayer   = network->AddOutputLayer(0, "output");
+        inputLayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(0));
+        constantLayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(1));
+        addLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+        inputLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        constantLayer->GetOutputSlot(0).SetTensorInfo(constantInfo);
+        addLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        return network;
+    };
+
+    IRuntime::CreationOptions options;
+    RuntimeImpl runtime(options);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    NetworkId networkIds[2];
+    for (NetworkId& networkId : networkIds)
+    {
+        INetworkPtr network = CreateNetwork();
+        REQUIRE(runtime.LoadNetwork(networkId, Optimize(*network, backends, runtime.GetDeviceSpec())) ==
+                Status::Success);
+    }
+    CHECK(GetConstantTensorCache(&runtime).GetNumTensors() == 1);
+    CHECK(GetConstantTensorCache(&runtime).GetNumBytes() == constantInfo.GetNumBytes());
+
+    // Both networks, run twice, read the shared constant
+    std::vector<float> inputData{ 1.0f, 2.0f, 3.0f, 4.0f };
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        for (NetworkId networkId : networkIds)
+        {
+            std::vector<float> outputData(4);
+            TensorInfo inputTensorInfo = runtime.GetInputTensorInfo(networkId, 0);
+            inputTensorInfo.SetConstant(true);
+            InputTensors inputTensors{ { 0, ConstTensor(inputTensorInfo, inputData.data()) } };
+            OutputTensors outputTensors{ { 0, Tensor(runtime.GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+            CHECK(runtime.EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+            CHECK(outputData == std::vector<float>{ 11.0f, 22.0f, 33.0f, 44.0f });
+        }
+    }
+
+    // The constant is freed with the last network using it
+    CHECK(runtime.UnloadNetwork(networkIds[0]) == Status::Success);
+    CHECK(GetConstantTensorCache(&runtime).GetNumTensors() == 1);
+    CHECK(runtime.UnloadNetwork(networkIds[1]) == Status::Success);
+    CHECK(GetConstantTensorCache(&runtime).GetNumTensors() == 0);
+}
+
+TEST_CASE("RuntimeStateTensorsCpuRef")
+{
+    using namespace armnn;
+
+    // state' = state + input, output = state * input, with the state kept by the network between executions
+    TensorInfo tensorInfo{ { 4 }, DataType::Float32 };
+    INetworkPtr network(INetwork::Create());
+    auto stateInputLayer  = network->AddInputLayer(0, "stateInput");
+    auto inputLayer       = network->AddInputLayer(1, "input");
+    auto addLayer         = network->AddElementwiseBinaryLayer(BinaryOperation::Add, "add");
+    auto mulLayer         = network->AddElementwiseBinaryLayer(BinaryOperation::Mul, "mul");
+    auto stateOutputLayer = network->AddOutputLayer(0, "stateOutput");
+    auto outputLayer      = network->AddOutputLayer(1, "output");
+    stateInputLayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(0));
+    inputLayer->GetOutputSlot(0).Connect(addLayer->GetInputSlot(1));
+    stateInputLayer->GetOutputSlot(0).Connect(mulLayer->GetInputSlot(0));
+    inputLayer->GetOutputSlot(0).Connect(mulLayer->GetInputSlot(1));
+    addLayer->GetOutputSlot(0).Connect(stateOutputLayer->GetInputSlot(0));
+    mulLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+    stateInputLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    inputLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    addLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    mulLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId networkId;
+    REQUIRE(runtime->LoadNetwork(networkId, Optimize(*network, backends, runtime->GetDeviceSpec())) ==
+            Status::Success);
+    runtime->AddStateTensor(networkId, 0, 0);
+    CHECK_THROWS_AS(runtime->AddStateTensor(networkId, 1, 0), armnn::InvalidArgumentException);
+
+    std::vector<float> inputData{ 1.0f, 2.0f, 3.0f, 4.0f };
+    TensorInfo inputTensorInfo = runtime->GetInputTensorInfo(networkId, 1);
+    inputTensorInfo.SetConstant(true);
+    std::vector<float> outputData(4);
+    InputTensors inputTensors{ { 1, ConstTensor(inputTensorInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 1, Tensor(runtime->GetOutputTensorInfo(networkId, 1), outputData.data()) } };
+
+    // The state starts as zeros and accumulates the input
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>{ 0.0f, 0.0f, 0.0f, 0.0f });
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>{ 1.0f, 4.0f, 9.0f, 16.0f });
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>{ 2.0f, 8.0f, 18.0f, 32.0f });
+
+    std::vector<float> snapshot(4);
+    runtime->GetStateTensor(networkId, 0, Tensor(tensorInfo, snapshot.data()));
+    CHECK(snapshot == std::vector<float>{ 3.0f, 6.0f, 9.0f, 12.0f });
+
+    runtime->ResetStateTensors(networkId);
+    std::vector<float> state(4, -1.0f);
+    runtime->GetStateTensor(networkId, 0, Tensor(tensorInfo, state.data()));
+    CHECK(state == std::vector<float>{ 0.0f, 0.0f, 0.0f, 0.0f });
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>{ 0.0f, 0.0f, 0.0f, 0.0f });
+
+    TensorInfo snapshotInfo = tensorInfo;
+    snapshotInfo.SetConstant(true);
+    runtime->SetStateTensor(networkId, 0, ConstTensor(snapshotInfo, snapshot.data()));
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>{ 3.0f, 12.0f, 27.0f, 48.0f });
+    runtime->GetStateTensor(networkId, 0, Tensor(tensorInfo, state.data()));
+    CHECK(state == std::vector<float>{ 4.0f, 8.0f, 12.0f, 16.0f });
+
+    // The state is not given to EnqueueWorkload
+    InputTensors stateInputTensors{ { 0, ConstTensor(snapshotInfo, snapshot.data()) },
+                                    { 1, ConstTensor(inputTensorInfo, inputData.data()) } };
+    CHECK_THROWS_AS(runtime->EnqueueWorkload(networkId, stateInputTensors, outputTensors),
+                    armnn::InvalidArgumentException);
+    CHECK_THROWS_AS(runtime->GetStateTensor(networkId, 1, Tensor(tensorInfo, state.data())),
+                    armnn::InvalidArgumentException);
+}
+
+TEST_CASE("RuntimeWarmUpOnLoadCpuRef")
+{
+    using namespace armnn;
+
+    // input -> relu -> output, with its working memory allocated and two inferences run by LoadNetwork
+    TensorInfo tensorInfo{ { 4 }, DataType::Float32 };
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+
+    INetworkPtr network(INetwork::Create());
+    auto inputLayer  = network->AddInputLayer(0, "input");
+    auto reluLayer   = network->AddActivationLayer(reluDescriptor, "relu");
+    auto outputLayer = network->AddOutputLayer(0, "output");
+    inputLayer->GetOutputSlot(0).Connect(reluLayer->GetInputSlot(0));
+    reluLayer->GetOutputSlot(0).Connect(outputLayer->GetInputSlot(0));
+    inputLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    reluLayer->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId networkId;
+    std::string errorMessage;
+    INetworkProperties networkProperties(MemorySource::Undefined, MemorySource::Undefined, true,
+                                         ProfilingDetailsMethod::Undefined, false, 0, true, 2);
+    REQUIRE(runtime->LoadNetwork(networkId, Optimize(*network, backends, runtime->GetDeviceSpec()), errorMessage,
+                                 networkProperties) == Status::Success);
+
+    // The cold and warm-up inferences are reported apart
+    std::stringstream profile;
+    runtime->GetProfiler(networkId)->Print(profile);
+    CHECK(profile.str().find("LoadNetwork_AllocateWorkingMemory") != std::string::npos);
+    CHECK(profile.str().find("LoadNetwork_ColdInference") != std::string::npos);
+    CHECK(profile.str().find("LoadNetwork_WarmUpInference") != std::string::npos);
+
+    std::vector<float> inputData{ -1.0f, 2.0f, -3.0f, 4.0f };
+    std::vector<float> outputData(4);
+    TensorInfo inputTensorInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputTensorInfo.SetConstant(true);
+    InputTensors inputTensors{ { 0, ConstTensor(inputTensorInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+    CHECK(outputData == std::vector<float>{ 0.0f, 2.0f, 0.0f, 4.0f });
+}
 }
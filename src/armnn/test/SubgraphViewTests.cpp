@@ -1538,6 +1538,50 @@ TEST_CASE("Random")
     }
 }
 
+TEST_CASE("AlternatingSelection")
+{
+    // A long chain with a residual connection every few layers, where every other layer is selected, as when the
+    // layers of a graph alternate between two backends. Every selected layer ends up in a subgraph of its own, so the
+    // number of subgraphs grows with the size of the graph, which used to make the selection quadratic.
+    constexpr unsigned int numLayers = 20000;
+
+    Graph graph;
+    Layer* previous = graph.AddLayer<InputLayer>(0, "input");
+    Layer* residual = previous;
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        const std::string name = (i % 2 == 0 ? "s" : "n") + std::to_string(i);
+        Layer* layer = nullptr;
+        if (i % 4 == 3)
+        {
+            layer = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add),
+                                                           name.c_str());
+            residual->GetOutputSlot(0).Connect(layer->GetInputSlot(1));
+            residual = layer;
+        }
+        else
+        {
+            layer = graph.AddLayer<ActivationLayer>(ActivationDescriptor{}, name.c_str());
+        }
+        previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+        previous = layer;
+    }
+    previous->GetOutputSlot(0).Connect(graph.AddLayer<OutputLayer>(0, "output")->GetInputSlot(0));
+
+    SubgraphViewSelector::Subgraphs subgraphs =
+        SubgraphViewSelector::SelectSubgraphs(graph, [](const Layer& l) { return l.GetName()[0] == 's'; });
+
+    CHECK(subgraphs.size() == numLayers / 2);
+    for (auto& subgraph : subgraphs)
+    {
+        CHECK(subgraph->GetIConnectableLayers().size() == 1);
+    }
+    // The subgraphs are in the order of their layers
+    CHECK(std::string(subgraphs.front()->GetIConnectableLayers().front()->GetName()) == "s0");
+    CHECK(std::string(subgraphs.back()->GetIConnectableLayers().front()->GetName()) ==
+          "s" + std::to_string(numLayers - 2));
+}
+
 }
 
 TEST_SUITE("IntegrationTests")
@@ -13,6 +13,7 @@
 #include <armnnUtils/Permute.hpp>
 #include <GraphTopologicalSort.hpp>
 #include <Graph.hpp>
+#include <LayerSupportCache.hpp>
 #include <ResolveType.hpp>
 
 TEST_SUITE("Utils")
@@ -295,6 +296,73 @@ TEST_CASE("LayerSupportHandle")
 
     CHECK(layerSupportObject.IsBackendRegistered());
 }
+
+TEST_CASE("LayerSupportHandleWithCache")
+{
+    auto uncached = armnn::GetILayerSupportByBackendId("CpuRef");
+    auto cached = armnn::GetILayerSupportByBackendId("CpuRef");
+    cached.EnableCache();
+
+    armnn::TensorInfo float32({ 1, 4 }, armnn::DataType::Float32);
+    armnn::TensorInfo signed64({ 1, 4 }, armnn::DataType::Signed64);
+    armnn::ActivationDescriptor descriptor;
+    descriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        std::string expectedReason;
+        std::string reason;
+        CHECK(cached.IsActivationSupported(float32, float32, descriptor, reason) ==
+              uncached.IsActivationSupported(float32, float32, descriptor, expectedReason));
+        CHECK(reason == expectedReason);
+
+        expectedReason.clear();
+        reason.clear();
+        CHECK(!cached.IsActivationSupported(signed64, signed64, descriptor, reason));
+        CHECK(!uncached.IsActivationSupported(signed64, signed64, descriptor, expectedReason));
+        CHECK(!reason.empty());
+        CHECK(reason == expectedReason);
+    }
+}
 #endif
 
+TEST_CASE("LayerSupportCacheReusesAnswers")
+{
+    armnn::LayerSupportCache cache;
+    unsigned int numQueries = 0;
+    auto query = [&numQueries](armnn::Optional<std::string&> reason)
+    {
+        ++numQueries;
+        reason.value() = "unsupported";
+        return false;
+    };
+
+    armnn::TensorInfo info({ 2, 3 }, armnn::DataType::QAsymmU8, 0.5f, 1);
+    armnn::SoftmaxDescriptor descriptor;
+
+    std::string reason;
+    CHECK(!cache.IsLayerSupported(armnn::LayerType::Softmax, { info, info }, descriptor, reason, query));
+    CHECK(reason == "unsupported");
+    reason.clear();
+    CHECK(!cache.IsLayerSupported(armnn::LayerType::Softmax, { info, info }, descriptor, reason, query));
+    CHECK(reason == "unsupported");
+    CHECK(numQueries == 1);
+    CHECK(cache.GetNumEntries() == 1);
+    CHECK(cache.GetNumHits() == 1);
+
+    // A different descriptor, quantization, layer type or missing reason must not be answered from another entry.
+    armnn::SoftmaxDescriptor otherDescriptor;
+    otherDescriptor.m_Beta = 2.0f;
+    CHECK(!cache.IsLayerSupported(armnn::LayerType::Softmax, { info, info }, otherDescriptor, reason, query));
+    armnn::TensorInfo otherInfo({ 2, 3 }, armnn::DataType::QAsymmU8, 0.25f, 1);
+    CHECK(!cache.IsLayerSupported(armnn::LayerType::Softmax, { otherInfo, info }, descriptor, reason, query));
+    CHECK(!cache.IsLayerSupported(armnn::LayerType::LogSoftmax, { info, info }, descriptor, reason, query));
+    CHECK(numQueries == 4);
+    CHECK(!cache.IsLayerSupported(armnn::LayerType::Softmax, { info, info }, descriptor,
+                                  armnn::EmptyOptional(), query));
+    CHECK(numQueries == 4);
+    CHECK(cache.GetNumEntries() == 4);
+    CHECK(cache.GetNumHits() == 2);
+}
+
 }
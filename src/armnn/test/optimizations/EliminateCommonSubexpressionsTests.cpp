@@ -0,0 +1,138 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayersFwd.hpp"
+
+#include <Graph.hpp>
+#include <Optimizer.hpp>
+#include <TestUtils.hpp>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+ActivationLayer* AddActivation(Graph& graph, ActivationFunction function, const TensorInfo& info, const char* name)
+{
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = function;
+    ActivationLayer* activation = graph.AddLayer<ActivationLayer>(descriptor, name);
+    activation->GetOutputSlot().SetTensorInfo(info);
+    return activation;
+}
+
+} // anonymous namespace
+
+TEST_CASE("EliminateCommonSubexpressionsMergesDuplicateChains")
+{
+    // input -> relu0 -> sigmoid0 -> add -> output
+    //       -> relu1 -> sigmoid1 ->
+    Graph graph;
+    const TensorInfo info({ 1, 2, 2, 3 }, DataType::Float32);
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    ActivationLayer* relu0    = AddActivation(graph, ActivationFunction::ReLu, info, "relu0");
+    ActivationLayer* relu1    = AddActivation(graph, ActivationFunction::ReLu, info, "relu1");
+    ActivationLayer* sigmoid0 = AddActivation(graph, ActivationFunction::Sigmoid, info, "sigmoid0");
+    ActivationLayer* sigmoid1 = AddActivation(graph, ActivationFunction::Sigmoid, info, "sigmoid1");
+
+    auto add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add");
+    add->GetOutputSlot().SetTensorInfo(info);
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(relu0->GetInputSlot(0));
+    input->GetOutputSlot().Connect(relu1->GetInputSlot(0));
+    relu0->GetOutputSlot().Connect(sigmoid0->GetInputSlot(0));
+    relu1->GetOutputSlot().Connect(sigmoid1->GetInputSlot(0));
+    sigmoid0->GetOutputSlot().Connect(add->GetInputSlot(0));
+    sigmoid1->GetOutputSlot().Connect(add->GetInputSlot(1));
+    add->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    CHECK(EliminateCommonSubexpressions(graph) == 2);
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<ActivationLayer>,
+                        &IsLayerOfType<ActivationLayer>,
+                        &IsLayerOfType<ElementwiseBinaryLayer>,
+                        &IsLayerOfType<OutputLayer>));
+    CHECK(add->GetInputSlot(0).GetConnectedOutputSlot() == add->GetInputSlot(1).GetConnectedOutputSlot());
+}
+
+TEST_CASE("EliminateCommonSubexpressionsKeepsDifferentLayers")
+{
+    Graph graph;
+    const TensorInfo info({ 1, 2, 2, 3 }, DataType::Float32);
+    const TensorInfo otherInfo({ 1, 2, 2, 3 }, DataType::Float32, 0.5f, 1);
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    // Different descriptor, and the same descriptor with a different output tensor info.
+    ActivationLayer* relu      = AddActivation(graph, ActivationFunction::ReLu, info, "relu");
+    ActivationLayer* sigmoid   = AddActivation(graph, ActivationFunction::Sigmoid, info, "sigmoid");
+    ActivationLayer* otherRelu = AddActivation(graph, ActivationFunction::ReLu, otherInfo, "otherRelu");
+
+    input->GetOutputSlot().Connect(relu->GetInputSlot(0));
+    input->GetOutputSlot().Connect(sigmoid->GetInputSlot(0));
+    input->GetOutputSlot().Connect(otherRelu->GetInputSlot(0));
+
+    LayerBindingId outputId = 0;
+    for (ActivationLayer* activation : { relu, sigmoid, otherRelu })
+    {
+        OutputLayer* output = graph.AddLayer<OutputLayer>(outputId++, "output");
+        activation->GetOutputSlot().Connect(output->GetInputSlot(0));
+    }
+
+    CHECK(EliminateCommonSubexpressions(graph) == 0);
+    CHECK(graph.GetNumLayers() == 7);
+}
+
+TEST_CASE("EliminateCommonSubexpressionsComparesConstantTensors")
+{
+    Graph graph;
+    const TensorInfo info({ 1, 2, 2, 3 }, DataType::Float32);
+    const TensorInfo constantInfo({ 3 }, DataType::Float32, 0.0f, 0, true);
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    // The first two layers hold equal values in separate tensors, the third one a different variance.
+    const std::vector<std::vector<float>> variances = { { 1.0f, 2.0f, 3.0f }, { 1.0f, 2.0f, 3.0f },
+                                                        { 1.0f, 2.0f, 4.0f } };
+    const std::vector<float> values = { 0.5f, 1.5f, 2.5f };
+
+    BatchNormalizationDescriptor descriptor;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    LayerBindingId outputId = 0;
+    for (const std::vector<float>& variance : variances)
+    {
+        auto batchNorm = graph.AddLayer<BatchNormalizationLayer>(descriptor, "batchNorm");
+        batchNorm->m_Mean     = std::make_unique<ScopedTensorHandle>(ConstTensor(constantInfo, values));
+        batchNorm->m_Variance = std::make_unique<ScopedTensorHandle>(ConstTensor(constantInfo, variance));
+        batchNorm->m_Beta     = std::make_unique<ScopedTensorHandle>(ConstTensor(constantInfo, values));
+        batchNorm->m_Gamma    = std::make_unique<ScopedTensorHandle>(ConstTensor(constantInfo, values));
+        batchNorm->GetOutputSlot().SetTensorInfo(info);
+
+        OutputLayer* output = graph.AddLayer<OutputLayer>(outputId++, "output");
+        input->GetOutputSlot().Connect(batchNorm->GetInputSlot(0));
+        batchNorm->GetOutputSlot().Connect(output->GetInputSlot(0));
+    }
+
+    CHECK(EliminateCommonSubexpressions(graph) == 1);
+    CHECK(graph.GetNumLayers() == 6);
+}
+
+}
@@ -0,0 +1,162 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayersFwd.hpp"
+
+#include <Graph.hpp>
+#include <Optimizer.hpp>
+#include <TestUtils.hpp>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+ConstantLayer* AddConstant(Graph& graph, const TensorInfo& info, const std::vector<float>& values, const char* name)
+{
+    ConstantLayer* constant = graph.AddLayer<ConstantLayer>(name);
+    constant->m_LayerOutput = std::make_shared<ScopedTensorHandle>(ConstTensor(info, values.data()));
+    constant->GetOutputSlot().SetTensorInfo(info);
+    return constant;
+}
+
+} // anonymous namespace
+
+TEST_CASE("EliminateIdentityLayersBypassesIdentityChain")
+{
+    // input -> pad -> transpose -> activation -> mul -> add -> output
+    //                                             ^      ^
+    //                                          one    zero
+    Graph graph;
+    const TensorInfo info({ 1, 2, 3, 4 }, DataType::Float32);
+    const TensorInfo constantInfo({ 1, 1, 1, 4 }, DataType::Float32, 0.0f, 0, true);
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    PadDescriptor padDescriptor({ { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } });
+    PadLayer* pad = graph.AddLayer<PadLayer>(padDescriptor, "pad");
+    pad->GetOutputSlot().SetTensorInfo(info);
+
+    TransposeLayer* transpose = graph.AddLayer<TransposeLayer>(TransposeDescriptor({ 0, 1, 2, 3 }), "transpose");
+    transpose->GetOutputSlot().SetTensorInfo(info);
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::Linear;
+    activationDescriptor.m_A        = 1.0f;
+    activationDescriptor.m_B        = 0.0f;
+    ActivationLayer* activation = graph.AddLayer<ActivationLayer>(activationDescriptor, "activation");
+    activation->GetOutputSlot().SetTensorInfo(info);
+
+    ConstantLayer* one  = AddConstant(graph, constantInfo, std::vector<float>(4, 1.0f), "one");
+    ConstantLayer* zero = AddConstant(graph, constantInfo, std::vector<float>(4, 0.0f), "zero");
+    auto mul = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Mul), "mul");
+    mul->GetOutputSlot().SetTensorInfo(info);
+    auto add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add");
+    add->GetOutputSlot().SetTensorInfo(info);
+
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(pad->GetInputSlot(0));
+    pad->GetOutputSlot().Connect(transpose->GetInputSlot(0));
+    transpose->GetOutputSlot().Connect(activation->GetInputSlot(0));
+    one->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    activation->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot().Connect(add->GetInputSlot(0));
+    zero->GetOutputSlot().Connect(add->GetInputSlot(1));
+    add->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    unsigned int numEliminated = 0;
+    Optimizer::Pass(graph, MakeOptimizations(EliminateIdentityLayers(&numEliminated)));
+
+    CHECK(numEliminated == 5);
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<OutputLayer>));
+}
+
+TEST_CASE("EliminateIdentityLayersKeepsNonIdentityLayers")
+{
+    Graph graph;
+    const TensorInfo info({ 1, 2, 3, 4 }, DataType::Float32);
+    const TensorInfo paddedInfo({ 1, 2, 5, 4 }, DataType::Float32);
+    const TensorInfo constantInfo({ 1, 1, 1, 4 }, DataType::Float32, 0.0f, 0, true);
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    // Constant with a non-neutral element, subtraction of the input from zero and an actual padding.
+    ConstantLayer* almostOne = AddConstant(graph, constantInfo, { 1.0f, 1.0f, 2.0f, 1.0f }, "almostOne");
+    auto mul = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Mul), "mul");
+    mul->GetOutputSlot().SetTensorInfo(info);
+
+    ConstantLayer* zero = AddConstant(graph, constantInfo, std::vector<float>(4, 0.0f), "zero");
+    auto sub = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Sub), "sub");
+    sub->GetOutputSlot().SetTensorInfo(info);
+
+    PadDescriptor padDescriptor({ { 0, 0 }, { 0, 0 }, { 1, 1 }, { 0, 0 } });
+    PadLayer* pad = graph.AddLayer<PadLayer>(padDescriptor, "pad");
+    pad->GetOutputSlot().SetTensorInfo(paddedInfo);
+
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    almostOne->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    zero->GetOutputSlot().Connect(sub->GetInputSlot(0));
+    mul->GetOutputSlot().Connect(sub->GetInputSlot(1));
+    sub->GetOutputSlot().Connect(pad->GetInputSlot(0));
+    pad->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    const size_t numLayers = graph.GetNumLayers();
+    unsigned int numEliminated = 0;
+    Optimizer::Pass(graph, MakeOptimizations(EliminateIdentityLayers(&numEliminated)));
+
+    CHECK(numEliminated == 0);
+    CHECK(graph.GetNumLayers() == numLayers);
+}
+
+TEST_CASE("EliminateIdentityLayersBypassesFullSlices")
+{
+    Graph graph;
+    const TensorInfo info({ 2, 3, 4 }, DataType::QAsymmU8, 0.5f, 10);
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    SliceLayer* slice = graph.AddLayer<SliceLayer>(SliceDescriptor({ 0, 0, 0 }, { 2, 3, 4 }), "slice");
+    slice->GetOutputSlot().SetTensorInfo(info);
+
+    StridedSliceDescriptor stridedSliceDescriptor({ 0, 0, 0 }, { 0, 3, 4 }, { 1, 1, 1 });
+    stridedSliceDescriptor.m_EndMask = 1;
+    StridedSliceLayer* stridedSlice = graph.AddLayer<StridedSliceLayer>(stridedSliceDescriptor, "stridedSlice");
+    stridedSlice->GetOutputSlot().SetTensorInfo(info);
+
+    CastLayer* cast = graph.AddLayer<CastLayer>("cast");
+    cast->GetOutputSlot().SetTensorInfo(info);
+
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(slice->GetInputSlot(0));
+    slice->GetOutputSlot().Connect(stridedSlice->GetInputSlot(0));
+    stridedSlice->GetOutputSlot().Connect(cast->GetInputSlot(0));
+    cast->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    unsigned int numEliminated = 0;
+    Optimizer::Pass(graph, MakeOptimizations(EliminateIdentityLayers(&numEliminated)));
+
+    CHECK(numEliminated == 3);
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<OutputLayer>));
+}
+
+}
@@ -0,0 +1,115 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayersFwd.hpp"
+
+#include <Graph.hpp>
+#include <Optimizer.hpp>
+#include <TestUtils.hpp>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+ConstantLayer* AddConstant(Graph& graph, const TensorInfo& info, const std::vector<float>& values, const char* name)
+{
+    ConstantLayer* constant = graph.AddLayer<ConstantLayer>(name);
+    constant->m_LayerOutput = std::make_shared<ScopedTensorHandle>(ConstTensor(info, values.data()));
+    constant->GetOutputSlot().SetTensorInfo(info);
+    return constant;
+}
+
+std::vector<float> GetConstantValues(const Layer& layer)
+{
+    const ConstantLayer& constant = dynamic_cast<const ConstantLayer&>(layer);
+    const float* data = constant.m_LayerOutput->GetConstTensor<float>();
+    return std::vector<float>(data, data + constant.m_LayerOutput->GetTensorInfo().GetNumElements());
+}
+
+} // anonymous namespace
+
+TEST_CASE("FoldConstantLayersFoldsConstantSubgraph")
+{
+    // constant0 -> reshape -> add <- constant1
+    //                          |
+    //                          v
+    //              input ->   mul -> output
+    Graph graph;
+    const TensorInfo constantInfo({ 4 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo info({ 2, 2 }, DataType::Float32);
+
+    ConstantLayer* constant0 = AddConstant(graph, constantInfo, { 1.0f, 2.0f, 3.0f, 4.0f }, "constant0");
+    ConstantLayer* constant1 = AddConstant(graph, TensorInfo({ 2, 2 }, DataType::Float32, 0.0f, 0, true),
+                                           { 10.0f, 20.0f, 30.0f, 40.0f }, "constant1");
+
+    ReshapeLayer* reshape = graph.AddLayer<ReshapeLayer>(ReshapeDescriptor(TensorShape({ 2, 2 })), "reshape");
+    reshape->GetOutputSlot().SetTensorInfo(info);
+    auto add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add");
+    add->GetOutputSlot().SetTensorInfo(info);
+    auto mul = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Mul), "mul");
+    mul->GetOutputSlot().SetTensorInfo(info);
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    constant0->GetOutputSlot().Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot().Connect(add->GetInputSlot(0));
+    constant1->GetOutputSlot().Connect(add->GetInputSlot(1));
+    input->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    add->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    Optimizer::Pass(graph, MakeOptimizations(FoldConstantLayers()));
+
+    CHECK(graph.GetNumLayers() == 4);
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<ElementwiseBinaryLayer>,
+                        &IsLayerOfType<OutputLayer>));
+
+    const Layer& folded = mul->GetInputSlot(1).GetConnectedOutputSlot()->GetOwningLayer();
+    CHECK(folded.GetType() == LayerType::Constant);
+    CHECK(folded.GetOutputSlot(0).GetTensorInfo().GetShape() == info.GetShape());
+    CHECK(folded.GetOutputSlot(0).GetTensorInfo().IsConstant());
+    CHECK(GetConstantValues(folded) == std::vector<float>({ 11.0f, 22.0f, 33.0f, 44.0f }));
+}
+
+TEST_CASE("FoldConstantLayersRespectsSizeCap")
+{
+    Graph graph;
+    const unsigned int numElements = FoldConstantLayersImpl::MaxFoldedTensorBytes / sizeof(float) + 1;
+    const TensorInfo constantInfo({ numElements }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo info({ numElements }, DataType::Float32);
+
+    ConstantLayer* constant = AddConstant(graph, constantInfo, std::vector<float>(numElements, -1.0f), "constant");
+
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::ReLu;
+    ActivationLayer* activation = graph.AddLayer<ActivationLayer>(descriptor, "activation");
+    activation->GetOutputSlot().SetTensorInfo(info);
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    constant->GetOutputSlot().Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    Optimizer::Pass(graph, MakeOptimizations(FoldConstantLayers()));
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<ActivationLayer>,
+                        &IsLayerOfType<OutputLayer>));
+}
+
+}
@@ -0,0 +1,202 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LayersFwd.hpp"
+
+#include <Graph.hpp>
+#include <GraphUtils.hpp>
+#include <Half.hpp>
+#include <Optimizer.hpp>
+#include <TestUtils.hpp>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+template<typename T>
+ConstantLayer* AddConstant(Graph& graph, const TensorInfo& info, const std::vector<T>& values, const char* name)
+{
+    ConstantLayer* constant = graph.AddLayer<ConstantLayer>(name);
+    constant->m_LayerOutput = std::make_shared<ScopedTensorHandle>(ConstTensor(info, values.data()));
+    constant->GetOutputSlot().SetTensorInfo(info);
+    return constant;
+}
+
+ElementwiseBinaryLayer* AddBinary(Graph& graph, BinaryOperation operation, const TensorInfo& info, const char* name)
+{
+    auto layer = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(operation), name);
+    layer->GetOutputSlot().SetTensorInfo(info);
+    return layer;
+}
+
+template<typename T>
+std::vector<T> GetConstantValues(const Layer& layer, unsigned int inputIndex)
+{
+    const Layer& owner = layer.GetInputSlot(inputIndex).GetConnectedOutputSlot()->GetOwningLayer();
+    const auto& constant = PolymorphicDowncast<const ConstantLayer*>(&owner)->m_LayerOutput;
+    const T* data = constant->GetConstTensor<T>();
+    return std::vector<T>(data, data + constant->GetTensorInfo().GetNumElements());
+}
+
+} // anonymous namespace
+
+TEST_CASE("FoldScaleShiftIntoConvolution2d")
+{
+    // input -> conv2d -> mul -> add -> output
+    //            ^        ^      ^
+    //         weights   scale  shift
+    Graph graph;
+    const TensorInfo inputInfo({ 1, 3, 3, 1 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 3, 3, 2 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 2, 1, 1, 1 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo channelInfo({ 1, 1, 1, 2 }, DataType::Float32, 0.0f, 0, true);
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+    ConstantLayer* weights = AddConstant<float>(graph, weightsInfo, { 1.0f, 2.0f }, "weights");
+    auto conv = graph.AddLayer<Convolution2dLayer>(descriptor, "conv");
+    conv->GetOutputSlot().SetTensorInfo(outputInfo);
+    ConstantLayer* scale = AddConstant<float>(graph, channelInfo, { 3.0f, 0.5f }, "scale");
+    auto mul = AddBinary(graph, BinaryOperation::Mul, outputInfo, "mul");
+    ConstantLayer* shift = AddConstant<float>(graph, channelInfo, { 1.0f, -1.0f }, "shift");
+    auto add = AddBinary(graph, BinaryOperation::Add, outputInfo, "add");
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(conv->GetInputSlot(0));
+    weights->GetOutputSlot().Connect(conv->GetInputSlot(1));
+    conv->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    scale->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    shift->GetOutputSlot().Connect(add->GetInputSlot(0));
+    mul->GetOutputSlot().Connect(add->GetInputSlot(1));
+    add->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    Optimizer::Pass(graph, MakeOptimizations(FoldScaleShiftIntoConvolution2dFloat32()));
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<Convolution2dLayer>,
+                        &IsLayerOfType<OutputLayer>));
+
+    const Layer& fused = output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    CHECK(std::string(fused.GetName()) == "fused-mul-add-into-conv");
+    CHECK(PolymorphicDowncast<const Convolution2dLayer*>(&fused)->GetParameters().m_BiasEnabled);
+    CHECK(GetConstantValues<float>(fused, 1) == std::vector<float>({ 3.0f, 1.0f }));
+    CHECK(GetConstantValues<float>(fused, 2) == std::vector<float>({ 1.0f, -1.0f }));
+}
+
+TEST_CASE("FoldScaleShiftIntoFullyConnectedFloat16")
+{
+    // input -> fullyConnected -> sub -> div -> output, with transposed weights and an existing bias.
+    Graph graph;
+    const TensorInfo inputInfo({ 1, 2 }, DataType::Float16);
+    const TensorInfo outputInfo({ 1, 2 }, DataType::Float16);
+    const TensorInfo weightsInfo({ 2, 2 }, DataType::Float16, 0.0f, 0, true);
+    const TensorInfo biasInfo({ 2 }, DataType::Float16, 0.0f, 0, true);
+    const TensorInfo scalarInfo({ 1 }, DataType::Float16, 0.0f, 0, true);
+    const TensorInfo channelInfo({ 2 }, DataType::Float16, 0.0f, 0, true);
+
+    FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = true;
+    descriptor.m_TransposeWeightMatrix = true;
+
+    using namespace half_float::literal;
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+    ConstantLayer* weights = AddConstant<Half>(graph, weightsInfo, { 1.0_h, 2.0_h, 3.0_h, 4.0_h }, "weights");
+    ConstantLayer* bias = AddConstant<Half>(graph, biasInfo, { 2.0_h, 6.0_h }, "bias");
+    auto fullyConnected = graph.AddLayer<FullyConnectedLayer>(descriptor, "fc");
+    fullyConnected->GetOutputSlot().SetTensorInfo(outputInfo);
+    ConstantLayer* offset = AddConstant<Half>(graph, scalarInfo, { 2.0_h }, "offset");
+    auto sub = AddBinary(graph, BinaryOperation::Sub, outputInfo, "sub");
+    ConstantLayer* divisor = AddConstant<Half>(graph, channelInfo, { 2.0_h, 4.0_h }, "divisor");
+    auto div = AddBinary(graph, BinaryOperation::Div, outputInfo, "div");
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(fullyConnected->GetInputSlot(0));
+    weights->GetOutputSlot().Connect(fullyConnected->GetInputSlot(1));
+    bias->GetOutputSlot().Connect(fullyConnected->GetInputSlot(2));
+    fullyConnected->GetOutputSlot().Connect(sub->GetInputSlot(0));
+    offset->GetOutputSlot().Connect(sub->GetInputSlot(1));
+    sub->GetOutputSlot().Connect(div->GetInputSlot(0));
+    divisor->GetOutputSlot().Connect(div->GetInputSlot(1));
+    div->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    Optimizer::Pass(graph, MakeOptimizations(FoldScaleShiftIntoFullyConnectedFloat32(),
+                                             FoldScaleShiftIntoFullyConnectedFloat16()));
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<ConstantLayer>,
+                        &IsLayerOfType<FullyConnectedLayer>,
+                        &IsLayerOfType<OutputLayer>));
+
+    // Output channels are the outermost dimension of the transposed weights.
+    const Layer& fused = output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    CHECK(GetConstantValues<Half>(fused, 1) == std::vector<Half>({ 0.5_h, 1.0_h, 0.75_h, 1.0_h }));
+    CHECK(GetConstantValues<Half>(fused, 2) == std::vector<Half>({ 0.0_h, 1.0_h }));
+}
+
+TEST_CASE("FoldScaleShiftKeepsNonChannelConstants")
+{
+    // The scale varies over the spatial dimensions and the divisor is divided by the output of the convolution, so
+    // neither can be folded into the weights.
+    Graph graph;
+    const TensorInfo inputInfo({ 1, 2, 2, 1 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 2, 2, 1 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 1, 1, 1, 1 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo spatialInfo({ 1, 2, 2, 1 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo scalarInfo({ 1 }, DataType::Float32, 0.0f, 0, true);
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    InputLayer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+    ConstantLayer* weights = AddConstant<float>(graph, weightsInfo, { 2.0f }, "weights");
+    auto conv0 = graph.AddLayer<Convolution2dLayer>(descriptor, "conv0");
+    conv0->GetOutputSlot().SetTensorInfo(outputInfo);
+    ConstantLayer* scale = AddConstant<float>(graph, spatialInfo, { 1.0f, 2.0f, 3.0f, 4.0f }, "scale");
+    auto mul = AddBinary(graph, BinaryOperation::Mul, outputInfo, "mul");
+
+    ConstantLayer* weights1 = AddConstant<float>(graph, weightsInfo, { 2.0f }, "weights1");
+    auto conv1 = graph.AddLayer<Convolution2dLayer>(descriptor, "conv1");
+    conv1->GetOutputSlot().SetTensorInfo(outputInfo);
+    ConstantLayer* dividend = AddConstant<float>(graph, scalarInfo, { 1.0f }, "dividend");
+    auto div = AddBinary(graph, BinaryOperation::Div, outputInfo, "div");
+    OutputLayer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(conv0->GetInputSlot(0));
+    weights->GetOutputSlot().Connect(conv0->GetInputSlot(1));
+    conv0->GetOutputSlot().Connect(mul->GetInputSlot(0));
+    scale->GetOutputSlot().Connect(mul->GetInputSlot(1));
+    mul->GetOutputSlot().Connect(conv1->GetInputSlot(0));
+    weights1->GetOutputSlot().Connect(conv1->GetInputSlot(1));
+    dividend->GetOutputSlot().Connect(div->GetInputSlot(0));
+    conv1->GetOutputSlot().Connect(div->GetInputSlot(1));
+    div->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    const size_t numLayers = graph.GetNumLayers();
+    Optimizer::Pass(graph, MakeOptimizations(FoldScaleShiftIntoConvolution2dFloat32()));
+
+    CHECK(graph.GetNumLayers() == numLayers);
+    CHECK(GraphHasNamedLayer(graph, "mul"));
+    CHECK(GraphHasNamedLayer(graph, "div"));
+}
+
+}
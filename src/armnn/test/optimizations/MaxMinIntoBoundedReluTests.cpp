@@ -135,8 +135,10 @@ void MulMaxMinTest(Compute backendId, size_t numLayers)
     // Create ArmNN runtime
     IRuntimePtr run = IRuntime::Create(IRuntime::CreationOptions());
 
-    // Optimise ArmNN network
-    IOptimizedNetworkPtr optNet = Optimize(*network, {backendId}, run->GetDeviceSpec());
+    // Optimise ArmNN network. Elementwise fusion on CpuRef is turned off so the BoundedReLu stays visible.
+    OptimizerOptionsOpaque optimizerOptions;
+    optimizerOptions.AddModelOption(BackendOptions("CpuRef", {{"FuseElementwise", false}}));
+    IOptimizedNetworkPtr optNet = Optimize(*network, {backendId}, run->GetDeviceSpec(), optimizerOptions);
 
     Graph& graph = GetGraphForTesting(optNet.get());
 
@@ -0,0 +1,263 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <GraphUtils.hpp>
+#include <TestUtils.hpp>
+
+#include <Optimizer.hpp>
+
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+TEST_SUITE("Optimizer")
+{
+using namespace armnn;
+using namespace armnn::optimizations;
+
+namespace
+{
+
+// NHWC to NCHW and back.
+const PermutationVector toNchw({ 0, 3, 1, 2 });
+const PermutationVector toNhwc({ 0, 2, 3, 1 });
+
+unsigned int CountTransposes(const Graph& graph)
+{
+    unsigned int count = 0;
+    for (auto&& layer : graph)
+    {
+        count += layer->GetType() == LayerType::Transpose ? 1u : 0u;
+    }
+    return count;
+}
+
+TransposeLayer* AddTranspose(Graph& graph, const PermutationVector& permutation, const TensorInfo& info,
+                             const char* name)
+{
+    auto transpose = graph.AddLayer<TransposeLayer>(TransposeDescriptor(permutation), name);
+    transpose->GetOutputSlot().SetTensorInfo(info);
+    return transpose;
+}
+
+} // anonymous namespace
+
+TEST_CASE("PropagateDataLayoutsRemovesTransposesAroundElementwiseRegion")
+{
+    // input -> transpose -> add -> relu -> transpose -> output
+    //                        ^
+    //                     constant
+    Graph graph;
+    const TensorInfo nhwcInfo({ 1, 2, 2, 3 }, DataType::Float32);
+    const TensorInfo nchwInfo({ 1, 3, 2, 2 }, DataType::Float32);
+    const TensorInfo constantInfo({ 1, 3, 2, 2 }, DataType::Float32, 0.0f, 0, true);
+
+    std::vector<float> constantValues(12);
+    for (unsigned int i = 0; i < constantValues.size(); ++i)
+    {
+        constantValues[i] = static_cast<float>(i);
+    }
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(nhwcInfo);
+    auto toNchwLayer = AddTranspose(graph, toNchw, nchwInfo, "toNchw");
+    auto constant = graph.AddLayer<ConstantLayer>("constant");
+    constant->m_LayerOutput = std::make_shared<ScopedTensorHandle>(ConstTensor(constantInfo, constantValues.data()));
+    constant->GetOutputSlot().SetTensorInfo(constantInfo);
+    auto add = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add), "add");
+    add->GetOutputSlot().SetTensorInfo(nchwInfo);
+    auto relu = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "relu");
+    relu->GetOutputSlot().SetTensorInfo(nchwInfo);
+    auto toNhwcLayer = AddTranspose(graph, toNhwc, nhwcInfo, "toNhwc");
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(toNchwLayer->GetInputSlot(0));
+    toNchwLayer->GetOutputSlot().Connect(add->GetInputSlot(0));
+    constant->GetOutputSlot().Connect(add->GetInputSlot(1));
+    add->GetOutputSlot().Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot().Connect(toNhwcLayer->GetInputSlot(0));
+    toNhwcLayer->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    CHECK(PropagateDataLayouts(graph) == 1);
+
+    CHECK(CountTransposes(graph) == 0);
+    CHECK(graph.GetNumLayers() == 5);
+    CHECK(add->GetOutputSlot().GetTensorInfo().GetShape() == nhwcInfo.GetShape());
+    CHECK(relu->GetOutputSlot().GetTensorInfo().GetShape() == nhwcInfo.GetShape());
+    CHECK(&output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == relu);
+    CHECK(&add->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer() == input);
+
+    // The constant is read in NHWC order.
+    const Layer& permuted = add->GetInputSlot(1).GetConnectedOutputSlot()->GetOwningLayer();
+    const auto& handle = PolymorphicDowncast<const ConstantLayer*>(&permuted)->m_LayerOutput;
+    CHECK(handle->GetTensorInfo().GetShape() == nhwcInfo.GetShape());
+    const float* data = handle->GetConstTensor<float>();
+    CHECK(std::vector<float>(data, data + 12) ==
+          std::vector<float>({ 0.0f, 4.0f, 8.0f, 1.0f, 5.0f, 9.0f, 2.0f, 6.0f, 10.0f, 3.0f, 7.0f, 11.0f }));
+}
+
+TEST_CASE("PropagateDataLayoutsRemapsConcatAxis")
+{
+    // input0 -> transpose0 -> concat -> relu -> transpose -> output
+    // input1 -> transpose1 ---^
+    Graph graph;
+    const TensorInfo nhwcInfo({ 1, 2, 2, 3 }, DataType::Float32);
+    const TensorInfo nchwInfo({ 1, 3, 2, 2 }, DataType::Float32);
+    const TensorInfo concatNchwInfo({ 1, 6, 2, 2 }, DataType::Float32);
+    const TensorInfo concatNhwcInfo({ 1, 2, 2, 6 }, DataType::Float32);
+
+    const std::vector<TensorShape> concatShapes = { nchwInfo.GetShape(), nchwInfo.GetShape() };
+    const OriginsDescriptor concatDescriptor =
+        CreateDescriptorForConcatenation(concatShapes.begin(), concatShapes.end(), 1);
+
+    auto input0 = graph.AddLayer<InputLayer>(0, "input0");
+    input0->GetOutputSlot().SetTensorInfo(nhwcInfo);
+    auto input1 = graph.AddLayer<InputLayer>(1, "input1");
+    input1->GetOutputSlot().SetTensorInfo(nhwcInfo);
+    auto transpose0 = AddTranspose(graph, toNchw, nchwInfo, "transpose0");
+    auto transpose1 = AddTranspose(graph, toNchw, nchwInfo, "transpose1");
+    auto concat = graph.AddLayer<ConcatLayer>(concatDescriptor, "concat");
+    concat->GetOutputSlot().SetTensorInfo(concatNchwInfo);
+    auto relu = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "relu");
+    relu->GetOutputSlot().SetTensorInfo(concatNchwInfo);
+    auto transpose = AddTranspose(graph, toNhwc, concatNhwcInfo, "transpose");
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input0->GetOutputSlot().Connect(transpose0->GetInputSlot(0));
+    input1->GetOutputSlot().Connect(transpose1->GetInputSlot(0));
+    transpose0->GetOutputSlot().Connect(concat->GetInputSlot(0));
+    transpose1->GetOutputSlot().Connect(concat->GetInputSlot(1));
+    concat->GetOutputSlot().Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot().Connect(transpose->GetInputSlot(0));
+    transpose->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    CHECK(PropagateDataLayouts(graph) == 1);
+    CHECK(CountTransposes(graph) == 0);
+
+    // The concatenation now joins the NHWC tensors along their channels.
+    const Layer& newConcat = relu->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    CHECK(newConcat.GetType() == LayerType::Concat);
+    const OriginsDescriptor& descriptor = PolymorphicDowncast<const ConcatLayer*>(&newConcat)->GetParameters();
+    CHECK(descriptor.GetConcatAxis() == 3);
+    CHECK(descriptor.GetViewOrigin(1)[3] == 3);
+    CHECK(descriptor.GetViewOrigin(1)[1] == 0);
+    CHECK(newConcat.GetOutputSlot(0).GetTensorInfo().GetShape() == concatNhwcInfo.GetShape());
+    CHECK(relu->GetOutputSlot().GetTensorInfo().GetShape() == concatNhwcInfo.GetShape());
+}
+
+TEST_CASE("PropagateDataLayoutsKeepsTransposeWithoutSaving")
+{
+    // input -> transpose -> relu -> output: moving the transpose after the relu would not remove any work.
+    Graph graph;
+    const TensorInfo nhwcInfo({ 1, 2, 2, 3 }, DataType::Float32);
+    const TensorInfo nchwInfo({ 1, 3, 2, 2 }, DataType::Float32);
+
+    auto input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(nhwcInfo);
+    auto transpose = AddTranspose(graph, toNchw, nchwInfo, "transpose");
+    auto relu = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), "relu");
+    relu->GetOutputSlot().SetTensorInfo(nchwInfo);
+    auto output = graph.AddLayer<OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(transpose->GetInputSlot(0));
+    transpose->GetOutputSlot().Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    CHECK(PropagateDataLayouts(graph) == 0);
+
+    CHECK(CheckSequence(graph.cbegin(), graph.cend(),
+                        &IsLayerOfType<InputLayer>,
+                        &IsLayerOfType<TransposeLayer>,
+                        &IsLayerOfType<ActivationLayer>,
+                        &IsLayerOfType<OutputLayer>));
+    CHECK(relu->GetOutputSlot().GetTensorInfo().GetShape() == nchwInfo.GetShape());
+}
+
+#if defined(ARMNNREF_ENABLED)
+TEST_CASE("PropagateDataLayoutsExecutesPaddedConcatInNhwc")
+{
+    // Two NHWC inputs are transposed to NCHW, concatenated along the channels, padded at the top, passed through a
+    // ReLu and transposed back. The whole region runs in NHWC once optimized.
+    const TensorInfo nhwcInfo({ 1, 2, 2, 3 }, DataType::Float32);
+    const TensorInfo nchwInfo({ 1, 3, 2, 2 }, DataType::Float32);
+    const TensorInfo concatInfo({ 1, 6, 2, 2 }, DataType::Float32);
+    const TensorInfo paddedInfo({ 1, 6, 3, 2 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 3, 2, 6 }, DataType::Float32);
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input0 = network->AddInputLayer(0, "input0");
+    IConnectableLayer* input1 = network->AddInputLayer(1, "input1");
+    IConnectableLayer* transpose0 = network->AddTransposeLayer(TransposeDescriptor(toNchw), "transpose0");
+    IConnectableLayer* transpose1 = network->AddTransposeLayer(TransposeDescriptor(toNchw), "transpose1");
+    const std::vector<TensorShape> concatShapes = { nchwInfo.GetShape(), nchwInfo.GetShape() };
+    IConnectableLayer* concat = network->AddConcatLayer(
+        CreateDescriptorForConcatenation(concatShapes.begin(), concatShapes.end(), 1), "concat");
+    IConnectableLayer* pad = network->AddPadLayer(PadDescriptor({ { 0, 0 }, { 0, 0 }, { 1, 0 }, { 0, 0 } }), "pad");
+    IConnectableLayer* relu = network->AddActivationLayer(ActivationDescriptor(ActivationFunction::ReLu), "relu");
+    IConnectableLayer* transpose = network->AddTransposeLayer(TransposeDescriptor(toNhwc), "transpose");
+    IConnectableLayer* output = network->AddOutputLayer(0, "output");
+
+    input0->GetOutputSlot(0).SetTensorInfo(nhwcInfo);
+    input1->GetOutputSlot(0).SetTensorInfo(nhwcInfo);
+    transpose0->GetOutputSlot(0).SetTensorInfo(nchwInfo);
+    transpose1->GetOutputSlot(0).SetTensorInfo(nchwInfo);
+    concat->GetOutputSlot(0).SetTensorInfo(concatInfo);
+    pad->GetOutputSlot(0).SetTensorInfo(paddedInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(paddedInfo);
+    transpose->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    input0->GetOutputSlot(0).Connect(transpose0->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(transpose1->GetInputSlot(0));
+    transpose0->GetOutputSlot(0).Connect(concat->GetInputSlot(0));
+    transpose1->GetOutputSlot(0).Connect(concat->GetInputSlot(1));
+    concat->GetOutputSlot(0).Connect(pad->GetInputSlot(0));
+    pad->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(transpose->GetInputSlot(0));
+    transpose->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkPtr optimizedNetwork = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec());
+    CHECK(CountTransposes(GetGraphForTesting(optimizedNetwork.get())) == 0);
+
+    NetworkId networkId;
+    CHECK(runtime->LoadNetwork(networkId, std::move(optimizedNetwork)) == Status::Success);
+
+    std::vector<float> inputData0(12);
+    std::vector<float> inputData1(12);
+    for (unsigned int i = 0; i < 12; ++i)
+    {
+        inputData0[i] = static_cast<float>(i) - 4.0f;
+        inputData1[i] = static_cast<float>(i) * 10.0f;
+    }
+    TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData0.data()) },
+                               { 1, ConstTensor(inputInfo, inputData1.data()) } };
+    std::vector<float> outputData(outputInfo.GetNumElements(), -1.0f);
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } };
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == Status::Success);
+
+    // The first row is padding, the others hold the channels of input0 followed by those of input1.
+    std::vector<float> expectedData(outputInfo.GetNumElements(), 0.0f);
+    for (unsigned int h = 1; h < 3; ++h)
+    {
+        for (unsigned int w = 0; w < 2; ++w)
+        {
+            for (unsigned int c = 0; c < 3; ++c)
+            {
+                const unsigned int inputIndex = ((h - 1) * 2 + w) * 3 + c;
+                expectedData[(h * 2 + w) * 6 + c]     = std::max(inputData0[inputIndex], 0.0f);
+                expectedData[(h * 2 + w) * 6 + c + 3] = std::max(inputData1[inputIndex], 0.0f);
+            }
+        }
+    }
+    CHECK(outputData == expectedData);
+}
+#endif
+
+}
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <memory>
 #include <armnn/MemorySources.hpp>
+#include <armnn/backends/ICustomAllocator.hpp>
 #include <armnn/utility/IgnoreUnused.hpp>
 
 namespace armnn
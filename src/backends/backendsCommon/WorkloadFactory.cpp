@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2024,2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -73,10 +73,6 @@ bool IWorkloadFactory::IsLayerConfigurationSupported(const BackendId& backendId,
                                                      std::string& outReasonIfUnsupported,
                                                      const ModelOptions& modelOptions)
 {
-    Optional<std::string&> reason = outReasonIfUnsupported;
-    bool result;
-    const Layer& layer = *(PolymorphicDowncast<const Layer*>(&connectableLayer));
-
     auto const& backendRegistry = BackendRegistryInstance();
     if (!backendRegistry.IsBackendRegistered(backendId))
     {
@@ -93,6 +89,18 @@ bool IWorkloadFactory::IsLayerConfigurationSupported(const BackendId& backendId,
     auto layerSupport = backendObject->GetLayerSupport(modelOptions);
     auto layerSupportObject = LayerSupportHandle(layerSupport, backendId);
 
+    return IsLayerConfigurationSupported(layerSupportObject, connectableLayer, dataType, outReasonIfUnsupported);
+}
+
+bool IWorkloadFactory::IsLayerConfigurationSupported(LayerSupportHandle& layerSupportObject,
+                                                     const IConnectableLayer& connectableLayer,
+                                                     Optional<DataType> dataType,
+                                                     std::string& outReasonIfUnsupported)
+{
+    Optional<std::string&> reason = outReasonIfUnsupported;
+    bool result;
+    const Layer& layer = *(PolymorphicDowncast<const Layer*>(&connectableLayer));
+
     switch(layer.GetType())
     {
         case LayerType::Activation:
@@ -415,12 +423,11 @@ bool IWorkloadFactory::IsLayerConfigurationSupported(const BackendId& backendId,
             std::vector<TensorInfo> infos = { OverrideDataType(input0, dataType),
                                               OverrideDataType(input1, dataType),
                                               OverrideDataType(output, dataType) };
-            result = layerSupport->IsLayerSupported(LayerType::ElementwiseBinary,
-                                                    infos,
-                                                    cLayer->GetParameters(),
-                                                    EmptyOptional(),
-                                                    EmptyOptional(),
-                                                    reason);
+            result = layerSupportObject.IsElementwiseBinarySupported(infos[0],
+                                                                     infos[1],
+                                                                     infos[2],
+                                                                     cLayer->GetParameters(),
+                                                                     reason);
             break;
         }
         case LayerType::ElementwiseUnary:
@@ -1668,4 +1675,22 @@ bool IWorkloadFactory::IsLayerSupported(const BackendId& backendId,
                                          modelOptions);
 }
 
+bool IWorkloadFactory::IsLayerSupported(LayerSupportHandle& layerSupport,
+                                        const IConnectableLayer& connectableLayer,
+                                        Optional<DataType> dataType,
+                                        std::string& outReasonIfUnsupported)
+{
+    if (!layerSupport.IsBackendRegistered())
+    {
+        std::stringstream ss;
+        ss << connectableLayer.GetName() << " is not supported on "
+           << PolymorphicDowncast<const Layer*>(&connectableLayer)->GetBackendId()
+           << " because this backend is not registered.";
+
+        outReasonIfUnsupported = ss.str();
+        return false;
+    }
+    return IsLayerConfigurationSupported(layerSupport, connectableLayer, dataType, outReasonIfUnsupported);
+}
+
 } // namepsace armnn
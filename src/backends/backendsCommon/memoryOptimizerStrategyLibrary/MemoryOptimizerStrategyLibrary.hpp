@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -8,6 +8,7 @@
 #include "MemoryOptimizerStrategyFactory.hpp"
 
 #include "strategies/ConstantMemoryStrategy.hpp"
+#include "strategies/MultiAxisBestFit.hpp"
 #include "strategies/StrategyValidator.hpp"
 #include "strategies/SingleAxisPriorityList.hpp"
 
@@ -25,6 +26,7 @@ static std::map<std::string, std::unique_ptr<IMemoryOptimizerStrategyFactory>>&
     if (strategies.size() == 0)
     {
         strategies["ConstantMemoryStrategy"] = std::make_unique<StrategyFactory<ConstantMemoryStrategy>>();
+        strategies["MultiAxisBestFit"]       = std::make_unique<StrategyFactory<MultiAxisBestFit>>();
         strategies["SingleAxisPriorityList"] = std::make_unique<StrategyFactory<SingleAxisPriorityList>>();
         strategies["StrategyValidator"]      = std::make_unique<StrategyFactory<StrategyValidator>>();
     }
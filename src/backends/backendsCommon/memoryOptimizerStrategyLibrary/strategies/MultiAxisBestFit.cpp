@@ -0,0 +1,117 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "MultiAxisBestFit.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace armnn
+{
+
+// For more information on the algorithm itself see: https://arxiv.org/pdf/2001.03288.pdf
+// This strategy is an implementation of 5.3 Greedy by Size for Offset Calculation, choosing the best fitting gap
+// instead of the first one.
+
+std::string MultiAxisBestFit::GetName() const
+{
+    return m_Name;
+}
+
+MemBlockStrategyType MultiAxisBestFit::GetMemBlockStrategyType() const
+{
+    return m_MemBlockStrategyType;
+}
+
+std::vector<MemBin> MultiAxisBestFit::Optimize(std::vector<MemBlock>& memBlocks)
+{
+    auto alignUp = [this](size_t offset)
+    {
+        return (offset + m_Alignment - 1) & ~(m_Alignment - 1);
+    };
+
+    // Largest blocks first, longest lived first among blocks of the same size
+    std::vector<MemBlock*> priorityList;
+    priorityList.reserve(memBlocks.size());
+    for (auto& memBlock : memBlocks)
+    {
+        priorityList.push_back(&memBlock);
+    }
+    std::sort(priorityList.begin(), priorityList.end(), [](const MemBlock* lhs, const MemBlock* rhs)
+    {
+        if (lhs->m_MemSize != rhs->m_MemSize)
+        {
+            return lhs->m_MemSize > rhs->m_MemSize;
+        }
+        const unsigned int lhsLifetime = lhs->m_EndOfLife - lhs->m_StartOfLife;
+        const unsigned int rhsLifetime = rhs->m_EndOfLife - rhs->m_StartOfLife;
+        if (lhsLifetime != rhsLifetime)
+        {
+            return lhsLifetime > rhsLifetime;
+        }
+        return lhs->m_Index < rhs->m_Index;
+    });
+
+    // The blocks placed so far, kept sorted by offset
+    std::vector<MemBlock*> placedBlocks;
+    placedBlocks.reserve(memBlocks.size());
+    size_t binSize = 0;
+
+    for (MemBlock* curBlock : priorityList)
+    {
+        size_t bestOffset = 0;
+        size_t bestGap = std::numeric_limits<size_t>::max();
+        size_t prevEnd = 0;
+
+        // Walk the blocks that overlap curBlock in time in order of offset, looking for the smallest gap between them
+        // that curBlock fits into
+        for (const MemBlock* placedBlock : placedBlocks)
+        {
+            if (placedBlock->m_StartOfLife > curBlock->m_EndOfLife || placedBlock->m_EndOfLife < curBlock->m_StartOfLife)
+            {
+                continue;
+            }
+            const size_t candidate = alignUp(prevEnd);
+            if (placedBlock->m_Offset >= candidate + curBlock->m_MemSize)
+            {
+                const size_t gap = placedBlock->m_Offset - candidate;
+                if (gap < bestGap)
+                {
+                    bestGap = gap;
+                    bestOffset = candidate;
+                }
+            }
+            prevEnd = std::max(prevEnd, placedBlock->m_Offset + placedBlock->m_MemSize);
+        }
+
+        // Otherwise place it on top of all the blocks it overlaps
+        curBlock->m_Offset = bestGap == std::numeric_limits<size_t>::max() ? alignUp(prevEnd) : bestOffset;
+        binSize = std::max(binSize, curBlock->m_Offset + curBlock->m_MemSize);
+
+        auto position = std::upper_bound(placedBlocks.begin(), placedBlocks.end(), curBlock,
+                                         [](const MemBlock* lhs, const MemBlock* rhs)
+                                         {
+                                             return lhs->m_Offset < rhs->m_Offset;
+                                         });
+        placedBlocks.insert(position, curBlock);
+    }
+
+    MemBin memBin;
+    memBin.m_MemSize = binSize;
+    memBin.m_MemBlocks.reserve(memBlocks.size());
+    for (const auto& memBlock : memBlocks)
+    {
+        memBin.m_MemBlocks.push_back(memBlock);
+    }
+
+    std::vector<MemBin> memBins;
+    if (!memBlocks.empty())
+    {
+        memBins.push_back(std::move(memBin));
+    }
+    return memBins;
+}
+
+} // namespace armnn
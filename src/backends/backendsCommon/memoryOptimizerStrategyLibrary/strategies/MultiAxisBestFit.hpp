@@ -0,0 +1,37 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Types.hpp>
+#include <armnn/backends/IMemoryOptimizerStrategy.hpp>
+
+namespace armnn
+{
+
+/// MultiAxisBestFit places every MemBlock into a single MemBin, giving each block an offset such that no two blocks
+/// that are alive at the same time share any memory. Blocks are placed in order of decreasing size, each one into the
+/// smallest gap left between the blocks already placed that overlap it in time, or on top of them if no gap fits.
+class MultiAxisBestFit : public IMemoryOptimizerStrategy
+{
+public:
+    /// All offsets are multiples of alignment, which must be a power of two.
+    explicit MultiAxisBestFit(size_t alignment = 64)
+        : m_Name(std::string("MultiAxisBestFit"))
+        , m_MemBlockStrategyType(MemBlockStrategyType::MultiAxisPacking)
+        , m_Alignment(alignment) {}
+
+    std::string GetName() const override;
+
+    MemBlockStrategyType GetMemBlockStrategyType() const override;
+
+    std::vector<MemBin> Optimize(std::vector<MemBlock>& memBlocks) override;
+
+private:
+    std::string m_Name;
+    MemBlockStrategyType m_MemBlockStrategyType;
+    size_t m_Alignment;
+};
+
+} // namespace armnn
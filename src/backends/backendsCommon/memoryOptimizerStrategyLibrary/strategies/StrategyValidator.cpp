@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -99,8 +99,9 @@ std::vector<MemBin> StrategyValidator::Optimize(std::vector<MemBlock>& memBlocks
                     }
                     case (MemBlockStrategyType::MultiAxisPacking):
                     {
-                        // If overlapping on both X and Y then invalid
-                        if (B1Left <= B2Right && B1Right >= B2Left &&
+                        // If overlapping on both X and Y then invalid. The X axis end is exclusive, so blocks
+                        // that only touch do not overlap
+                        if (B1Left < B2Right && B1Right > B2Left &&
                             B1Top <= B2Bottom && B1Bottom >= B2Top)
                         {
                             // Condition #3: two Memblocks overlap on both the X and Y axis
@@ -0,0 +1,103 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <backendsCommon/memoryOptimizerStrategyLibrary/strategies/MultiAxisBestFit.hpp>
+#include <backendsCommon/memoryOptimizerStrategyLibrary/strategies/SingleAxisPriorityList.hpp>
+#include <backendsCommon/memoryOptimizerStrategyLibrary/strategies/StrategyValidator.hpp>
+#include "TestMemBlocks.hpp"
+
+#include <doctest/doctest.h>
+#include <vector>
+
+using namespace armnn;
+
+TEST_SUITE("MultiAxisBestFitTestSuite")
+{
+    TEST_CASE("MultiAxisBestFitTest")
+    {
+        std::vector<MemBlock> memBlocks = fsrcnn;
+
+        auto multiAxisBestFit = std::make_shared<MultiAxisBestFit>();
+
+        CHECK_EQ(multiAxisBestFit->GetName(), std::string("MultiAxisBestFit"));
+        CHECK_EQ(multiAxisBestFit->GetMemBlockStrategyType(), MemBlockStrategyType::MultiAxisPacking);
+
+        StrategyValidator validator;
+        validator.SetStrategy(multiAxisBestFit);
+
+        std::vector<MemBin> memBins;
+
+        CHECK_NOTHROW(memBins = validator.Optimize(memBlocks));
+        REQUIRE(memBins.size() == 1);
+        CHECK(memBins[0].m_MemBlocks.size() == memBlocks.size());
+
+        // Packing in both axes can never need more memory than packing in time only
+        std::vector<MemBlock> singleAxisBlocks = fsrcnn;
+        size_t singleAxisSize = 0;
+        for (auto memBin : SingleAxisPriorityList().Optimize(singleAxisBlocks))
+        {
+            singleAxisSize += memBin.m_MemSize;
+        }
+
+        CHECK(memBins[0].m_MemSize >= GetMinPossibleMemorySize(memBlocks));
+        CHECK(memBins[0].m_MemSize <= singleAxisSize);
+    }
+
+    TEST_CASE("MultiAxisBestFitReusesGaps")
+    {
+        // Blocks 1 and 3 are freed before block 5 starts, leaving two gaps between the long lived blocks 0, 2 and 4.
+        // Block 5 fits into both and goes into the tighter one, left by block 3.
+        std::vector<MemBlock> memBlocks;
+        memBlocks.emplace_back(0, 9, 512, 0, 0);
+        memBlocks.emplace_back(0, 3, 384, 0, 1);
+        memBlocks.emplace_back(0, 9, 320, 0, 2);
+        memBlocks.emplace_back(0, 3, 192, 0, 3);
+        memBlocks.emplace_back(0, 9, 160, 0, 4);
+        memBlocks.emplace_back(4, 9, 150, 0, 5);
+
+        auto multiAxisBestFit = std::make_shared<MultiAxisBestFit>();
+        StrategyValidator validator;
+        validator.SetStrategy(multiAxisBestFit);
+
+        std::vector<MemBin> memBins;
+        CHECK_NOTHROW(memBins = validator.Optimize(memBlocks));
+        REQUIRE(memBins.size() == 1);
+
+        CHECK(memBlocks[0].m_Offset == 0);
+        CHECK(memBlocks[1].m_Offset == 512);
+        CHECK(memBlocks[2].m_Offset == 896);
+        CHECK(memBlocks[3].m_Offset == 1216);
+        CHECK(memBlocks[4].m_Offset == 1408);
+        CHECK(memBlocks[5].m_Offset == 1216);
+        CHECK(memBins[0].m_MemSize == 1568);
+    }
+
+    TEST_CASE("MultiAxisBestFitAlignsOffsets")
+    {
+        std::vector<MemBlock> memBlocks;
+        memBlocks.emplace_back(0, 2, 100, 0, 0);
+        memBlocks.emplace_back(1, 3, 30, 0, 1);
+        memBlocks.emplace_back(2, 4, 10, 0, 2);
+
+        auto multiAxisBestFit = std::make_shared<MultiAxisBestFit>(16);
+        StrategyValidator validator;
+        validator.SetStrategy(multiAxisBestFit);
+
+        std::vector<MemBin> memBins;
+        CHECK_NOTHROW(memBins = validator.Optimize(memBlocks));
+        REQUIRE(memBins.size() == 1);
+
+        CHECK(memBlocks[0].m_Offset == 0);
+        CHECK(memBlocks[1].m_Offset == 112);
+        CHECK(memBlocks[2].m_Offset == 144);
+        CHECK(memBins[0].m_MemSize == 154);
+    }
+
+    TEST_CASE("MultiAxisBestFitNoBlocks")
+    {
+        std::vector<MemBlock> memBlocks;
+        CHECK(MultiAxisBestFit().Optimize(memBlocks).empty());
+    }
+}
@@ -1,9 +1,10 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
+#pragma once
 
-size_t GetMinPossibleMemorySize(const std::vector<armnn::MemBlock>& blocks)
+inline size_t GetMinPossibleMemorySize(const std::vector<armnn::MemBlock>& blocks)
 {
     unsigned int maxLifetime = 0;
     for (auto& block: blocks)
@@ -24,7 +25,7 @@ size_t GetMinPossibleMemorySize(const std::vector<armnn::MemBlock>& blocks)
 }
 
 // Generated from fsrcnn_720p.tflite
-std::vector<armnn::MemBlock> fsrcnn
+inline std::vector<armnn::MemBlock> fsrcnn
 {
         { 0, 1, 691200, 0, 0 },
         { 1, 3, 7372800, 0, 1 },
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -123,6 +123,21 @@ TEST_CASE("MemoryOptimizerStrategyValidatorTestOverlapXAndY")
     CHECK_THROWS(validatorMulti.Optimize(memBlocks));
 }
 
+TEST_CASE("MemoryOptimizerStrategyValidatorTestTouchingX")
+{
+    // Blocks that are alive at the same time and end exactly where the next one starts do not overlap
+    std::vector<MemBlock> memBlocks;
+    memBlocks.reserve(3);
+    memBlocks.push_back(MemBlock(0, 5, 20, 0, 0));
+    memBlocks.push_back(MemBlock(0, 5, 10, 20, 1));
+    memBlocks.push_back(MemBlock(0, 5, 15, 30, 2));
+
+    auto ptrMulti = std::make_shared<TestMemoryOptimizerStrategy>(MemBlockStrategyType::MultiAxisPacking);
+    StrategyValidator validatorMulti;
+    validatorMulti.SetStrategy(ptrMulti);
+    CHECK_NOTHROW(validatorMulti.Optimize(memBlocks));
+}
+
 TEST_CASE("MemoryOptimizerStrategyValidatorTestOverlapY")
 {
     // create a few memory blocks
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -8,6 +8,7 @@
 #include <armnn/BackendRegistry.hpp>
 
 #include <armnn/backends/IMemoryOptimizerStrategy.hpp>
+#include <backendsCommon/memoryOptimizerStrategyLibrary/MemoryOptimizerStrategyLibrary.hpp>
 
 #if defined(ARMNNREF_ENABLED)
 #include <reference/RefBackend.hpp>
@@ -71,6 +72,26 @@ TEST_CASE("RefCustomMemoryOptimizerStrategyTest")
 
 }
 
+TEST_CASE("RefLibraryMemoryOptimizerStrategyTest")
+{
+    using namespace armnn;
+
+    // Strategies from the library can be given to the runtime like any custom strategy
+    IRuntime::CreationOptions options;
+    std::shared_ptr<IMemoryOptimizerStrategy> multiAxisBestFit = GetMemoryOptimizerStrategy("MultiAxisBestFit");
+    REQUIRE(multiAxisBestFit);
+    options.m_MemoryOptimizerStrategyMap = {{"CpuRef", multiAxisBestFit}};
+    IRuntimePtr run = IRuntime::Create(options);
+
+    CHECK(BackendRegistryInstance().GetMemoryOptimizerStrategies().size() == 1);
+    auto optimizerStrategy = BackendRegistryInstance().GetMemoryOptimizerStrategies().at(RefBackend::GetIdStatic());
+    CHECK(optimizerStrategy->GetName() == std::string("MultiAxisBestFit"));
+    CHECK(optimizerStrategy->GetMemBlockStrategyType() == MemBlockStrategyType::MultiAxisPacking);
+
+    BackendRegistryInstance().DeregisterMemoryOptimizerStrategy(RefBackend::GetIdStatic());
+    CHECK(BackendRegistryInstance().GetMemoryOptimizerStrategies().empty());
+}
+
 TEST_CASE("CpuRefSetMemoryOptimizerStrategyTest")
 {
     using namespace armnn;
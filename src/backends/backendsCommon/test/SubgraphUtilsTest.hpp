@@ -81,9 +81,11 @@ armnn::INetworkPtr CreateReshapeInOutNetwork(const armnn::TensorShape& inputShap
     TensorInfo outputTensorInfo(outputShape, ArmnnType, qScale, qOffset);
 
     IConnectableLayer* activation0 = network->AddActivationLayer(ActivationFunction::ReLu, "act0");
+    // The consumers of the reshape use different functions, so they are not merged as common subexpressions.
     IConnectableLayer* activation1 = network->AddActivationLayer(ActivationFunction::ReLu, "act1");
-    IConnectableLayer* activation2 = network->AddActivationLayer(ActivationFunction::ReLu, "act2");
-    IConnectableLayer* activation3 = network->AddActivationLayer(ActivationFunction::ReLu, "act3");
+    IConnectableLayer* activation2 = network->AddActivationLayer(ActivationFunction::Abs, "act2");
+    IConnectableLayer* activation3 = network->AddActivationLayer(ActivationDescriptor(ActivationFunction::BoundedReLu,
+                                                                                      10.0f), "act3");
     IConnectableLayer* reshape = network->AddReshapeLayer(descriptor, "reshape");
 
     IConnectableLayer* input   = network->AddInputLayer(0, "input");
@@ -1,15 +1,17 @@
 //
-// Copyright © 2022-2025 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022-2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include "RefBackend.hpp"
 #include "RefBackendId.hpp"
+#include "RefBackendOptimizationUtils.hpp"
 #include "RefWorkloadFactory.hpp"
 #include "RefLayerSupport.hpp"
 #include "RefTensorHandleFactory.hpp"
 
 #include <armnn/BackendRegistry.hpp>
+#include <armnn/Logging.hpp>
 #include <armnn/backends/IBackendContext.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
 #include <armnn/utility/PolymorphicDowncast.hpp>
@@ -19,6 +21,34 @@
 namespace armnn
 {
 
+namespace
+{
+
+// The memory managers of CpuRef allocate their arenas through the custom allocator registered for CpuRef, if any.
+// Huge pages can be requested with the "HugePages" model option of CpuRef.
+std::unique_ptr<RefMemoryManager> CreateRefMemoryManager(const ModelOptions& modelOptions)
+{
+    bool useHugePages = false;
+    ParseOptions(modelOptions, RefBackend::GetIdStatic(), [&](std::string name, const BackendOptions::Var& value)
+    {
+        if (name == "HugePages")
+        {
+            useHugePages = ParseBooleanBackendOption(value, false);
+        }
+    });
+
+    std::shared_ptr<ICustomAllocator> allocator;
+    auto allocators = BackendRegistryInstance().GetAllocators();
+    auto it = allocators.find(RefBackend::GetIdStatic());
+    if (it != allocators.end())
+    {
+        allocator = it->second;
+    }
+    return std::make_unique<RefMemoryManager>(allocator, useHugePages);
+}
+
+} // anonymous namespace
+
 const BackendId& RefBackend::GetIdStatic()
 {
     static const BackendId s_Id{RefBackendId()};
@@ -31,10 +61,23 @@ IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     return std::make_unique<RefWorkloadFactory>(PolymorphicPointerDowncast<RefMemoryManager>(memoryManager));
 }
 
+// The model options of CpuRef only affect OptimizeSubgraphView, so they are not needed by the workload factory.
+IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
+    const IBackendInternal::IMemoryManagerSharedPtr& memoryManager, const ModelOptions&) const
+{
+    return CreateWorkloadFactory(memoryManager);
+}
+
 IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry) const
 {
-    auto memoryManager = std::make_shared<RefMemoryManager>();
+    return CreateWorkloadFactory(tensorHandleFactoryRegistry, ModelOptions{});
+}
+
+IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
+    class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry, const ModelOptions& modelOptions) const
+{
+    std::shared_ptr<RefMemoryManager> memoryManager = CreateRefMemoryManager(modelOptions);
 
     tensorHandleFactoryRegistry.RegisterMemoryManager(memoryManager);
 
@@ -60,7 +103,7 @@ IBackendInternal::IBackendProfilingContextPtr RefBackend::CreateBackendProfiling
 
 IBackendInternal::IMemoryManagerUniquePtr RefBackend::CreateMemoryManager() const
 {
-    return std::make_unique<RefMemoryManager>();
+    return CreateRefMemoryManager(ModelOptions{});
 }
 
 IBackendInternal::ILayerSupportSharedPtr RefBackend::GetLayerSupport() const
@@ -74,6 +117,16 @@ OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph,
 {
     OptimizationViews optimizationViews(modelOptions);
 
+    // Elementwise fusion can be turned off with the "FuseElementwise" model option of CpuRef.
+    bool fuseElementwise = true;
+    ParseOptions(modelOptions, GetIdStatic(), [&](std::string name, const BackendOptions::Var& value)
+    {
+        if (name == "FuseElementwise")
+        {
+            fuseElementwise = ParseBooleanBackendOption(value, true);
+        }
+    });
+
     auto it = subgraph.end();
     std::map<LayerGuid, Layer*> untouched;
 
@@ -163,6 +216,15 @@ OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph,
             }
         }
 
+        // Fuse chains of elementwise layers ending at this layer into a single pass over the output.
+        if (fuseElementwise &&
+            (base.GetType() == LayerType::Activation ||
+             base.GetType() == LayerType::ElementwiseBinary ||
+             base.GetType() == LayerType::ElementwiseUnary))
+        {
+            FuseElementwiseChain(base, untouched, optimizationViews);
+        }
+
         // Remove Reshape where possible
         if (base.GetType() == LayerType::Reshape)
         {
@@ -190,7 +252,7 @@ std::vector<ITensorHandleFactory::FactoryId> RefBackend::GetHandleFactoryPrefere
 
 void RefBackend::RegisterTensorHandleFactories(class TensorHandleFactoryRegistry& registry)
 {
-    auto memoryManager = std::make_shared<RefMemoryManager>();
+    std::shared_ptr<RefMemoryManager> memoryManager = CreateRefMemoryManager(ModelOptions{});
 
     registry.RegisterMemoryManager(memoryManager);
 
@@ -207,4 +269,20 @@ std::unique_ptr<ICustomAllocator> RefBackend::GetDefaultAllocator() const
     return std::make_unique<DefaultAllocator>();
 }
 
+bool RefBackend::UseCustomMemoryAllocator(std::shared_ptr<ICustomAllocator> allocator,
+                                          armnn::Optional<std::string&> errMsg)
+{
+    // The reference workloads access tensors directly, so the memory must be addressable by the CPU
+    if (allocator->GetMemorySourceType() != MemorySource::Malloc)
+    {
+        if (errMsg)
+        {
+            errMsg.value() = "CpuRef can only use custom allocators of MemorySource::Malloc.";
+        }
+        return false;
+    }
+    ARMNN_LOG(info) << "Using Custom Allocator for RefBackend";
+    return true;
+}
+
 } // namespace armnn
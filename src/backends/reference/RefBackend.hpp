@@ -1,5 +1,5 @@
 //
-// Copyright © 2022-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
@@ -41,9 +41,17 @@ public:
     IBackendInternal::IWorkloadFactoryPtr CreateWorkloadFactory(
         const IBackendInternal::IMemoryManagerSharedPtr& memoryManager = nullptr) const override;
 
+    IBackendInternal::IWorkloadFactoryPtr CreateWorkloadFactory(
+        const IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+        const ModelOptions& modelOptions) const override;
+
     IBackendInternal::IWorkloadFactoryPtr CreateWorkloadFactory(
         class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry) const override;
 
+    IBackendInternal::IWorkloadFactoryPtr CreateWorkloadFactory(
+        class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry,
+        const ModelOptions& modelOptions) const override;
+
     IBackendInternal::IBackendContextPtr CreateBackendContext(const IRuntime::CreationOptions&) const override;
 
     IBackendInternal::IBackendProfilingContextPtr CreateBackendProfilingContext(
@@ -64,6 +72,9 @@ public:
     };
 
     std::unique_ptr<ICustomAllocator> GetDefaultAllocator() const override;
+
+    bool UseCustomMemoryAllocator(std::shared_ptr<ICustomAllocator> allocator,
+                                  armnn::Optional<std::string&> errMsg) override;
 };
 
 } // namespace armnn
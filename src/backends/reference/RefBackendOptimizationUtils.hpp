@@ -0,0 +1,225 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "workloads/FusedElementwise.hpp"
+
+#include <Layer.hpp>
+#include <LayersFwd.hpp>
+#include <armnn/backends/OptimizationViews.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+/// A chain of elementwise layers that can be replaced by a single FusedKernelType::Elementwise FusedLayer.
+struct ElementwiseFusionGroup
+{
+    std::vector<Layer*> m_Layers;           ///< Layers of the group in program order, the root last.
+    std::vector<IInputSlot*> m_Inputs;      ///< Input slots of the group fed from outside of it, in fused input order.
+    std::vector<FusedElementwiseOperation> m_Program;
+};
+
+/// Returns true if the layer can be part of a fused elementwise program whose output has the given shape.
+inline bool IsElementwiseFusionCandidate(const Layer& layer, const TensorShape& outputShape)
+{
+    if (layer.GetNumOutputSlots() != 1 || layer.GetAdditionalInformation<ActivationDescriptor>() != nullptr)
+    {
+        return false;
+    }
+    const TensorInfo& outputInfo = layer.GetOutputSlot(0).GetTensorInfo();
+    if (outputInfo.GetDataType() != DataType::Float32 || outputInfo.GetShape() != outputShape)
+    {
+        return false;
+    }
+
+    switch (layer.GetType())
+    {
+        case LayerType::Activation:
+        case LayerType::ElementwiseBinary:
+            return true;
+        case LayerType::ElementwiseUnary:
+            return PolymorphicDowncast<const ElementwiseUnaryLayer*>(&layer)->GetParameters().m_Operation !=
+                   UnaryOperation::LogicalNot;
+        default:
+            return false;
+    }
+}
+
+/// Returns true if the input slot can be read directly by a fused elementwise program with the given output shape.
+/// A Reshape feeding the input may itself be removed by RemoveReshapeLayer, in which case the fused layer reads the
+/// tensor before the Reshape, so both shapes must be supported.
+inline bool IsElementwiseFusionInput(const InputSlot& inputSlot, const TensorShape& outputShape)
+{
+    const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+    if (!connection)
+    {
+        return false;
+    }
+    const Layer& producer = connection->GetOwningLayer();
+    if (producer.GetType() == LayerType::Reshape && !IsElementwiseFusionInput(producer.GetInputSlot(0), outputShape))
+    {
+        return false;
+    }
+    const TensorInfo& info = inputSlot.GetTensorInfo();
+    return info.GetDataType() == DataType::Float32 && IsFusedElementwiseInputSupported(info.GetShape(), outputShape);
+}
+
+/// Returns true if the producer of the input slot can be absorbed into the fused program: it must be a candidate that
+/// has not been claimed by another optimization and whose only consumer is the input slot.
+inline bool CanAbsorbElementwiseProducer(const InputSlot& inputSlot,
+                                         const TensorShape& outputShape,
+                                         const std::map<LayerGuid, Layer*>& untouched)
+{
+    const OutputSlot* connection = inputSlot.GetConnectedOutputSlot();
+    if (!connection || connection->GetNumConnections() != 1)
+    {
+        return false;
+    }
+    const Layer& producer = connection->GetOwningLayer();
+    if (untouched.find(producer.GetGuid()) == untouched.end() || !IsElementwiseFusionCandidate(producer, outputShape))
+    {
+        return false;
+    }
+    for (unsigned int i = 0; i < producer.GetNumInputSlots(); ++i)
+    {
+        const InputSlot& producerInput = producer.GetInputSlot(i);
+        if (!IsElementwiseFusionInput(producerInput, outputShape) &&
+            !CanAbsorbElementwiseProducer(producerInput, outputShape, untouched))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Collects the layers computing the output of the layer in post-order, together with the input slots the chain reads
+/// from outside of it.
+inline void CollectElementwiseChain(Layer& layer,
+                                    const std::map<LayerGuid, Layer*>& untouched,
+                                    ElementwiseFusionGroup& group)
+{
+    const TensorShape& outputShape = layer.GetOutputSlot(0).GetTensorInfo().GetShape();
+    for (auto it = layer.BeginInputSlots(); it != layer.EndInputSlots(); ++it)
+    {
+        if (CanAbsorbElementwiseProducer(*it, outputShape, untouched))
+        {
+            CollectElementwiseChain(it->GetConnectedOutputSlot()->GetOwningLayer(), untouched, group);
+        }
+        else
+        {
+            group.m_Inputs.push_back(&(*it));
+        }
+    }
+    group.m_Layers.push_back(&layer);
+}
+
+/// Builds the program of the collected chain: operands index the inputs of the group first, then the results of
+/// earlier operations.
+inline void BuildElementwiseProgram(ElementwiseFusionGroup& group)
+{
+    const unsigned int numInputs = static_cast<unsigned int>(group.m_Inputs.size());
+    std::map<const IInputSlot*, unsigned int> inputIndices;
+    for (unsigned int i = 0; i < numInputs; ++i)
+    {
+        inputIndices[group.m_Inputs[i]] = i;
+    }
+    std::map<const Layer*, unsigned int> resultIndices;
+
+    for (Layer* layer : group.m_Layers)
+    {
+        std::vector<unsigned int> operands;
+        for (auto it = layer->BeginInputSlots(); it != layer->EndInputSlots(); ++it)
+        {
+            auto input = inputIndices.find(&(*it));
+            operands.push_back(input != inputIndices.end() ?
+                               input->second :
+                               numInputs + resultIndices.at(&it->GetConnectedOutputSlot()->GetOwningLayer()));
+        }
+
+        FusedElementwiseOperation operation;
+        operation.m_LayerType     = layer->GetType();
+        operation.m_FirstOperand  = operands[0];
+        operation.m_SecondOperand = operands.size() > 1 ? operands[1] : 0;
+        switch (layer->GetType())
+        {
+            case LayerType::Activation:
+                operation.m_Activation = PolymorphicDowncast<ActivationLayer*>(layer)->GetParameters();
+                break;
+            case LayerType::ElementwiseBinary:
+                operation.m_Binary = PolymorphicDowncast<ElementwiseBinaryLayer*>(layer)->GetParameters();
+                break;
+            default:
+                operation.m_Unary = PolymorphicDowncast<ElementwiseUnaryLayer*>(layer)->GetParameters();
+                break;
+        }
+
+        resultIndices[layer] = static_cast<unsigned int>(group.m_Program.size());
+        group.m_Program.push_back(operation);
+    }
+}
+
+/// Replaces the chain of elementwise layers ending at the root with a single fused layer, if the chain has at least
+/// two layers. Returns true if a substitution was added; the fused layers are then removed from untouched.
+inline bool FuseElementwiseChain(Layer& root,
+                                 std::map<LayerGuid, Layer*>& untouched,
+                                 OptimizationViews& optimizationViews)
+{
+    if (root.GetNumOutputSlots() != 1 || untouched.find(root.GetGuid()) == untouched.end())
+    {
+        return false;
+    }
+    const TensorShape& outputShape = root.GetOutputSlot(0).GetTensorInfo().GetShape();
+    if (!IsElementwiseFusionCandidate(root, outputShape))
+    {
+        return false;
+    }
+
+    // A layer of the chain is either absorbed or read from the fused layer, so every input of the root must qualify.
+    for (auto it = root.BeginInputSlots(); it != root.EndInputSlots(); ++it)
+    {
+        if (!IsElementwiseFusionInput(*it, outputShape) && !CanAbsorbElementwiseProducer(*it, outputShape, untouched))
+        {
+            return false;
+        }
+    }
+
+    ElementwiseFusionGroup group;
+    CollectElementwiseChain(root, untouched, group);
+    if (group.m_Layers.size() < 2)
+    {
+        return false;
+    }
+    BuildElementwiseProgram(group);
+
+    FusedDescriptor descriptor(static_cast<unsigned int>(group.m_Inputs.size()), 1u, FusedKernelType::Elementwise);
+    descriptor.m_ElementwiseProgram = group.m_Program;
+
+    std::string fusedName = "fused";
+    std::list<IConnectableLayer*> originalLayers;
+    for (Layer* layer : group.m_Layers)
+    {
+        fusedName += std::string("-") + layer->GetName();
+        originalLayers.push_back(layer);
+        untouched.erase(layer->GetGuid());
+    }
+
+    IConnectableLayer* fusedLayer = optimizationViews.GetINetwork()->AddFusedLayer(descriptor, fusedName.c_str());
+
+    SubgraphView substitutionSubgraph(std::move(originalLayers),
+                                      std::move(group.m_Inputs),
+                                      { &root.GetOutputSlot(0) });
+    SubgraphView replacementSubgraph(fusedLayer);
+    optimizationViews.AddSubstitution({ substitutionSubgraph, replacementSubgraph });
+    return true;
+}
+
+} // namespace armnn
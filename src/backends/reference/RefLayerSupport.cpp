@@ -4,6 +4,7 @@
 //
 
 #include "RefLayerSupport.hpp"
+#include "workloads/FusedElementwise.hpp"
 
 #include <armnn/TypesUtils.hpp>
 #include <armnn/Types.hpp>
@@ -243,6 +244,23 @@ bool RefLayerSupport::IsLayerSupported(const LayerType& type,
                                              infos[3],
                                              *(PolymorphicDowncast<const FullyConnectedDescriptor*>(&descriptor)),
                                              reasonIfUnsupported);
+        case LayerType::Fused:
+        {
+            auto fusedDescriptor = *(PolymorphicDowncast<const FusedDescriptor*>(&descriptor));
+            if (fusedDescriptor.m_NumInputSlots + fusedDescriptor.m_NumOutputSlots != infos.size())
+            {
+                throw InvalidArgumentException("Invalid number of FusedLayer TensorInfos.");
+            }
+
+            auto it = infos.begin() + numeric_cast<TensorInfo::DifferenceType>(fusedDescriptor.m_NumInputSlots);
+            std::vector<TensorInfo> inputInfos(infos.begin(), it);
+            std::vector<TensorInfo> outputInfos(it, infos.end());
+
+            return IsFusedSupported({inputInfos.begin(), inputInfos.end()},
+                                    {outputInfos.begin(), outputInfos.end()},
+                                    fusedDescriptor,
+                                    reasonIfUnsupported);
+        }
         case LayerType::Gather:
             return IsGatherSupported(infos[0],
                                      infos[1],
@@ -1531,6 +1549,25 @@ bool RefLayerSupport::IsFloorSupported(const TensorInfo& input,
     return supported;
 }
 
+bool RefLayerSupport::IsFusedSupported(const std::vector<std::reference_wrapper<TensorInfo>>& inputs,
+                                       const std::vector<std::reference_wrapper<TensorInfo>>& outputs,
+                                       const FusedDescriptor& descriptor,
+                                       Optional<std::string&> reasonIfUnsupported) const
+{
+    if (outputs.size() != 1)
+    {
+        if (reasonIfUnsupported)
+        {
+            reasonIfUnsupported.value() = "Reference Fused: only a single output is supported.";
+        }
+        return false;
+    }
+    return IsFusedElementwiseSupported({inputs.begin(), inputs.end()},
+                                       outputs[0].get(),
+                                       descriptor,
+                                       reasonIfUnsupported);
+}
+
 bool RefLayerSupport::IsFullyConnectedSupported(const TensorInfo& input,
                                                 const TensorInfo& output,
                                                 const TensorInfo& weights,
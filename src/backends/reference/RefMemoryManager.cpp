@@ -1,5 +1,5 @@
 //
-// Copyright © 2017, 2024 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024, 2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include "RefMemoryManager.hpp"
@@ -7,15 +7,47 @@
 #include <armnn/Exceptions.hpp>
 
 #include <algorithm>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 namespace armnn
 {
 
-RefMemoryManager::RefMemoryManager()
+namespace
+{
+
+// Size of a transparent huge page on the 4KB page kernels of x86-64 and AArch64
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+size_t AlignUp(size_t size, size_t alignment)
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+// Lay the pools out back to back, each one starting on an aligned offset. Empty pools still get their own
+// address, like the separate allocations they replace.
+size_t PoolFootprint(const RefMemoryManager::Pool& pool)
+{
+    return AlignUp(std::max(size_t(pool.GetSize()), size_t(1)), RefMemoryManager::s_Alignment);
+}
+
+} // anonymous namespace
+
+RefMemoryManager::RefMemoryManager(std::shared_ptr<ICustomAllocator> allocator, bool useHugePages)
+    : m_Allocator(std::move(allocator))
+    , m_UseHugePages(useHugePages)
 {}
 
 RefMemoryManager::~RefMemoryManager()
-{}
+{
+    if (m_Arena)
+    {
+        FreeArena();
+    }
+}
 
 RefMemoryManager::Pool* RefMemoryManager::Manage(unsigned int numBytes)
 {
@@ -46,33 +78,91 @@ void* RefMemoryManager::GetPointer(RefMemoryManager::Pool* pool)
 
 void RefMemoryManager::Acquire()
 {
-    for (Pool &pool: m_Pools)
+    ARMNN_THROW_MSG_IF_FALSE(!m_Arena, RuntimeException,
+                             "RefMemoryManager::Acquire() called when memory already acquired");
+
+    size_t arenaSize = GetManagedMemorySize();
+    if (arenaSize == 0)
+    {
+        return;
+    }
+
+    m_Arena = AllocateArena(arenaSize);
+    size_t offset = 0;
+    for (Pool& pool : m_Pools)
     {
-         pool.Acquire();
+        pool.Acquire(static_cast<char*>(m_Arena) + offset);
+        offset += PoolFootprint(pool);
     }
 }
 
+size_t RefMemoryManager::GetManagedMemorySize() const
+{
+    size_t size = 0;
+    for (const Pool& pool : m_Pools)
+    {
+        size += PoolFootprint(pool);
+    }
+    return size;
+}
+
 void RefMemoryManager::Release()
 {
     for (Pool &pool: m_Pools)
     {
          pool.Release();
     }
+    if (m_Arena)
+    {
+        FreeArena();
+    }
 }
 
-RefMemoryManager::Pool::Pool(unsigned int numBytes)
-    : m_Size(numBytes),
-      m_Pointer(nullptr)
-{}
+void* RefMemoryManager::AllocateArena(size_t size)
+{
+    m_ArenaSize = size;
+    m_ArenaAlignment = s_Alignment;
+    if (m_Allocator)
+    {
+        return m_Allocator->allocate(m_ArenaSize, m_ArenaAlignment);
+    }
+
+    if (m_UseHugePages && size >= hugePageSize)
+    {
+        // Cover whole huge pages only, so that the advice cannot affect memory outside the arena
+        m_ArenaAlignment = hugePageSize;
+        m_ArenaSize = AlignUp(size, hugePageSize);
+    }
+    void* arena = ::operator new(m_ArenaSize, std::align_val_t(m_ArenaAlignment));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (m_ArenaAlignment == hugePageSize)
+    {
+        // Only a hint: the arena is still usable if the kernel does not support transparent huge pages
+        madvise(arena, m_ArenaSize, MADV_HUGEPAGE);
+    }
+#endif
+    return arena;
+}
 
-RefMemoryManager::Pool::~Pool()
+void RefMemoryManager::FreeArena()
 {
-    if (m_Pointer)
+    if (m_Allocator)
+    {
+        m_Allocator->free(m_Arena);
+    }
+    else
     {
-        Release();
+        ::operator delete(m_Arena, std::align_val_t(m_ArenaAlignment));
     }
+    m_Arena = nullptr;
+    m_ArenaSize = 0;
 }
 
+RefMemoryManager::Pool::Pool(unsigned int numBytes)
+    : m_Size(numBytes),
+      m_Pointer(nullptr)
+{}
+
 void* RefMemoryManager::Pool::GetPointer()
 {
     ARMNN_THROW_MSG_IF_FALSE(m_Pointer, RuntimeException,
@@ -87,18 +177,17 @@ void RefMemoryManager::Pool::Reserve(unsigned int numBytes)
     m_Size = std::max(m_Size, numBytes);
 }
 
-void RefMemoryManager::Pool::Acquire()
+void RefMemoryManager::Pool::Acquire(void* pointer)
 {
     ARMNN_THROW_MSG_IF_FALSE(!m_Pointer, RuntimeException,
                              "RefMemoryManager::Pool::Acquire() called when memory already acquired");
-    m_Pointer = ::operator new(size_t(m_Size));
+    m_Pointer = pointer;
 }
 
 void RefMemoryManager::Pool::Release()
 {
     ARMNN_THROW_MSG_IF_FALSE(m_Pointer, RuntimeException,
                              "RefMemoryManager::Pool::Release() called when memory not acquired");
-    ::operator delete(m_Pointer);
     m_Pointer = nullptr;
 }
 
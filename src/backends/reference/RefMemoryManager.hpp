@@ -1,22 +1,27 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #pragma once
 
+#include <armnn/backends/ICustomAllocator.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
 
 #include <forward_list>
+#include <memory>
 #include <vector>
 
 namespace armnn
 {
 
-// An implementation of IMemoryManager to be used with RefTensorHandle
+// An implementation of IMemoryManager to be used with RefTensorHandle.
+// All the pools are placed at fixed offsets inside a single arena, which is allocated by Acquire and freed by Release.
 class RefMemoryManager : public IMemoryManager
 {
 public:
-    RefMemoryManager();
+    /// The arena is allocated through allocator when one is given. Otherwise, with useHugePages, arenas of at least
+    /// one huge page are aligned to, and advised to be backed by, transparent huge pages where the OS supports them.
+    RefMemoryManager(std::shared_ptr<ICustomAllocator> allocator = nullptr, bool useHugePages = false);
     virtual ~RefMemoryManager();
 
     class Pool;
@@ -30,19 +35,29 @@ public:
     void Acquire() override;
     void Release() override;
 
+    /// Returns the size in bytes of the arena that Acquire allocates for the pools, before rounding it to huge pages.
+    size_t GetManagedMemorySize() const override;
+
+    /// Returns the size in bytes of the arena holding all the pools, or 0 when the memory is not acquired.
+    size_t GetArenaSize() const { return m_ArenaSize; }
+
+    /// Alignment in bytes of every pool in the arena.
+    static constexpr size_t s_Alignment = 64;
+
     class Pool
     {
     public:
         Pool(unsigned int numBytes);
-        ~Pool();
 
-        void Acquire();
+        void Acquire(void* pointer);
         void Release();
 
         void* GetPointer();
 
         void Reserve(unsigned int numBytes);
 
+        unsigned int GetSize() const { return m_Size; }
+
     private:
         unsigned int m_Size;
         void* m_Pointer;
@@ -52,8 +67,17 @@ private:
     RefMemoryManager(const RefMemoryManager&) = delete; // Noncopyable
     RefMemoryManager& operator=(const RefMemoryManager&) = delete; // Noncopyable
 
+    void* AllocateArena(size_t size);
+    void FreeArena();
+
     std::forward_list<Pool> m_Pools;
     std::vector<Pool*> m_FreePools;
+
+    std::shared_ptr<ICustomAllocator> m_Allocator;
+    bool m_UseHugePages;
+    void* m_Arena = nullptr;
+    size_t m_ArenaSize = 0;
+    size_t m_ArenaAlignment = s_Alignment;
 };
 
 }
@@ -360,6 +360,15 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateWorkload(LayerType type,
                      = PolymorphicDowncast<const FullyConnectedQueueDescriptor*>(&descriptor);
             return std::make_unique<RefFullyConnectedWorkload>(*fullyConnectedQueueDescriptor, info);
         }
+        case LayerType::Fused:
+        {
+            auto fusedQueueDescriptor = PolymorphicDowncast<const FusedQueueDescriptor*>(&descriptor);
+            if (fusedQueueDescriptor->m_Parameters.m_FusedKernelType != FusedKernelType::Elementwise)
+            {
+                return nullptr;
+            }
+            return std::make_unique<RefFusedWorkload>(*fusedQueueDescriptor, info);
+        }
         case LayerType::Gather:
         {
             auto gatherQueueDescriptor = PolymorphicDowncast<const GatherQueueDescriptor*>(&descriptor);
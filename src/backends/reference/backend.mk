@@ -36,7 +36,10 @@ BACKEND_SOURCES := \
         workloads/ElementwiseFunction.cpp \
         workloads/Fill.cpp \
         workloads/FullyConnected.cpp \
+        workloads/FusedElementwise.cpp \
+        workloads/FusedLstm.cpp \
         workloads/Gather.cpp \
+        workloads/Gemm.cpp \
         workloads/InstanceNorm.cpp \
         workloads/LogSoftmax.cpp \
         workloads/Lstm.cpp \
@@ -74,6 +77,7 @@ BACKEND_SOURCES := \
         workloads/RefFakeQuantizationFloat32Workload.cpp \
         workloads/RefFillWorkload.cpp \
         workloads/RefFloorWorkload.cpp \
+        workloads/RefFusedWorkload.cpp \
         workloads/RefFullyConnectedWorkload.cpp \
         workloads/RefGatherNdWorkload.cpp \
         workloads/RefGatherWorkload.cpp \
@@ -151,6 +155,7 @@ BACKEND_TEST_SOURCES := \
         test/RefLayerTests.cpp \
         test/RefMemoryManagerTests.cpp \
         test/RefOptimizedNetworkTests.cpp \
+        test/RefPooling2dTests.cpp \
         test/RefRuntimeTests.cpp \
         test/RefTensorHandleTests.cpp
 else
@@ -1,8 +1,9 @@
 //
-// Copyright © 2022 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
+#include <backendsCommon/DefaultAllocator.hpp>
 #include <backendsCommon/TensorHandleFactoryRegistry.hpp>
 #include <reference/RefBackend.hpp>
 #include <reference/RefTensorHandleFactory.hpp>
@@ -37,4 +38,25 @@ TEST_CASE("RefCreateWorkloadFactoryMatchingImportFactoryId")
     CHECK((registry.GetMatchingImportFactoryId(RefTensorHandleFactory::GetIdStatic()) ==
            RefTensorHandleFactory::GetIdStatic()));
 }
+
+TEST_CASE("RefUseCustomMemoryAllocator")
+{
+    class DmaBufAllocator : public DefaultAllocator
+    {
+    public:
+        MemorySource GetMemorySourceType() override
+        {
+            return MemorySource::DmaBuf;
+        }
+    };
+
+    RefBackend refBackend;
+    std::string error;
+
+    // Only allocators of memory that the reference workloads can access directly are accepted
+    CHECK(refBackend.UseCustomMemoryAllocator(std::make_shared<DefaultAllocator>(), error));
+    CHECK(error.empty());
+    CHECK(!refBackend.UseCustomMemoryAllocator(std::make_shared<DmaBufAllocator>(), error));
+    CHECK(!error.empty());
+}
 }
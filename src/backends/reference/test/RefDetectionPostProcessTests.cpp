@@ -10,6 +10,9 @@
 
 #include <doctest/doctest.h>
 
+#include <numeric>
+#include <random>
+
 TEST_SUITE("RefDetectionPostProcess")
 {
 TEST_CASE("TopKSortTest")
@@ -69,6 +72,72 @@ TEST_CASE("NmsFunction")
     CHECK(result[2] == 5);
 }
 
+TEST_CASE("NmsFunctionMatchesExhaustiveNms")
+{
+    // Many small random boxes, most of them disjoint, with tied scores.
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> position(0.0f, 10.0f);
+    std::uniform_real_distribution<float> size(0.1f, 1.5f);
+    std::uniform_int_distribution<int> score(0, 20);
+
+    const unsigned int numBoxes = 500;
+    std::vector<float> boxCorners;
+    std::vector<float> scores;
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        float y = position(generator);
+        float x = position(generator);
+        boxCorners.insert(boxCorners.end(), { y, x, y + size(generator), x + size(generator) });
+        scores.push_back(static_cast<float>(score(generator)) / 20.0f);
+    }
+
+    const float scoreThreshold = 0.2f;
+    const float iouThreshold = 0.3f;
+    const unsigned int maxDetection = 200;
+
+    // Exhaustive NMS: every kept box suppresses all lower scored boxes it overlaps.
+    std::vector<unsigned int> candidates;
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        if (scores[i] >= scoreThreshold)
+        {
+            candidates.push_back(i);
+        }
+    }
+    std::vector<unsigned int> order(candidates.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<float> candidateScores;
+    for (unsigned int candidate : candidates)
+    {
+        candidateScores.push_back(scores[candidate]);
+    }
+    armnn::TopKSort(static_cast<unsigned int>(order.size()), order.data(), candidateScores.data(),
+                    static_cast<unsigned int>(order.size()));
+
+    std::vector<unsigned int> expected;
+    std::vector<bool> suppressed(candidates.size(), false);
+    for (unsigned int i = 0; i < order.size() && expected.size() < maxDetection; ++i)
+    {
+        if (suppressed[order[i]])
+        {
+            continue;
+        }
+        expected.push_back(candidates[order[i]]);
+        for (unsigned int j = i + 1; j < order.size(); ++j)
+        {
+            if (armnn::IntersectionOverUnion(&boxCorners[candidates[order[i]] * 4],
+                                             &boxCorners[candidates[order[j]] * 4]) > iouThreshold)
+            {
+                suppressed[order[j]] = true;
+            }
+        }
+    }
+
+    std::vector<unsigned int> result =
+        armnn::NonMaxSuppression(numBoxes, boxCorners, scores, scoreThreshold, maxDetection, iouThreshold);
+    CHECK(result == expected);
+}
+
 void DetectionPostProcessTestImpl(bool useRegularNms,
                                   const std::vector<float>& expectedDetectionBoxes,
                                   const std::vector<float>& expectedDetectionClasses,
@@ -1,12 +1,18 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include <reference/RefMemoryManager.hpp>
 
+#include <armnn/Exceptions.hpp>
+
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
 TEST_SUITE("RefMemoryManagerTests")
 {
 using namespace armnn;
@@ -49,4 +55,105 @@ TEST_CASE("ManageTwoThings")
     memoryManager.Release();
 }
 
+TEST_CASE("ManageThingsInOneArena")
+{
+    RefMemoryManager memoryManager;
+
+    Pool* pool1 = memoryManager.Manage(10);
+    Pool* pool2 = memoryManager.Manage(100);
+    Pool* pool3 = memoryManager.Manage(0);
+
+    // The size of the arena is known before it is allocated
+    CHECK(memoryManager.GetManagedMemorySize() == 256);
+    memoryManager.Acquire();
+
+    // Every pool starts on its own aligned offset in a single arena
+    auto p1 = reinterpret_cast<uintptr_t>(memoryManager.GetPointer(pool1));
+    auto p2 = reinterpret_cast<uintptr_t>(memoryManager.GetPointer(pool2));
+    auto p3 = reinterpret_cast<uintptr_t>(memoryManager.GetPointer(pool3));
+    CHECK(memoryManager.GetArenaSize() == 256);
+    for (uintptr_t p : { p1, p2, p3 })
+    {
+        CHECK(p % RefMemoryManager::s_Alignment == 0);
+    }
+    CHECK(p1 != p2);
+    CHECK(p1 != p3);
+    CHECK(p2 != p3);
+    const uintptr_t first = std::min({ p1, p2, p3 });
+    CHECK(std::max({ p1, p2, p3 }) - first < memoryManager.GetArenaSize());
+
+    memoryManager.Release();
+    CHECK(memoryManager.GetArenaSize() == 0);
+    CHECK_THROWS_AS(memoryManager.GetPointer(pool1), RuntimeException);
+
+    // The memory can be acquired again after it has been released
+    memoryManager.Acquire();
+    CHECK(memoryManager.GetPointer(pool1) != nullptr);
+    memoryManager.Release();
+}
+
+class CountingAllocator : public ICustomAllocator
+{
+public:
+    void* allocate(size_t size, size_t alignment) override
+    {
+        ++m_NumAllocations;
+        m_LastSize = size;
+        return std::aligned_alloc(alignment, size);
+    }
+
+    void free(void* ptr) override
+    {
+        ++m_NumFrees;
+        std::free(ptr);
+    }
+
+    MemorySource GetMemorySourceType() override
+    {
+        return MemorySource::Malloc;
+    }
+
+    unsigned int m_NumAllocations = 0;
+    unsigned int m_NumFrees = 0;
+    size_t m_LastSize = 0;
+};
+
+TEST_CASE("ManageThingsWithCustomAllocator")
+{
+    auto allocator = std::make_shared<CountingAllocator>();
+    RefMemoryManager memoryManager(allocator);
+
+    Pool* pool1 = memoryManager.Manage(64);
+    Pool* pool2 = memoryManager.Manage(65);
+    Pool* pool3 = memoryManager.Manage(1);
+
+    for (unsigned int i = 1; i <= 3; ++i)
+    {
+        memoryManager.Acquire();
+        CHECK(allocator->m_NumAllocations == i);
+        CHECK(allocator->m_LastSize == 256);
+        CHECK(memoryManager.GetPointer(pool1) != memoryManager.GetPointer(pool2));
+        CHECK(memoryManager.GetPointer(pool2) != memoryManager.GetPointer(pool3));
+
+        memoryManager.Release();
+        CHECK(allocator->m_NumFrees == i);
+    }
+}
+
+TEST_CASE("ManageThingsWithHugePages")
+{
+    constexpr size_t hugePageSize = 2 * 1024 * 1024;
+    RefMemoryManager memoryManager(nullptr, true);
+
+    Pool* pool = memoryManager.Manage(hugePageSize + 1);
+
+    memoryManager.Acquire();
+
+    // Large arenas are made of whole huge pages, whether or not the OS backs them with huge pages
+    CHECK(memoryManager.GetArenaSize() == 2 * hugePageSize);
+    CHECK(reinterpret_cast<uintptr_t>(memoryManager.GetPointer(pool)) % hugePageSize == 0);
+
+    memoryManager.Release();
+}
+
 }
@@ -1,5 +1,5 @@
 //
-// Copyright © 2017-2023 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2017-2023, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -12,7 +12,10 @@
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 #include <GraphUtils.hpp>
+#include <reference/RefMemoryManager.hpp>
 #include <reference/RefWorkloadFactory.hpp>
+#include <cmath>
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -207,4 +210,461 @@ TEST_CASE("DebugTestOnCpuRef")
     CHECK(GraphHasNamedLayer(graph, "OutputLayer"));
 }
 
+TEST_CASE("FuseElementwiseChainOnCpuRef")
+{
+    //  in0    in1    scale
+    //    \     |     /
+    //     \   mul --
+    //      \   |
+    //        add
+    //         |
+    //        sig   two
+    //         |    /
+    //         out_mul
+    //           |
+    //          out
+    armnn::INetworkPtr net(armnn::INetwork::Create());
+
+    const armnn::TensorInfo info({ 1, 2, 2, 3 }, armnn::DataType::Float32);
+    const armnn::TensorInfo scaleInfo({ 3 }, armnn::DataType::Float32);
+    const armnn::TensorInfo twoInfo({ 1 }, armnn::DataType::Float32, 0.0f, 0, true);
+    const std::vector<float> twoData = { 2.0f };
+
+    armnn::ActivationDescriptor sigmoidDescriptor;
+    sigmoidDescriptor.m_Function = armnn::ActivationFunction::Sigmoid;
+
+    auto in0   = net->AddInputLayer(0, "in0");
+    auto in1   = net->AddInputLayer(1, "in1");
+    auto scale = net->AddInputLayer(2, "scale");
+    auto two   = net->AddConstantLayer(armnn::ConstTensor(twoInfo, twoData), "two");
+    auto mul   = net->AddElementwiseBinaryLayer(armnn::BinaryOperation::Mul, "mul");
+    auto add   = net->AddElementwiseBinaryLayer(armnn::BinaryOperation::Add, "add");
+    auto sig   = net->AddActivationLayer(sigmoidDescriptor, "sig");
+    auto outMul = net->AddElementwiseBinaryLayer(armnn::BinaryOperation::Mul, "out_mul");
+    auto out   = net->AddOutputLayer(0, "out");
+
+    in1->GetOutputSlot(0).Connect(mul->GetInputSlot(0));
+    scale->GetOutputSlot(0).Connect(mul->GetInputSlot(1));
+    in0->GetOutputSlot(0).Connect(add->GetInputSlot(0));
+    mul->GetOutputSlot(0).Connect(add->GetInputSlot(1));
+    add->GetOutputSlot(0).Connect(sig->GetInputSlot(0));
+    sig->GetOutputSlot(0).Connect(outMul->GetInputSlot(0));
+    two->GetOutputSlot(0).Connect(outMul->GetInputSlot(1));
+    outMul->GetOutputSlot(0).Connect(out->GetInputSlot(0));
+
+    in0->GetOutputSlot(0).SetTensorInfo(info);
+    in1->GetOutputSlot(0).SetTensorInfo(info);
+    scale->GetOutputSlot(0).SetTensorInfo(scaleInfo);
+    two->GetOutputSlot(0).SetTensorInfo(twoInfo);
+    mul->GetOutputSlot(0).SetTensorInfo(info);
+    add->GetOutputSlot(0).SetTensorInfo(info);
+    sig->GetOutputSlot(0).SetTensorInfo(info);
+    outMul->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    armnn::IOptimizedNetworkPtr optNet = armnn::Optimize(*net, backends, runtime->GetDeviceSpec());
+    CHECK(optNet);
+
+    // The four elementwise layers are replaced by a single fused layer.
+    armnn::Graph& graph = GetGraphForTesting(optNet.get());
+    unsigned int numFusedLayers = 0;
+    for (auto&& layer : graph)
+    {
+        CHECK(layer->GetType() != armnn::LayerType::ElementwiseBinary);
+        CHECK(layer->GetType() != armnn::LayerType::Activation);
+        if (layer->GetType() == armnn::LayerType::Fused)
+        {
+            ++numFusedLayers;
+            CHECK(layer->GetNumInputSlots() == 4);
+        }
+    }
+    CHECK(numFusedLayers == 1);
+
+    armnn::NetworkId networkId;
+    CHECK(runtime->LoadNetwork(networkId, std::move(optNet)) == armnn::Status::Success);
+
+    std::vector<float> in0Data(info.GetNumElements());
+    std::vector<float> in1Data(info.GetNumElements());
+    std::vector<float> scaleData = { 0.5f, -1.0f, 2.0f };
+    for (unsigned int i = 0; i < info.GetNumElements(); ++i)
+    {
+        in0Data[i] = 0.25f * static_cast<float>(i) - 1.0f;
+        in1Data[i] = 1.0f - 0.125f * static_cast<float>(i);
+    }
+
+    std::vector<float> expected(info.GetNumElements());
+    for (unsigned int i = 0; i < info.GetNumElements(); ++i)
+    {
+        const float sum = in0Data[i] + in1Data[i] * scaleData[i % 3];
+        expected[i] = 2.0f / (1.0f + std::exp(-sum));
+    }
+
+    std::vector<float> outputData(info.GetNumElements());
+    armnn::TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    armnn::TensorInfo scaleInputInfo = runtime->GetInputTensorInfo(networkId, 2);
+    scaleInputInfo.SetConstant(true);
+    armnn::InputTensors inputTensors
+    {
+        { 0, armnn::ConstTensor(inputInfo, in0Data.data()) },
+        { 1, armnn::ConstTensor(inputInfo, in1Data.data()) },
+        { 2, armnn::ConstTensor(scaleInputInfo, scaleData.data()) }
+    };
+    armnn::OutputTensors outputTensors
+    {
+        { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+    };
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+
+    for (unsigned int i = 0; i < outputData.size(); ++i)
+    {
+        CHECK(outputData[i] == doctest::Approx(expected[i]));
+    }
+}
+
+TEST_CASE("FuseElementwiseChainKeepsSharedIntermediateOnCpuRef")
+{
+    // The result of the first activation is also a network output, so only the last two layers are fused.
+    //  in -> relu -> neg -> abs -> out0
+    //          |
+    //         out1
+    armnn::INetworkPtr net(armnn::INetwork::Create());
+    const armnn::TensorInfo info({ 2, 4 }, armnn::DataType::Float32);
+
+    armnn::ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    auto in   = net->AddInputLayer(0, "in");
+    auto relu = net->AddActivationLayer(reluDescriptor, "relu");
+    auto neg  = net->AddElementwiseUnaryLayer(armnn::ElementwiseUnaryDescriptor(armnn::UnaryOperation::Neg), "neg");
+    auto abs  = net->AddElementwiseUnaryLayer(armnn::ElementwiseUnaryDescriptor(armnn::UnaryOperation::Abs), "abs");
+    auto out0 = net->AddOutputLayer(0, "out0");
+    auto out1 = net->AddOutputLayer(1, "out1");
+
+    in->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(neg->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(out1->GetInputSlot(0));
+    neg->GetOutputSlot(0).Connect(abs->GetInputSlot(0));
+    abs->GetOutputSlot(0).Connect(out0->GetInputSlot(0));
+
+    in->GetOutputSlot(0).SetTensorInfo(info);
+    relu->GetOutputSlot(0).SetTensorInfo(info);
+    neg->GetOutputSlot(0).SetTensorInfo(info);
+    abs->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    armnn::IOptimizedNetworkPtr optNet = armnn::Optimize(*net, backends, runtime->GetDeviceSpec());
+    CHECK(optNet);
+
+    armnn::Graph& graph = GetGraphForTesting(optNet.get());
+    CHECK(GraphHasNamedLayer(graph, "relu"));
+    CHECK(GraphHasNamedLayer(graph, "fused-neg-abs"));
+    CHECK(!GraphHasNamedLayer(graph, "neg"));
+    CHECK(!GraphHasNamedLayer(graph, "abs"));
+}
+
+
+TEST_CASE("AllocateDynamicBuffersInPlaceOnCpuRef")
+{
+    // relu overwrites its input and mul overwrites neg, its first input, as each is the last consumer of that tensor.
+    // neg has to keep its own memory because the result of relu is still needed by mul.
+    //  in -> relu -> neg -> mul -> out
+    //          |             |
+    //          +-------------+
+    using namespace armnn;
+    const TensorInfo info({ 2, 3 }, DataType::Float32);
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+
+    Graph graph;
+    Layer* in   = graph.AddLayer<InputLayer>(0, "in");
+    Layer* relu = graph.AddLayer<ActivationLayer>(reluDescriptor, "relu");
+    Layer* neg  = graph.AddLayer<ElementwiseUnaryLayer>(ElementwiseUnaryDescriptor(UnaryOperation::Neg), "neg");
+    Layer* mul  = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Mul), "mul");
+    Layer* out  = graph.AddLayer<OutputLayer>(0, "out");
+
+    in->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(neg->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(mul->GetInputSlot(1));
+    neg->GetOutputSlot(0).Connect(mul->GetInputSlot(0));
+    mul->GetOutputSlot(0).Connect(out->GetInputSlot(0));
+
+    for (Layer* layer : { in, relu, neg, mul, out })
+    {
+        layer->SetBackendId(Compute::CpuRef);
+        if (layer->GetNumOutputSlots() > 0)
+        {
+            layer->GetOutputSlot(0).SetTensorInfo(info);
+        }
+    }
+    graph.TopologicalSort();
+
+    auto memoryManager = std::make_shared<RefMemoryManager>();
+    RefWorkloadFactory factory(memoryManager);
+    TensorHandleFactoryRegistry registry;
+    for (auto&& layer : graph)
+    {
+        layer->CreateTensorHandles(registry, factory);
+    }
+
+    std::vector<std::unique_ptr<IWorkload>> workloads;
+    std::unordered_map<const Layer*, Graph::InPlaceSlots> inPlaceSlots;
+    for (auto&& layer : graph)
+    {
+        if (layer->GetType() != LayerType::Input && layer->GetType() != LayerType::Output)
+        {
+            workloads.push_back(layer->CreateWorkload(factory));
+            inPlaceSlots[layer] = workloads.back()->GetInPlaceSlots();
+        }
+    }
+
+    CHECK(graph.AllocateDynamicBuffers(inPlaceSlots) == Status::Success);
+    memoryManager->Acquire();
+
+    auto outputData = [](const Layer* layer)
+    {
+        return static_cast<float*>(layer->GetOutputSlot(0).GetOutputHandler().GetData()->Map());
+    };
+    CHECK(outputData(relu) == outputData(in));
+    CHECK(outputData(neg) != outputData(relu));
+    CHECK(outputData(mul) == outputData(neg));
+
+    const std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f, -5.0f, 6.0f };
+    std::memcpy(outputData(in), inputData.data(), info.GetNumBytes());
+    for (auto&& workload : workloads)
+    {
+        workload->Execute();
+    }
+
+    const std::vector<float> expected = { 0.0f, -4.0f, 0.0f, -16.0f, 0.0f, -36.0f };
+    const float* result = outputData(mul);
+    for (unsigned int i = 0; i < expected.size(); ++i)
+    {
+        CHECK(result[i] == doctest::Approx(expected[i]));
+    }
+
+    memoryManager->Release();
+}
+
+TEST_CASE("InPlaceExecutionOnCpuRef")
+{
+    //  in -> relu -> neg -> mul -> out
+    //          |             |
+    //          +-------------+
+    armnn::INetworkPtr net(armnn::INetwork::Create());
+    const armnn::TensorInfo info({ 2, 3 }, armnn::DataType::Float32);
+
+    armnn::ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = armnn::ActivationFunction::ReLu;
+
+    auto in   = net->AddInputLayer(0, "in");
+    auto relu = net->AddActivationLayer(reluDescriptor, "relu");
+    auto neg  = net->AddElementwiseUnaryLayer(armnn::ElementwiseUnaryDescriptor(armnn::UnaryOperation::Neg), "neg");
+    auto mul  = net->AddElementwiseBinaryLayer(armnn::ElementwiseBinaryDescriptor(armnn::BinaryOperation::Mul), "mul");
+    auto out  = net->AddOutputLayer(0, "out");
+
+    in->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(neg->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(mul->GetInputSlot(1));
+    neg->GetOutputSlot(0).Connect(mul->GetInputSlot(0));
+    mul->GetOutputSlot(0).Connect(out->GetInputSlot(0));
+
+    in->GetOutputSlot(0).SetTensorInfo(info);
+    relu->GetOutputSlot(0).SetTensorInfo(info);
+    neg->GetOutputSlot(0).SetTensorInfo(info);
+    mul->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+
+    // Run with the memory managed by the backend and by the runtime's memory optimizer strategies
+    for (bool externalMemoryManagement : { false, true })
+    {
+        armnn::NetworkId networkId;
+        std::string errorMessage;
+        armnn::INetworkProperties networkProperties(armnn::MemorySource::Undefined, armnn::MemorySource::Undefined,
+                                                    false, armnn::ProfilingDetailsMethod::Undefined,
+                                                    externalMemoryManagement);
+        armnn::IOptimizedNetworkPtr optNet = armnn::Optimize(*net, backends, runtime->GetDeviceSpec());
+        CHECK(optNet);
+        CHECK(runtime->LoadNetwork(networkId, std::move(optNet), errorMessage, networkProperties) ==
+              armnn::Status::Success);
+
+        armnn::TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+        inputInfo.SetConstant(true);
+        std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f, -5.0f, 6.0f };
+        std::vector<float> outputData(6);
+        const std::vector<float> expected = { 0.0f, -4.0f, 0.0f, -16.0f, 0.0f, -36.0f };
+
+        armnn::InputTensors inputTensors
+        {
+            { 0, armnn::ConstTensor(inputInfo, inputData.data()) }
+        };
+        armnn::OutputTensors outputTensors
+        {
+            { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+        };
+
+        // Execute twice to check that memory reused between inferences is not left in a stale state
+        for (unsigned int run = 0; run < 2; ++run)
+        {
+            CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+            for (unsigned int i = 0; i < outputData.size(); ++i)
+            {
+                CHECK(outputData[i] == doctest::Approx(expected[i]));
+            }
+            std::fill(outputData.begin(), outputData.end(), 0.0f);
+        }
+        // The input tensor must not be overwritten by running relu in place
+        CHECK(inputData[1] == doctest::Approx(2.0f));
+        CHECK(runtime->UnloadNetwork(networkId) == armnn::Status::Success);
+    }
+}
+
+
+TEST_CASE("ReshapeSharesMemoryOnCpuRef")
+{
+    //  in -> relu -> reshape -> neg -> out
+    using namespace armnn;
+    const TensorInfo info({ 2, 3 }, DataType::Float32);
+    const TensorInfo reshapedInfo({ 3, 2 }, DataType::Float32);
+
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+    ReshapeDescriptor reshapeDescriptor;
+    reshapeDescriptor.m_TargetShape = reshapedInfo.GetShape();
+
+    Graph graph;
+    Layer* in      = graph.AddLayer<InputLayer>(0, "in");
+    Layer* relu    = graph.AddLayer<ActivationLayer>(reluDescriptor, "relu");
+    Layer* reshape = graph.AddLayer<ReshapeLayer>(reshapeDescriptor, "reshape");
+    Layer* neg     = graph.AddLayer<ElementwiseUnaryLayer>(ElementwiseUnaryDescriptor(UnaryOperation::Neg), "neg");
+    Layer* out     = graph.AddLayer<OutputLayer>(0, "out");
+
+    in->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot(0).Connect(neg->GetInputSlot(0));
+    neg->GetOutputSlot(0).Connect(out->GetInputSlot(0));
+
+    in->GetOutputSlot(0).SetTensorInfo(info);
+    relu->GetOutputSlot(0).SetTensorInfo(info);
+    reshape->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+    neg->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+    for (Layer* layer : { in, relu, reshape, neg, out })
+    {
+        layer->SetBackendId(Compute::CpuRef);
+    }
+    graph.TopologicalSort();
+
+    auto memoryManager = std::make_shared<RefMemoryManager>();
+    RefWorkloadFactory factory(memoryManager);
+    TensorHandleFactoryRegistry registry;
+    for (auto&& layer : graph)
+    {
+        layer->CreateTensorHandles(registry, factory);
+    }
+
+    std::vector<std::unique_ptr<IWorkload>> workloads;
+    std::unordered_map<const Layer*, Graph::InPlaceSlots> inPlaceSlots;
+    for (auto&& layer : graph)
+    {
+        if (layer->GetType() != LayerType::Input && layer->GetType() != LayerType::Output)
+        {
+            workloads.push_back(layer->CreateWorkload(factory));
+            inPlaceSlots[layer] = workloads.back()->GetInPlaceSlots();
+        }
+    }
+
+    CHECK(graph.AllocateDynamicBuffers(inPlaceSlots) == Status::Success);
+    memoryManager->Acquire();
+
+    auto outputData = [](const Layer* layer)
+    {
+        return static_cast<float*>(layer->GetOutputSlot(0).GetOutputHandler().GetData()->Map());
+    };
+    CHECK(outputData(reshape) == outputData(relu));
+    CHECK(outputData(neg) == outputData(in));
+
+    const std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f, -5.0f, 6.0f };
+    std::memcpy(outputData(in), inputData.data(), info.GetNumBytes());
+    for (auto&& workload : workloads)
+    {
+        workload->Execute();
+    }
+
+    const std::vector<float> expected = { 0.0f, -2.0f, 0.0f, -4.0f, 0.0f, -6.0f };
+    const float* result = outputData(neg);
+    for (unsigned int i = 0; i < expected.size(); ++i)
+    {
+        CHECK(result[i] == doctest::Approx(expected[i]));
+    }
+
+    memoryManager->Release();
+}
+
+TEST_CASE("ReshapeCopiesImportedBuffersOnCpuRef")
+{
+    // The input and output of the reshape are both user buffers, so the reshape cannot share their memory
+    armnn::INetworkPtr net(armnn::INetwork::Create());
+    const armnn::TensorInfo info({ 2, 3 }, armnn::DataType::Float32);
+    const armnn::TensorInfo reshapedInfo({ 6 }, armnn::DataType::Float32);
+
+    armnn::ReshapeDescriptor reshapeDescriptor;
+    reshapeDescriptor.m_TargetShape = reshapedInfo.GetShape();
+
+    auto in      = net->AddInputLayer(0, "in");
+    auto reshape = net->AddReshapeLayer(reshapeDescriptor, "reshape");
+    auto out     = net->AddOutputLayer(0, "out");
+
+    in->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot(0).Connect(out->GetInputSlot(0));
+    in->GetOutputSlot(0).SetTensorInfo(info);
+    reshape->GetOutputSlot(0).SetTensorInfo(reshapedInfo);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = { armnn::Compute::CpuRef };
+    armnn::OptimizerOptionsOpaque optimizerOptions;
+    optimizerOptions.SetImportEnabled(true);
+    optimizerOptions.SetExportEnabled(true);
+    armnn::IOptimizedNetworkPtr optNet = armnn::Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions);
+    CHECK(optNet);
+
+    armnn::NetworkId networkId;
+    std::string errorMessage;
+    armnn::INetworkProperties networkProperties(armnn::MemorySource::Malloc, armnn::MemorySource::Malloc);
+    armnn::Status loadingStatus = runtime->LoadNetwork(networkId, std::move(optNet), errorMessage, networkProperties);
+    CHECK_MESSAGE(loadingStatus == armnn::Status::Success, errorMessage);
+
+    armnn::TensorInfo inputInfo = runtime->GetInputTensorInfo(networkId, 0);
+    inputInfo.SetConstant(true);
+    std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f, -5.0f, 6.0f };
+    std::vector<float> outputData(6);
+
+    armnn::InputTensors inputTensors
+    {
+        { 0, armnn::ConstTensor(inputInfo, inputData.data()) }
+    };
+    armnn::OutputTensors outputTensors
+    {
+        { 0, armnn::Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) }
+    };
+    CHECK(runtime->EnqueueWorkload(networkId, inputTensors, outputTensors) == armnn::Status::Success);
+
+    for (unsigned int i = 0; i < outputData.size(); ++i)
+    {
+        CHECK(outputData[i] == doctest::Approx(inputData[i]));
+    }
+}
+
 }
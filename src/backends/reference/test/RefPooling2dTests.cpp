@@ -0,0 +1,162 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Decoders.hpp>
+#include <reference/workloads/Encoders.hpp>
+#include <reference/workloads/Pooling2d.hpp>
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Types.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+unsigned int PooledSize(unsigned int inputSize, unsigned int padBefore, unsigned int padAfter,
+                        unsigned int poolSize, unsigned int stride)
+{
+    return (inputSize + padBefore + padAfter - poolSize) / stride + 1;
+}
+
+Pooling2dDescriptor MakeDescriptor(PoolingAlgorithm poolType, PaddingMethod paddingMethod,
+                                   unsigned int poolSize, unsigned int stride,
+                                   unsigned int padBefore, unsigned int padAfter)
+{
+    Pooling2dDescriptor descriptor;
+    descriptor.m_PoolType      = poolType;
+    descriptor.m_PaddingMethod = paddingMethod;
+    descriptor.m_PoolWidth     = poolSize;
+    descriptor.m_PoolHeight    = poolSize;
+    descriptor.m_StrideX       = stride;
+    descriptor.m_StrideY       = stride;
+    descriptor.m_PadLeft       = padBefore;
+    descriptor.m_PadTop        = padBefore;
+    descriptor.m_PadRight      = padAfter;
+    descriptor.m_PadBottom     = padAfter;
+    descriptor.m_DataLayout    = DataLayout::NHWC;
+    return descriptor;
+}
+
+/// Runs both the generic Pooling2d and the NHWC fast path on the same random input and compares the results.
+template <typename T>
+void CompareWithGenericPooling(DataType dataType, const Pooling2dDescriptor& descriptor, int tolerance)
+{
+    const unsigned int batches  = 2;
+    const unsigned int height   = 9;
+    const unsigned int width    = 11;
+    const unsigned int channels = 5;
+
+    const unsigned int outputHeight = PooledSize(height, descriptor.m_PadTop, descriptor.m_PadBottom,
+                                                 descriptor.m_PoolHeight, descriptor.m_StrideY);
+    const unsigned int outputWidth  = PooledSize(width, descriptor.m_PadLeft, descriptor.m_PadRight,
+                                                 descriptor.m_PoolWidth, descriptor.m_StrideX);
+
+    TensorInfo inputInfo({ batches, height, width, channels }, dataType, 0.25f, 3);
+    TensorInfo outputInfo({ batches, outputHeight, outputWidth, channels }, dataType, 0.25f, 3);
+    REQUIRE(IsPooling2dNhwcFastPathSupported(inputInfo, outputInfo, descriptor));
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(-100, 100);
+    std::vector<T> input(inputInfo.GetNumElements());
+    for (T& value : input)
+    {
+        value = static_cast<T>(distribution(generator) + (dataType == DataType::QAsymmU8 ? 100 : 0));
+    }
+
+    std::vector<T> expected(outputInfo.GetNumElements());
+    std::vector<T> actual(outputInfo.GetNumElements());
+
+    auto decoder = MakeDecoder<float>(inputInfo, input.data());
+    auto encoder = MakeEncoder<float>(outputInfo, expected.data());
+    Pooling2d(*decoder, *encoder, inputInfo, outputInfo, descriptor);
+
+    Pooling2dNhwc(input.data(), actual.data(), inputInfo, outputInfo, descriptor);
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        if (tolerance == 0)
+        {
+            CHECK(actual[i] == expected[i]);
+        }
+        else
+        {
+            CHECK(std::abs(static_cast<int>(actual[i]) - static_cast<int>(expected[i])) <= tolerance);
+        }
+    }
+}
+
+template <typename T>
+void CompareAllConfigurations(DataType dataType, int averageTolerance)
+{
+    for (PaddingMethod paddingMethod : { PaddingMethod::IgnoreValue, PaddingMethod::Exclude })
+    {
+        // 2x2 stride 2, 3x3 stride 1 and 2 with symmetric and asymmetric padding, and a large window.
+        const unsigned int configs[][4] = { { 2, 2, 0, 0 }, { 3, 1, 1, 1 }, { 3, 2, 0, 1 }, { 3, 2, 2, 2 },
+                                            { 7, 1, 3, 3 } };
+        for (const auto& config : configs)
+        {
+            CompareWithGenericPooling<T>(dataType,
+                                         MakeDescriptor(PoolingAlgorithm::Max, paddingMethod,
+                                                        config[0], config[1], config[2], config[3]),
+                                         0);
+            CompareWithGenericPooling<T>(dataType,
+                                         MakeDescriptor(PoolingAlgorithm::Average, paddingMethod,
+                                                        config[0], config[1], config[2], config[3]),
+                                         averageTolerance);
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST_SUITE("RefPooling2d")
+{
+TEST_CASE("Pooling2dNhwcFloat32MatchesGenericPooling")
+{
+    CompareAllConfigurations<float>(armnn::DataType::Float32, 0);
+}
+
+TEST_CASE("Pooling2dNhwcQAsymmU8MatchesGenericPooling")
+{
+    // Integer averaging may round exact ties differently to the float path.
+    CompareAllConfigurations<uint8_t>(armnn::DataType::QAsymmU8, 1);
+}
+
+TEST_CASE("Pooling2dNhwcQAsymmS8MatchesGenericPooling")
+{
+    CompareAllConfigurations<int8_t>(armnn::DataType::QAsymmS8, 1);
+}
+
+TEST_CASE("Pooling2dNhwcFastPathSupport")
+{
+    using namespace armnn;
+    TensorInfo floatInfo({ 1, 4, 4, 2 }, DataType::Float32);
+    TensorInfo u8Info({ 1, 4, 4, 2 }, DataType::QAsymmU8, 0.5f, 10);
+    TensorInfo u8OtherInfo({ 1, 4, 4, 2 }, DataType::QAsymmU8, 0.25f, 10);
+    TensorInfo halfInfo({ 1, 4, 4, 2 }, DataType::Float16);
+
+    Pooling2dDescriptor descriptor;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+    descriptor.m_PoolType   = PoolingAlgorithm::Max;
+    CHECK(IsPooling2dNhwcFastPathSupported(floatInfo, floatInfo, descriptor));
+    CHECK(IsPooling2dNhwcFastPathSupported(u8Info, u8Info, descriptor));
+    CHECK(!IsPooling2dNhwcFastPathSupported(u8Info, u8OtherInfo, descriptor));
+    CHECK(!IsPooling2dNhwcFastPathSupported(halfInfo, halfInfo, descriptor));
+
+    descriptor.m_PoolType = PoolingAlgorithm::L2;
+    CHECK(!IsPooling2dNhwcFastPathSupported(floatInfo, floatInfo, descriptor));
+
+    descriptor.m_PoolType   = PoolingAlgorithm::Average;
+    descriptor.m_DataLayout = DataLayout::NCHW;
+    CHECK(!IsPooling2dNhwcFastPathSupported(floatInfo, floatInfo, descriptor));
+}
+}
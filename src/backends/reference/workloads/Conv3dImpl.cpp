@@ -1,10 +1,14 @@
 //
-// Copyright © 2021 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include "Conv3dImpl.hpp"
 
+#include "Gemm.hpp"
+
+#include <algorithm>
+
 namespace armnn
 {
 
@@ -54,103 +58,107 @@ void Convolve3d(const TensorShape& rInputShape,
     const unsigned int filterHeight = rFilterShape[1];
     const unsigned int filterWidth  = rFilterShape[2];
 
-    const std::vector<float> inputVec = rInputDecoder.DecodeTensor(rInputShape);
+    const bool isNdhwc = dataLayoutIndexed.GetDataLayout() == DataLayout::NDHWC;
+
+    const std::vector<float> decodedInput = rInputDecoder.DecodeTensor(rInputShape);
+
+    // vol2col below reads a channels-last view of the input, so convert NCDHW input up front.
+    std::vector<float> channelsLastInput;
+    if (!isNdhwc)
+    {
+        const unsigned int inputVolume = inputDepth * inputHeight * inputWidth;
+        channelsLastInput.resize(decodedInput.size());
+        for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+        {
+            const size_t batchOffset = static_cast<size_t>(batchIdx) * inputVolume * inChannels;
+            for (unsigned int cInput = 0; cInput < inChannels; cInput++)
+            {
+                for (unsigned int i = 0; i < inputVolume; i++)
+                {
+                    channelsLastInput[batchOffset + i * inChannels + cInput] =
+                        decodedInput[batchOffset + cInput * inputVolume + i];
+                }
+            }
+        }
+    }
+    const std::vector<float>& inputVec = isNdhwc ? decodedInput : channelsLastInput;
+
+    // Conv3d weights layout: [D,H,W,I,O], which is already a row-major [D*H*W*I, O] matrix for the GEMM.
     const std::vector<float> filterVec = rFilterDecoder.DecodeTensor(rFilterShape);
+    const unsigned int patchSize = filterDepth * filterHeight * filterWidth * inChannels;
 
     const TensorShape biasShape{outChannels};
     const std::vector<float> biasVec = biasEnabled ? pBiasDecoder->DecodeTensor(biasShape) : std::vector<float>();
 
+    // One output row (all x positions for a given batch, z and y) is computed per GEMM, which bounds the size
+    // of the vol2col buffer while still giving the GEMM a reasonably sized M dimension.
+    std::vector<float> patches(static_cast<size_t>(outputWidth) * patchSize);
+    std::vector<float> outputRow(static_cast<size_t>(outputWidth) * outChannels);
+
+    const unsigned int outputVolume = outputDepth * outputHeight * outputWidth;
+
     for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
     {
+        const float* inputBatch = inputVec.data() +
+                                  static_cast<size_t>(batchIdx) * inputDepth * inputHeight * inputWidth * inChannels;
+
         for (unsigned int zOutput = 0; zOutput < outputDepth; zOutput++)
         {
-            for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
+            for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
             {
-                for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
+                // vol2col: gather the receptive field of every output element of this row, in the same
+                // [D,H,W,I] order as the weights. Elements in the padding are zero.
+                for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
                 {
-                    for (unsigned int cOutput = 0; cOutput < outChannels; cOutput++)
-                    {
-                        // This loop goes over each output element.
-                        float sum = 0.0f;
+                    float* patch = patches.data() + static_cast<size_t>(xOutput) * patchSize;
 
-                        // Loop over each input channel.
-                        for (unsigned int zFilter = 0; zFilter < filterDepth; zFilter++)
+                    for (unsigned int zFilter = 0; zFilter < filterDepth; zFilter++)
+                    {
+                        for (unsigned int yFilter = 0; yFilter < filterHeight; yFilter++)
                         {
-                            for (unsigned int yFilter = 0; yFilter < filterHeight; yFilter++)
+                            for (unsigned int xFilter = 0; xFilter < filterWidth; xFilter++)
                             {
-                                for (unsigned int xFilter = 0; xFilter < filterWidth; xFilter++)
+                                unsigned int yInput = yOutput * yStride + yFilter * yDilation;
+                                unsigned int xInput = xOutput * xStride + xFilter * xDilation;
+                                unsigned int zInput = zOutput * zStride + zFilter * zDilation;
+
+                                // Check if we're in the padding.
+                                if (yInput < paddingTop || yInput >= inputHeight + paddingTop ||
+                                    xInput < paddingLeft || xInput >= inputWidth + paddingLeft ||
+                                    zInput < paddingFront || zInput >= inputDepth + paddingFront)
+                                {
+                                    std::fill(patch, patch + inChannels, 0.0f);
+                                }
+                                else
                                 {
-                                    for (unsigned int cInput = 0; cInput < inChannels; cInput++)
-                                    {
-                                        // This loop goes over each input element for each output element.
-                                        unsigned int filterIndex = 0;
-
-                                        // Conv3d weights layout: [D,H,W,I,O]
-                                        // Keep this implementation, as using DataLayoutIndexed::GetIndex
-                                        // causes large performance regression.
-                                        filterIndex = zFilter * filterHeight * filterWidth * inChannels * outChannels +
-                                                      yFilter * filterWidth * inChannels * outChannels +
-                                                      xFilter * inChannels * outChannels +
-                                                      cInput * outChannels +
-                                                      cOutput;
-
-                                        unsigned int yInput = yOutput * yStride + yFilter * yDilation;
-                                        unsigned int xInput = xOutput * xStride + xFilter * xDilation;
-                                        unsigned int zInput = zOutput * zStride + zFilter * zDilation;
-
-                                        float inputValue;
-
-                                        // Check if we're in the padding.
-                                        if (yInput < paddingTop || yInput >= inputHeight + paddingTop ||
-                                            xInput < paddingLeft || xInput >= inputWidth + paddingLeft ||
-                                            zInput < paddingFront || zInput >= inputDepth + paddingFront)
-                                        {
-                                            inputValue = 0.0f;
-                                        }
-                                        else
-                                        {
-                                            unsigned int inputIndex = 0;
-
-                                            // Keep this implementation, as using DataLayoutIndexed::GetIndex
-                                            // causes large performance regression.
-                                            if (dataLayoutIndexed.GetDataLayout() == DataLayout::NDHWC)
-                                            {
-                                                inputIndex =
-                                                        batchIdx * inputDepth * inputHeight * inputWidth * inChannels +
-                                                        (zInput-paddingFront) * inputHeight * inputWidth * inChannels +
-                                                        (yInput-paddingTop) * inputWidth * inChannels +
-                                                        (xInput-paddingLeft) * inChannels +
-                                                        cInput;
-                                            }
-                                            else
-                                            {
-                                                // NCDHW DataLayout
-                                                inputIndex =
-                                                        batchIdx * inputDepth * inputHeight * inputWidth * inChannels +
-                                                        inputDepth * inputHeight * inputWidth * cInput +
-                                                        (zInput-paddingFront) * inputHeight * inputWidth +
-                                                        (yInput-paddingTop) * inputWidth +
-                                                        xInput-paddingLeft;
-                                            }
-
-                                            inputValue = inputVec[inputIndex];
-                                        }
-
-                                        sum += filterVec[filterIndex] * inputValue;
-                                    }
+                                    const float* pixel = inputBatch +
+                                        ((static_cast<size_t>(zInput - paddingFront) * inputHeight +
+                                          (yInput - paddingTop)) * inputWidth + (xInput - paddingLeft)) * inChannels;
+                                    std::copy(pixel, pixel + inChannels, patch);
                                 }
+                                patch += inChannels;
                             }
                         }
+                    }
+                }
+
+                // [outputWidth, D*H*W*I] x [D*H*W*I, O]
+                Gemm(outputWidth, outChannels, patchSize, patches.data(), filterVec.data(), outputRow.data());
 
+                for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
+                {
+                    for (unsigned int cOutput = 0; cOutput < outChannels; cOutput++)
+                    {
+                        float sum = outputRow[xOutput * outChannels + cOutput];
                         if (biasEnabled)
                         {
                             sum += biasVec[cOutput];
                         }
 
                         unsigned int outIdx;
-                        if (dataLayoutIndexed.GetDataLayout() == DataLayout::NDHWC)
+                        if (isNdhwc)
                         {
-                            outIdx = batchIdx * outputDepth * outputHeight * outputWidth * outChannels +
+                            outIdx = batchIdx * outputVolume * outChannels +
                                      zOutput * outputHeight * outputWidth * outChannels +
                                      yOutput * outputWidth * outChannels +
                                      xOutput * outChannels +
@@ -159,8 +167,8 @@ void Convolve3d(const TensorShape& rInputShape,
                         else
                         {
                             // NCDHW DataLayout
-                            outIdx = batchIdx * outputDepth * outputHeight * outputWidth * outChannels +
-                                     cOutput * outputDepth * outputHeight * outputWidth +
+                            outIdx = batchIdx * outputVolume * outChannels +
+                                     cOutput * outputVolume +
                                      zOutput * outputHeight * outputWidth +
                                      yOutput * outputWidth +
                                      xOutput;
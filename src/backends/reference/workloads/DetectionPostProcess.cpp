@@ -1,5 +1,5 @@
 //
-// Copyright © 2017, 2024 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2024, 2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -8,18 +8,15 @@
 #include <armnn/utility/NumericCast.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <numeric>
+#if !defined(ARMNN_DISABLE_THREADS)
+#include <thread>
+#endif
 
 namespace armnn
 {
 
-std::vector<unsigned int> GenerateRangeK(unsigned int k)
-{
-    std::vector<unsigned int> range(k);
-    std::iota(range.begin(), range.end(), 0);
-    return range;
-}
-
 void TopKSort(unsigned int k, unsigned int* indices, const float* values, unsigned int numElement)
 {
     std::partial_sort(indices, indices + k, indices + numElement,
@@ -45,6 +42,176 @@ float IntersectionOverUnion(const float* boxI, const float* boxJ)
     return areaIntersection / areaUnion;
 }
 
+namespace
+{
+
+// Below this many score threshold candidates regular NMS runs on the calling thread.
+constexpr unsigned int g_MinCandidatesPerThread = 4096;
+
+/// Greedy NMS over candidates that already passed the score threshold. Candidates are visited in descending score
+/// order and a candidate is kept unless it overlaps a previously kept box by more than iouThreshold, which selects
+/// the same boxes as comparing every pair. Boxes are only compared with the at most maxDetection kept boxes, and
+/// pairs whose extents are disjoint along either axis are rejected without computing the IoU.
+unsigned int NonMaxSuppressionCandidates(unsigned int numCandidates,
+                                         const unsigned int* candidateBoxes,
+                                         const float* candidateScores,
+                                         const float* boxCorners,
+                                         unsigned int maxDetection,
+                                         float iouThreshold,
+                                         DetectionPostProcessScratch::NmsWorkspace& workspace,
+                                         unsigned int* selected)
+{
+    // Box-corner format: ymin, xmin, ymax, xmax.
+    const int yMin = 0;
+    const int xMin = 1;
+    const int yMax = 2;
+    const int xMax = 3;
+
+    std::vector<unsigned int>& order = workspace.m_Order;
+    order.resize(numCandidates);
+    std::iota(order.begin(), order.end(), 0);
+    TopKSort(numCandidates, order.data(), candidateScores, numCandidates);
+
+    const unsigned int numOutput = std::min(maxDetection, numCandidates);
+    std::vector<float>& keptBoxes = workspace.m_KeptBoxes;
+    keptBoxes.resize(numOutput * 4);
+
+    // Disjoint boxes have an IoU of zero, which can only exceed a negative threshold.
+    const bool canPrune = iouThreshold >= 0.0f;
+
+    unsigned int numKept = 0;
+    for (unsigned int i = 0; i < numCandidates && numKept < numOutput; ++i)
+    {
+        const unsigned int box = candidateBoxes[order[i]];
+        const float* corners = &boxCorners[box * 4];
+
+        bool suppressed = false;
+        for (unsigned int k = 0; k < numKept && !suppressed; ++k)
+        {
+            const float* kept = &keptBoxes[k * 4];
+            if (canPrune &&
+                (std::min(kept[xMax], corners[xMax]) <= std::max(kept[xMin], corners[xMin]) ||
+                 std::min(kept[yMax], corners[yMax]) <= std::max(kept[yMin], corners[yMin])))
+            {
+                continue;
+            }
+            suppressed = IntersectionOverUnion(kept, corners) > iouThreshold;
+        }
+
+        if (!suppressed)
+        {
+            std::copy(corners, corners + 4, &keptBoxes[numKept * 4]);
+            selected[numKept++] = box;
+        }
+    }
+    return numKept;
+}
+
+void RegularNonMaxSuppression(unsigned int numBoxes,
+                              const DetectionPostProcessDescriptor& desc,
+                              DetectionPostProcessScratch& scratch)
+{
+    const unsigned int numClasses = desc.m_NumClasses;
+    const unsigned int numClassesWithBg = numClasses + 1;
+    const float* scores = scratch.m_Scores.data();
+
+    // Gather the boxes above the score threshold for all classes in one pass over the scores.
+    std::vector<unsigned int>& offsets = scratch.m_ClassOffsets;
+    offsets.assign(numClasses + 1, 0);
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        const float* boxScores = scores + i * numClassesWithBg + 1;
+        for (unsigned int c = 0; c < numClasses; ++c)
+        {
+            offsets[c + 1] += boxScores[c] >= desc.m_NmsScoreThreshold ? 1u : 0u;
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    const unsigned int numCandidates = offsets[numClasses];
+    scratch.m_CandidateBoxes.resize(numCandidates);
+    scratch.m_CandidateScores.resize(numCandidates);
+    scratch.m_ClassSelections.resize(numCandidates);
+    scratch.m_ClassSelectionCounts.assign(numClasses, 0);
+
+    std::vector<unsigned int>& fill = scratch.m_ClassOrder;
+    fill.assign(offsets.begin(), offsets.end() - 1);
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        const float* boxScores = scores + i * numClassesWithBg + 1;
+        for (unsigned int c = 0; c < numClasses; ++c)
+        {
+            if (boxScores[c] >= desc.m_NmsScoreThreshold)
+            {
+                scratch.m_CandidateBoxes[fill[c]] = i;
+                scratch.m_CandidateScores[fill[c]] = boxScores[c];
+                ++fill[c];
+            }
+        }
+    }
+
+    // Classes are independent, so they are shared out between threads. Every class writes its selection to its own
+    // range, which keeps the result independent of the number of threads.
+    auto runClasses = [&](DetectionPostProcessScratch::NmsWorkspace& workspace, std::atomic<unsigned int>& nextClass)
+    {
+        for (unsigned int c = nextClass++; c < numClasses; c = nextClass++)
+        {
+            const unsigned int offset = offsets[c];
+            scratch.m_ClassSelectionCounts[c] =
+                NonMaxSuppressionCandidates(offsets[c + 1] - offset,
+                                            scratch.m_CandidateBoxes.data() + offset,
+                                            scratch.m_CandidateScores.data() + offset,
+                                            scratch.m_BoxCorners.data(),
+                                            desc.m_DetectionsPerClass,
+                                            desc.m_NmsIouThreshold,
+                                            workspace,
+                                            scratch.m_ClassSelections.data() + offset);
+        }
+    };
+
+    unsigned int numThreads = 1;
+#if !defined(ARMNN_DISABLE_THREADS)
+    numThreads = std::min({ std::max(std::thread::hardware_concurrency(), 1u),
+                            numClasses,
+                            std::max(numCandidates / g_MinCandidatesPerThread, 1u) });
+#endif
+    scratch.m_Workspaces.resize(std::max(numThreads, 1u));
+
+    std::atomic<unsigned int> nextClass(0);
+#if !defined(ARMNN_DISABLE_THREADS)
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads > 1 ? numThreads - 1 : 0);
+    for (unsigned int t = 1; t < numThreads; ++t)
+    {
+        workers.emplace_back(runClasses, std::ref(scratch.m_Workspaces[t]), std::ref(nextClass));
+    }
+#endif
+    runClasses(scratch.m_Workspaces[0], nextClass);
+#if !defined(ARMNN_DISABLE_THREADS)
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+#endif
+
+    // Concatenate the selections in class order.
+    scratch.m_SelectedBoxes.clear();
+    scratch.m_SelectedScores.clear();
+    scratch.m_SelectedClasses.clear();
+    for (unsigned int c = 0; c < numClasses; ++c)
+    {
+        for (unsigned int i = 0; i < scratch.m_ClassSelectionCounts[c]; ++i)
+        {
+            const unsigned int box = scratch.m_ClassSelections[offsets[c] + i];
+            scratch.m_SelectedBoxes.push_back(box);
+            scratch.m_SelectedScores.push_back(scores[box * numClassesWithBg + c + 1]);
+            scratch.m_SelectedClasses.push_back(c);
+        }
+    }
+}
+
+} // anonymous namespace
+
 std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
                                             const std::vector<float>& boxCorners,
                                             const std::vector<float>& scores,
@@ -64,37 +231,18 @@ std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
         }
     }
 
-    // Sort the indices based on scores.
     unsigned int numAboveThreshold = armnn::numeric_cast<unsigned int>(scoresAboveThreshold.size());
-    std::vector<unsigned int> sortedIndices = GenerateRangeK(numAboveThreshold);
-    TopKSort(numAboveThreshold, sortedIndices.data(), scoresAboveThreshold.data(), numAboveThreshold);
-
-    // Number of output cannot be more than max detections specified in the option.
-    unsigned int numOutput = std::min(maxDetection, numAboveThreshold);
-    std::vector<unsigned int> outputIndices;
-    std::vector<bool> visited(numAboveThreshold, false);
-
-    // Prune out the boxes with high intersection over union by keeping the box with higher score.
-    for (unsigned int i = 0; i < numAboveThreshold; ++i)
-    {
-        if (outputIndices.size() >= numOutput)
-        {
-            break;
-        }
-        if (!visited[sortedIndices[i]])
-        {
-            outputIndices.push_back(indicesAboveThreshold[sortedIndices[i]]);
-            for (unsigned int j = i + 1; j < numAboveThreshold; ++j)
-            {
-                unsigned int iIndex = indicesAboveThreshold[sortedIndices[i]] * 4;
-                unsigned int jIndex = indicesAboveThreshold[sortedIndices[j]] * 4;
-                if (IntersectionOverUnion(&boxCorners[iIndex], &boxCorners[jIndex]) > nmsIouThreshold)
-                {
-                    visited[sortedIndices[j]] = true;
-                }
-            }
-        }
-    }
+    std::vector<unsigned int> outputIndices(std::min(maxDetection, numAboveThreshold));
+    DetectionPostProcessScratch::NmsWorkspace workspace;
+    unsigned int numOutput = NonMaxSuppressionCandidates(numAboveThreshold,
+                                                         indicesAboveThreshold.data(),
+                                                         scoresAboveThreshold.data(),
+                                                         boxCorners.data(),
+                                                         maxDetection,
+                                                         nmsIouThreshold,
+                                                         workspace,
+                                                         outputIndices.data());
+    outputIndices.resize(numOutput);
     return outputIndices;
 }
 
@@ -150,12 +298,14 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
                           float* detectionBoxes,
                           float* detectionClasses,
                           float* detectionScores,
-                          float* numDetections)
+                          float* numDetections,
+                          DetectionPostProcessScratch& scratch)
 {
 
     // Transform center-size format which is (ycenter, xcenter, height, width) to box-corner format,
     // which represents the lower left corner and the upper right corner (ymin, xmin, ymax, xmax)
-    std::vector<float> boxCorners(boxEncodingsInfo.GetNumElements());
+    std::vector<float>& boxCorners = scratch.m_BoxCorners;
+    boxCorners.resize(boxEncodingsInfo.GetNumElements());
 
     const unsigned int numBoxes  = boxEncodingsInfo.GetShape()[1];
     const unsigned int numScores = scoresInfo.GetNumElements();
@@ -214,12 +364,12 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
     unsigned int numClassesWithBg = desc.m_NumClasses + 1;
 
     // Decode scores
-    std::vector<float> decodedScores;
-    decodedScores.reserve(numScores);
+    std::vector<float>& decodedScores = scratch.m_Scores;
+    decodedScores.resize(numScores);
 
     for (unsigned int i = 0u; i < numScores; ++i)
     {
-        decodedScores.emplace_back(scores.Get());
+        decodedScores[i] = scores.Get();
         ++scores;
     }
 
@@ -228,48 +378,20 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
     {
         // Perform Regular NMS.
         // For each class, perform NMS and select max detection numbers of the highest score across all classes.
-        std::vector<float> classScores(numBoxes);
-
-        std::vector<unsigned int> selectedBoxesAfterNms;
-        selectedBoxesAfterNms.reserve(numBoxes);
-
-        std::vector<float> selectedScoresAfterNms;
-        selectedBoxesAfterNms.reserve(numScores);
-
-        std::vector<unsigned int> selectedClasses;
-
-        for (unsigned int c = 0; c < desc.m_NumClasses; ++c)
-        {
-            // For each boxes, get scores of the boxes for the class c.
-            for (unsigned int i = 0; i < numBoxes; ++i)
-            {
-                classScores[i] = decodedScores[i * numClassesWithBg + c + 1];
-            }
-            std::vector<unsigned int> selectedIndices = NonMaxSuppression(numBoxes,
-                                                                          boxCorners,
-                                                                          classScores,
-                                                                          desc.m_NmsScoreThreshold,
-                                                                          desc.m_DetectionsPerClass,
-                                                                          desc.m_NmsIouThreshold);
-
-            for (unsigned int i = 0; i < selectedIndices.size(); ++i)
-            {
-                selectedBoxesAfterNms.push_back(selectedIndices[i]);
-                selectedScoresAfterNms.push_back(classScores[selectedIndices[i]]);
-                selectedClasses.push_back(c);
-            }
-        }
+        RegularNonMaxSuppression(numBoxes, desc, scratch);
 
         // Select max detection numbers of the highest score across all classes
-        unsigned int numSelected = armnn::numeric_cast<unsigned int>(selectedBoxesAfterNms.size());
+        unsigned int numSelected = armnn::numeric_cast<unsigned int>(scratch.m_SelectedBoxes.size());
         unsigned int numOutput = std::min(desc.m_MaxDetections,  numSelected);
 
         // Sort the max scores among the selected indices.
-        std::vector<unsigned int> outputIndices = GenerateRangeK(numSelected);
-        TopKSort(numOutput, outputIndices.data(), selectedScoresAfterNms.data(), numSelected);
+        std::vector<unsigned int>& outputIndices = scratch.m_OutputIndices;
+        outputIndices.resize(numSelected);
+        std::iota(outputIndices.begin(), outputIndices.end(), 0);
+        TopKSort(numOutput, outputIndices.data(), scratch.m_SelectedScores.data(), numSelected);
 
         AllocateOutputData(detectionBoxesInfo.GetShape()[1], numOutput, boxCorners, outputIndices,
-                           selectedBoxesAfterNms, selectedClasses, selectedScoresAfterNms,
+                           scratch.m_SelectedBoxes, scratch.m_SelectedClasses, scratch.m_SelectedScores,
                            detectionBoxes, detectionScores, detectionClasses, numDetections);
     }
     else
@@ -278,16 +400,21 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
         // Select max scores of boxes and perform NMS on max scores,
         // select max detection numbers of the highest score
         unsigned int numClassesPerBox = std::min(desc.m_MaxClassesPerDetection, desc.m_NumClasses);
-        std::vector<float> maxScores;
-        std::vector<unsigned int>boxIndices;
-        std::vector<unsigned int>maxScoreClasses;
-
+        std::vector<float>& maxScores = scratch.m_SelectedScores;
+        std::vector<unsigned int>& boxIndices = scratch.m_SelectedBoxes;
+        std::vector<unsigned int>& maxScoreClasses = scratch.m_SelectedClasses;
+        maxScores.clear();
+        boxIndices.clear();
+        maxScoreClasses.clear();
+
+        std::vector<unsigned int>& maxScoreIndices = scratch.m_ClassOrder;
         for (unsigned int box = 0; box < numBoxes; ++box)
         {
             unsigned int scoreIndex = box * numClassesWithBg + 1;
 
             // Get the max scores of the box.
-            std::vector<unsigned int> maxScoreIndices = GenerateRangeK(desc.m_NumClasses);
+            maxScoreIndices.resize(desc.m_NumClasses);
+            std::iota(maxScoreIndices.begin(), maxScoreIndices.end(), 0);
             TopKSort(numClassesPerBox, maxScoreIndices.data(),
                 decodedScores.data() + scoreIndex, desc.m_NumClasses);
 
@@ -299,13 +426,32 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
             }
         }
 
-        // Perform NMS on max scores
-        std::vector<unsigned int> selectedIndices = NonMaxSuppression(numBoxes, boxCorners, maxScores,
-                                                                      desc.m_NmsScoreThreshold,
-                                                                      desc.m_MaxDetections,
-                                                                      desc.m_NmsIouThreshold);
+        // Perform NMS on the max scores of the first numBoxes entries, whose indices also address the box corners.
+        std::vector<unsigned int>& candidates = scratch.m_CandidateBoxes;
+        std::vector<float>& candidateScores = scratch.m_CandidateScores;
+        candidates.clear();
+        candidateScores.clear();
+        const unsigned int numEntries = std::min(numBoxes, armnn::numeric_cast<unsigned int>(maxScores.size()));
+        for (unsigned int i = 0; i < numEntries; ++i)
+        {
+            if (maxScores[i] >= desc.m_NmsScoreThreshold)
+            {
+                candidates.push_back(i);
+                candidateScores.push_back(maxScores[i]);
+            }
+        }
 
-        unsigned int numSelected = armnn::numeric_cast<unsigned int>(selectedIndices.size());
+        scratch.m_Workspaces.resize(std::max<size_t>(scratch.m_Workspaces.size(), 1));
+        std::vector<unsigned int>& selectedIndices = scratch.m_OutputIndices;
+        selectedIndices.resize(candidates.size());
+        unsigned int numSelected = NonMaxSuppressionCandidates(armnn::numeric_cast<unsigned int>(candidates.size()),
+                                                               candidates.data(),
+                                                               candidateScores.data(),
+                                                               boxCorners.data(),
+                                                               desc.m_MaxDetections,
+                                                               desc.m_NmsIouThreshold,
+                                                               scratch.m_Workspaces[0],
+                                                               selectedIndices.data());
         unsigned int numOutput = std::min(desc.m_MaxDetections,  numSelected);
 
         AllocateOutputData(detectionBoxesInfo.GetShape()[1], numOutput, boxCorners, selectedIndices,
@@ -314,4 +460,28 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
     }
 }
 
+void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
+                          const TensorInfo& scoresInfo,
+                          const TensorInfo& anchorsInfo,
+                          const TensorInfo& detectionBoxesInfo,
+                          const TensorInfo& detectionClassesInfo,
+                          const TensorInfo& detectionScoresInfo,
+                          const TensorInfo& numDetectionsInfo,
+                          const DetectionPostProcessDescriptor& desc,
+                          Decoder<float>& boxEncodings,
+                          Decoder<float>& scores,
+                          Decoder<float>& anchors,
+                          float* detectionBoxes,
+                          float* detectionClasses,
+                          float* detectionScores,
+                          float* numDetections)
+{
+    DetectionPostProcessScratch scratch;
+    DetectionPostProcess(boxEncodingsInfo, scoresInfo, anchorsInfo,
+                         detectionBoxesInfo, detectionClassesInfo,
+                         detectionScoresInfo, numDetectionsInfo, desc,
+                         boxEncodings, scores, anchors, detectionBoxes,
+                         detectionClasses, detectionScores, numDetections, scratch);
+}
+
 } // namespace armnn
@@ -14,6 +14,54 @@
 namespace armnn
 {
 
+/// Buffers reused between DetectionPostProcess calls so that repeated inferences do not allocate once the buffers
+/// have grown to the size the network needs.
+struct DetectionPostProcessScratch
+{
+    /// Per-thread buffers for a single NMS run.
+    struct NmsWorkspace
+    {
+        std::vector<unsigned int> m_Order;
+        std::vector<float> m_KeptBoxes;
+    };
+
+    std::vector<float> m_BoxCorners;
+    std::vector<float> m_Scores;
+
+    /// Boxes whose score passes the NMS score threshold, grouped by class. Candidates of class c are in
+    /// [m_ClassOffsets[c], m_ClassOffsets[c + 1]) and the boxes selected by NMS for c are written from the same offset.
+    std::vector<unsigned int> m_ClassOffsets;
+    std::vector<unsigned int> m_CandidateBoxes;
+    std::vector<float> m_CandidateScores;
+    std::vector<unsigned int> m_ClassSelections;
+    std::vector<unsigned int> m_ClassSelectionCounts;
+
+    std::vector<unsigned int> m_ClassOrder;
+    std::vector<unsigned int> m_SelectedBoxes;
+    std::vector<float> m_SelectedScores;
+    std::vector<unsigned int> m_SelectedClasses;
+    std::vector<unsigned int> m_OutputIndices;
+
+    std::vector<NmsWorkspace> m_Workspaces;
+};
+
+void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
+                          const TensorInfo& scoresInfo,
+                          const TensorInfo& anchorsInfo,
+                          const TensorInfo& detectionBoxesInfo,
+                          const TensorInfo& detectionClassesInfo,
+                          const TensorInfo& detectionScoresInfo,
+                          const TensorInfo& numDetectionsInfo,
+                          const DetectionPostProcessDescriptor& desc,
+                          Decoder<float>& boxEncodings,
+                          Decoder<float>& scores,
+                          Decoder<float>& anchors,
+                          float* detectionBoxes,
+                          float* detectionClasses,
+                          float* detectionScores,
+                          float* numDetections,
+                          DetectionPostProcessScratch& scratch);
+
 void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
                           const TensorInfo& scoresInfo,
                           const TensorInfo& anchorsInfo,
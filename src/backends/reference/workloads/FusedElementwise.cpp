@@ -0,0 +1,325 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FusedElementwise.hpp"
+
+#include "Abs.hpp"
+#include "Activation.hpp"
+#include "Ceil.hpp"
+#include "Exp.hpp"
+#include "FloorDiv.hpp"
+#include "Log.hpp"
+#include "Maximum.hpp"
+#include "Minimum.hpp"
+#include "Power.hpp"
+#include "Rsqrt.hpp"
+#include "Sin.hpp"
+#include "Sqrt.hpp"
+#include "SquaredDifference.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Number of elements processed per block. Each input and intermediate result of a block uses BlockSize floats.
+constexpr unsigned int BlockSize = 256;
+
+template <typename Functor>
+void ApplyUnary(const float* input, float* output, unsigned int numElements)
+{
+    Functor functor;
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        output[i] = functor(input[i]);
+    }
+}
+
+template <typename Functor>
+void ApplyBinary(const float* input0, const float* input1, float* output, unsigned int numElements)
+{
+    Functor functor;
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        output[i] = functor(input0[i], input1[i]);
+    }
+}
+
+bool IsSupportedOperation(const FusedElementwiseOperation& operation)
+{
+    switch (operation.m_LayerType)
+    {
+        case LayerType::Activation:
+        case LayerType::ElementwiseBinary:
+            return true;
+        case LayerType::ElementwiseUnary:
+            return operation.m_Unary.m_Operation != UnaryOperation::LogicalNot;
+        default:
+            return false;
+    }
+}
+
+} // anonymous namespace
+
+bool IsFusedElementwiseInputSupported(const TensorShape& input, const TensorShape& output)
+{
+    if (input == output || input.GetNumElements() == 1)
+    {
+        return true;
+    }
+    if (output.GetNumDimensions() == 0 || input.GetNumDimensions() == 0)
+    {
+        return false;
+    }
+
+    const unsigned int numChannels = output[output.GetNumDimensions() - 1];
+    if (input.GetNumDimensions() > output.GetNumDimensions() || input.GetNumElements() != numChannels ||
+        input[input.GetNumDimensions() - 1] != numChannels)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool IsFusedElementwiseSupported(const std::vector<TensorInfo>& inputs,
+                                 const TensorInfo& output,
+                                 const FusedDescriptor& descriptor,
+                                 Optional<std::string&> reasonIfUnsupported)
+{
+    auto unsupported = [&reasonIfUnsupported](const std::string& reason)
+    {
+        if (reasonIfUnsupported)
+        {
+            reasonIfUnsupported.value() = "Reference Fused: " + reason;
+        }
+        return false;
+    };
+
+    if (descriptor.m_FusedKernelType != FusedKernelType::Elementwise)
+    {
+        return unsupported("only elementwise fused kernels are supported.");
+    }
+    if (descriptor.m_ElementwiseProgram.empty() || descriptor.m_NumOutputSlots != 1 ||
+        descriptor.m_NumInputSlots != inputs.size())
+    {
+        return unsupported("invalid elementwise program.");
+    }
+    if (output.GetDataType() != DataType::Float32 || output.GetNumDimensions() == 0)
+    {
+        return unsupported("output type not supported.");
+    }
+
+    for (const TensorInfo& input : inputs)
+    {
+        if (input.GetDataType() != DataType::Float32)
+        {
+            return unsupported("input type not supported.");
+        }
+        if (!IsFusedElementwiseInputSupported(input.GetShape(), output.GetShape()))
+        {
+            return unsupported("input shape cannot be broadcast to the output shape.");
+        }
+    }
+
+    for (unsigned int i = 0; i < descriptor.m_ElementwiseProgram.size(); ++i)
+    {
+        const FusedElementwiseOperation& operation = descriptor.m_ElementwiseProgram[i];
+        const unsigned int numOperands = descriptor.m_NumInputSlots + i;
+        if (!IsSupportedOperation(operation) || operation.m_FirstOperand >= numOperands ||
+            (operation.m_LayerType == LayerType::ElementwiseBinary && operation.m_SecondOperand >= numOperands))
+        {
+            return unsupported("operation " + std::to_string(i) + " not supported.");
+        }
+    }
+    return true;
+}
+
+FusedElementwise::FusedElementwise(const FusedDescriptor& descriptor,
+                                   const std::vector<TensorInfo>& inputInfos,
+                                   const TensorInfo& outputInfo)
+    : m_Program(descriptor.m_ElementwiseProgram)
+    , m_NumElements(outputInfo.GetNumElements())
+    , m_NumChannels(outputInfo.GetShape()[outputInfo.GetNumDimensions() - 1])
+{
+    std::string reason;
+    if (!IsFusedElementwiseSupported(inputInfos, outputInfo, descriptor, reason))
+    {
+        throw InvalidArgumentException(reason);
+    }
+
+    for (const TensorInfo& inputInfo : inputInfos)
+    {
+        if (inputInfo.GetNumElements() == m_NumElements)
+        {
+            m_InputKinds.push_back(InputKind::Full);
+        }
+        else if (inputInfo.GetNumElements() == 1)
+        {
+            m_InputKinds.push_back(InputKind::Scalar);
+        }
+        else
+        {
+            m_InputKinds.push_back(InputKind::Channel);
+        }
+    }
+}
+
+void FusedElementwise::Execute(const std::vector<const float*>& inputs, float* output) const
+{
+    const unsigned int numInputs  = static_cast<unsigned int>(m_InputKinds.size());
+    const unsigned int numResults = static_cast<unsigned int>(m_Program.size());
+
+    // One block of storage for every broadcast input and every intermediate result.
+    std::vector<float> scratch(static_cast<size_t>(numInputs + numResults) * BlockSize);
+    std::vector<const float*> operands(numInputs + numResults);
+
+    auto block = [&scratch](unsigned int index)
+    {
+        return scratch.data() + static_cast<size_t>(index) * BlockSize;
+    };
+
+    for (unsigned int start = 0; start < m_NumElements; start += BlockSize)
+    {
+        const unsigned int numElements = std::min(BlockSize, m_NumElements - start);
+
+        for (unsigned int i = 0; i < numInputs; ++i)
+        {
+            switch (m_InputKinds[i])
+            {
+                case InputKind::Full:
+                    operands[i] = inputs[i] + start;
+                    break;
+                case InputKind::Scalar:
+                    std::fill_n(block(i), numElements, inputs[i][0]);
+                    operands[i] = block(i);
+                    break;
+                case InputKind::Channel:
+                {
+                    float* values = block(i);
+                    unsigned int channel = start % m_NumChannels;
+                    for (unsigned int j = 0; j < numElements; ++j)
+                    {
+                        values[j] = inputs[i][channel];
+                        channel = channel + 1 == m_NumChannels ? 0 : channel + 1;
+                    }
+                    operands[i] = values;
+                    break;
+                }
+            }
+        }
+
+        for (unsigned int k = 0; k < numResults; ++k)
+        {
+            const FusedElementwiseOperation& operation = m_Program[k];
+            // The last operation writes straight into the output.
+            float* result = k + 1 == numResults ? output + start : block(numInputs + k);
+            RunOperation(operation,
+                         operands[operation.m_FirstOperand],
+                         operands[operation.m_SecondOperand],
+                         result,
+                         numElements);
+            operands[numInputs + k] = result;
+        }
+    }
+}
+
+void FusedElementwise::RunOperation(const FusedElementwiseOperation& operation,
+                                    const float* first,
+                                    const float* second,
+                                    float* result,
+                                    unsigned int numElements) const
+{
+    switch (operation.m_LayerType)
+    {
+        case LayerType::Activation:
+        {
+            const ActivationDescriptor& activation = operation.m_Activation;
+            for (unsigned int i = 0; i < numElements; ++i)
+            {
+                result[i] = Activation(first[i], activation.m_Function, activation.m_A, activation.m_B);
+            }
+            break;
+        }
+        case LayerType::ElementwiseBinary:
+        {
+            switch (operation.m_Binary.m_Operation)
+            {
+                case BinaryOperation::Add:
+                    ApplyBinary<std::plus<float>>(first, second, result, numElements);
+                    break;
+                case BinaryOperation::Div:
+                    ApplyBinary<std::divides<float>>(first, second, result, numElements);
+                    break;
+                case BinaryOperation::FloorDiv:
+                    ApplyBinary<floorDiv<float>>(first, second, result, numElements);
+                    break;
+                case BinaryOperation::Maximum:
+                    ApplyBinary<maximum<float>>(first, second, result, numElements);
+                    break;
+                case BinaryOperation::Minimum:
+                    ApplyBinary<minimum<float>>(first, second, result, numElements);
+                    break;
+                case BinaryOperation::Mul:
+                    ApplyBinary<std::multiplies<float>>(first, second, result, numElements);
+                    break;
+                case BinaryOperation::Power:
+                    ApplyBinary<power<float>>(first, second, result, numElements);
+                    break;
+                case BinaryOperation::SqDiff:
+                    ApplyBinary<squaredDifference<float>>(first, second, result, numElements);
+                    break;
+                case BinaryOperation::Sub:
+                    ApplyBinary<std::minus<float>>(first, second, result, numElements);
+                    break;
+                default:
+                    throw InvalidArgumentException("Unsupported binary operation in fused elementwise program.");
+            }
+            break;
+        }
+        case LayerType::ElementwiseUnary:
+        {
+            switch (operation.m_Unary.m_Operation)
+            {
+                case UnaryOperation::Abs:
+                    ApplyUnary<abs<float>>(first, result, numElements);
+                    break;
+                case UnaryOperation::Ceil:
+                    ApplyUnary<ceil<float>>(first, result, numElements);
+                    break;
+                case UnaryOperation::Exp:
+                    ApplyUnary<exp<float>>(first, result, numElements);
+                    break;
+                case UnaryOperation::Log:
+                    ApplyUnary<log<float>>(first, result, numElements);
+                    break;
+                case UnaryOperation::Neg:
+                    ApplyUnary<std::negate<float>>(first, result, numElements);
+                    break;
+                case UnaryOperation::Rsqrt:
+                    ApplyUnary<rsqrt<float>>(first, result, numElements);
+                    break;
+                case UnaryOperation::Sin:
+                    ApplyUnary<sin<float>>(first, result, numElements);
+                    break;
+                case UnaryOperation::Sqrt:
+                    ApplyUnary<sqrt<float>>(first, result, numElements);
+                    break;
+                default:
+                    throw InvalidArgumentException("Unsupported unary operation in fused elementwise program.");
+            }
+            break;
+        }
+        default:
+            throw InvalidArgumentException("Unsupported operation in fused elementwise program.");
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,63 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Optional.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+/// Returns true if an input with the given shape can be read by a fused elementwise program producing the given
+/// output shape: either the input has the output shape, holds a single element, or holds one element per channel
+/// (innermost dimension) of the output.
+bool IsFusedElementwiseInputSupported(const TensorShape& input, const TensorShape& output);
+
+/// Returns true if the reference backend can run the given FusedKernelType::Elementwise program.
+bool IsFusedElementwiseSupported(const std::vector<TensorInfo>& inputs,
+                                 const TensorInfo& output,
+                                 const FusedDescriptor& descriptor,
+                                 Optional<std::string&> reasonIfUnsupported = EmptyOptional());
+
+/// Runs the elementwise program of a FusedKernelType::Elementwise FusedLayer on Float32 tensors.
+///
+/// The output is processed in blocks small enough for all inputs and intermediate results of a block to stay in
+/// cache, so that each input is read and the output written exactly once and no intermediate tensor is allocated.
+/// Every operation uses the same functor as the corresponding standalone reference workload.
+class FusedElementwise
+{
+public:
+    FusedElementwise(const FusedDescriptor& descriptor,
+                     const std::vector<TensorInfo>& inputInfos,
+                     const TensorInfo& outputInfo);
+
+    void Execute(const std::vector<const float*>& inputs, float* output) const;
+
+private:
+    enum class InputKind
+    {
+        Full,
+        Scalar,
+        Channel
+    };
+
+    void RunOperation(const FusedElementwiseOperation& operation,
+                      const float* first,
+                      const float* second,
+                      float* result,
+                      unsigned int numElements) const;
+
+    std::vector<FusedElementwiseOperation> m_Program;
+    std::vector<InputKind> m_InputKinds;
+    unsigned int m_NumElements;
+    unsigned int m_NumChannels;
+};
+
+} // namespace armnn
@@ -0,0 +1,383 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "FusedLstm.hpp"
+
+#include "Activation.hpp"
+#include "Decoders.hpp"
+#include "Gemm.hpp"
+#include "LstmUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace armnn
+{
+
+namespace
+{
+
+std::vector<float> DecodeConstant(const ConstTensorHandle* handle)
+{
+    if (!handle)
+    {
+        return {};
+    }
+    const TensorInfo& info = handle->GetTensorInfo();
+    return MakeDecoder<float>(info, handle->Map(true))->DecodeTensor(info.GetShape());
+}
+
+const ConstTensorHandle* RequireConstant(const ConstTensorHandle* handle, const char* name)
+{
+    if (!handle)
+    {
+        throw InvalidArgumentException(std::string("FusedLstm: missing ") + name);
+    }
+    return handle;
+}
+
+} // anonymous namespace
+
+FusedLstm::FusedLstm(const LstmDescriptor& descriptor, const ConstantTensors& tensors, float layerNormEpsilon)
+    : m_Descriptor(descriptor)
+    , m_LayerNormEpsilon(layerNormEpsilon)
+{
+    const bool useCifg = descriptor.m_CifgEnabled;
+
+    const TensorShape& inputToOutputWeightsShape =
+        RequireConstant(tensors.m_InputToOutputWeights, "input to output weights")->GetShape();
+    const TensorShape& recurrentToOutputWeightsShape =
+        RequireConstant(tensors.m_RecurrentToOutputWeights, "recurrent to output weights")->GetShape();
+
+    m_NumCells   = inputToOutputWeightsShape[0];
+    m_NumInputs  = inputToOutputWeightsShape[1];
+    m_NumOutputs = recurrentToOutputWeightsShape[1];
+    m_NumGates   = useCifg ? 3u : 4u;
+
+    // Gate order matches the scratch buffer order of LstmImpl minus the cell/forget swap, which is undone
+    // when the scratch buffer is written.
+    m_InputGate  = 0;
+    m_ForgetGate = (useCifg ? 0u : 1u) * m_NumCells;
+    m_CellGate   = (useCifg ? 1u : 2u) * m_NumCells;
+    m_OutputGate = (useCifg ? 2u : 3u) * m_NumCells;
+
+    const unsigned int columns = m_NumGates * m_NumCells;
+    m_GateWeights.resize(static_cast<size_t>(m_NumInputs + m_NumOutputs) * columns);
+    m_GateBiases.resize(columns);
+
+    auto packGate = [&](unsigned int gateOffset,
+                        const ConstTensorHandle* inputWeights,
+                        const ConstTensorHandle* recurrentWeights,
+                        const ConstTensorHandle* bias)
+    {
+        const std::vector<float> input     = DecodeConstant(RequireConstant(inputWeights, "input weights"));
+        const std::vector<float> recurrent = DecodeConstant(RequireConstant(recurrentWeights, "recurrent weights"));
+        const std::vector<float> biases    = DecodeConstant(RequireConstant(bias, "gate bias"));
+
+        for (unsigned int cell = 0; cell < m_NumCells; ++cell)
+        {
+            for (unsigned int i = 0; i < m_NumInputs; ++i)
+            {
+                m_GateWeights[i * columns + gateOffset + cell] = input[cell * m_NumInputs + i];
+            }
+            for (unsigned int o = 0; o < m_NumOutputs; ++o)
+            {
+                m_GateWeights[(m_NumInputs + o) * columns + gateOffset + cell] = recurrent[cell * m_NumOutputs + o];
+            }
+            m_GateBiases[gateOffset + cell] = biases[cell];
+        }
+    };
+
+    if (!useCifg)
+    {
+        packGate(m_InputGate, tensors.m_InputToInputWeights, tensors.m_RecurrentToInputWeights,
+                 tensors.m_InputGateBias);
+    }
+    packGate(m_ForgetGate, tensors.m_InputToForgetWeights, tensors.m_RecurrentToForgetWeights,
+             tensors.m_ForgetGateBias);
+    packGate(m_CellGate, tensors.m_InputToCellWeights, tensors.m_RecurrentToCellWeights,
+             tensors.m_CellBias);
+    packGate(m_OutputGate, tensors.m_InputToOutputWeights, tensors.m_RecurrentToOutputWeights,
+             tensors.m_OutputGateBias);
+
+    if (descriptor.m_PeepholeEnabled)
+    {
+        if (!useCifg)
+        {
+            m_CellToInputWeights = DecodeConstant(tensors.m_CellToInputWeights);
+        }
+        m_CellToForgetWeights = DecodeConstant(tensors.m_CellToForgetWeights);
+        m_CellToOutputWeights = DecodeConstant(tensors.m_CellToOutputWeights);
+    }
+
+    if (descriptor.m_LayerNormEnabled)
+    {
+        if (!useCifg)
+        {
+            m_InputLayerNormWeights = DecodeConstant(tensors.m_InputLayerNormWeights);
+        }
+        m_ForgetLayerNormWeights = DecodeConstant(tensors.m_ForgetLayerNormWeights);
+        m_CellLayerNormWeights   = DecodeConstant(tensors.m_CellLayerNormWeights);
+        m_OutputLayerNormWeights = DecodeConstant(tensors.m_OutputLayerNormWeights);
+    }
+
+    if (descriptor.m_ProjectionEnabled)
+    {
+        // Stored transposed as [nCell, nOutput] so the projection of all batches is a single GEMM.
+        const std::vector<float> projection =
+            DecodeConstant(RequireConstant(tensors.m_ProjectionWeights, "projection weights"));
+        m_ProjectionWeights.resize(projection.size());
+        for (unsigned int o = 0; o < m_NumOutputs; ++o)
+        {
+            for (unsigned int cell = 0; cell < m_NumCells; ++cell)
+            {
+                m_ProjectionWeights[cell * m_NumOutputs + o] = projection[o * m_NumCells + cell];
+            }
+        }
+        m_ProjectionBias = DecodeConstant(tensors.m_ProjectionBias);
+    }
+
+    SetActivationParameters(descriptor.m_ActivationFunc, m_CellActivation, m_CellActivationA, m_CellActivationB);
+}
+
+void FusedLstm::LayerNormalize(float* gate, const std::vector<float>& layerNormWeights, const float* bias) const
+{
+    // Same as MeanStddevNormalization followed by the layer norm weights and the bias.
+    float sum = 0.0f;
+    float sumSq = 0.0f;
+    for (unsigned int i = 0; i < m_NumCells; ++i)
+    {
+        sum += gate[i];
+        sumSq += gate[i] * gate[i];
+    }
+
+    const float mean = sum / static_cast<float>(m_NumCells);
+    const float variance = sumSq / static_cast<float>(m_NumCells) - mean * mean;
+    const float stddevInv = variance == 0 ? 1.0f / std::sqrt(m_LayerNormEpsilon)
+                                          : 1.0f / std::sqrt(variance);
+
+    for (unsigned int i = 0; i < m_NumCells; ++i)
+    {
+        const float normalized = (gate[i] - mean) * stddevInv;
+        gate[i] = layerNormWeights[i] * normalized + bias[i];
+    }
+}
+
+void FusedLstm::UpdateGates(float* gates,
+                            const float* cellStateIn,
+                            float* cellStateOut,
+                            float* cellOutput,
+                            unsigned int numBatches) const
+{
+    const bool useCifg      = m_Descriptor.m_CifgEnabled;
+    const bool usePeephole  = m_Descriptor.m_PeepholeEnabled;
+    const bool useLayerNorm = m_Descriptor.m_LayerNormEnabled;
+    const bool activateCell = m_Descriptor.m_ActivationFunc > 0;
+    const float cellClip    = m_Descriptor.m_ClippingThresCell;
+
+    const unsigned int columns = m_NumGates * m_NumCells;
+
+    for (unsigned int batch = 0; batch < numBatches; ++batch)
+    {
+        float* row = gates + batch * columns;
+        float* inputGate  = row + m_InputGate;
+        float* forgetGate = row + m_ForgetGate;
+        float* cellGate   = row + m_CellGate;
+        float* outputGate = row + m_OutputGate;
+
+        const float* cellIn = cellStateIn + batch * m_NumCells;
+        float* cellOut = cellStateOut + batch * m_NumCells;
+        float* hidden  = cellOutput + batch * m_NumCells;
+
+        if (!useCifg)
+        {
+            if (usePeephole)
+            {
+                for (unsigned int i = 0; i < m_NumCells; ++i)
+                {
+                    inputGate[i] += m_CellToInputWeights[i] * cellIn[i];
+                }
+            }
+            if (useLayerNorm)
+            {
+                LayerNormalize(inputGate, m_InputLayerNormWeights, m_GateBiases.data() + m_InputGate);
+            }
+            for (unsigned int i = 0; i < m_NumCells; ++i)
+            {
+                inputGate[i] = Activation(inputGate[i], ActivationFunction::Sigmoid, 0, 0);
+            }
+        }
+
+        if (usePeephole)
+        {
+            for (unsigned int i = 0; i < m_NumCells; ++i)
+            {
+                forgetGate[i] += m_CellToForgetWeights[i] * cellIn[i];
+            }
+        }
+        if (useLayerNorm)
+        {
+            LayerNormalize(forgetGate, m_ForgetLayerNormWeights, m_GateBiases.data() + m_ForgetGate);
+            LayerNormalize(cellGate, m_CellLayerNormWeights, m_GateBiases.data() + m_CellGate);
+        }
+
+        // Cell update: c = f * c_prev + g * i, with i = 1 - f for CIFG.
+        for (unsigned int i = 0; i < m_NumCells; ++i)
+        {
+            forgetGate[i] = Activation(forgetGate[i], ActivationFunction::Sigmoid, 0, 0);
+            float cell = forgetGate[i] * cellIn[i];
+
+            if (activateCell)
+            {
+                cellGate[i] = Activation(cellGate[i], m_CellActivation, m_CellActivationA, m_CellActivationB);
+            }
+            if (useCifg)
+            {
+                forgetGate[i] = 1.0f - forgetGate[i];
+                cell += cellGate[i] * forgetGate[i];
+            }
+            else
+            {
+                cell += cellGate[i] * inputGate[i];
+            }
+            cellOut[i] = cellClip > 0.0f ? Clip(cell, cellClip) : cell;
+        }
+
+        if (usePeephole)
+        {
+            for (unsigned int i = 0; i < m_NumCells; ++i)
+            {
+                outputGate[i] += m_CellToOutputWeights[i] * cellOut[i];
+            }
+        }
+        if (useLayerNorm)
+        {
+            LayerNormalize(outputGate, m_OutputLayerNormWeights, m_GateBiases.data() + m_OutputGate);
+        }
+
+        for (unsigned int i = 0; i < m_NumCells; ++i)
+        {
+            outputGate[i] = Activation(outputGate[i], ActivationFunction::Sigmoid, 0, 0);
+            // As in LstmImpl, without a cell activation the output gate is applied to the cell gate.
+            if (activateCell)
+            {
+                cellGate[i] = Activation(cellOut[i], m_CellActivation, m_CellActivationA, m_CellActivationB);
+            }
+            hidden[i] = outputGate[i] * cellGate[i];
+            outputGate[i] = hidden[i];
+        }
+    }
+}
+
+void FusedLstm::Execute(const float* input,
+                        unsigned int numSteps,
+                        unsigned int numBatches,
+                        const float* outputStateIn,
+                        const float* cellStateIn,
+                        float* output,
+                        float* outputStateOut,
+                        float* cellStateOut,
+                        float* scratch) const
+{
+    const unsigned int columns = m_NumGates * m_NumCells;
+    const unsigned int rows    = numSteps * numBatches;
+
+    // Gate pre-activations for every timestep. Without layer normalization the biases are added up front,
+    // otherwise they are added after the normalization.
+    std::vector<float> gates(static_cast<size_t>(rows) * columns, 0.0f);
+    if (!m_Descriptor.m_LayerNormEnabled)
+    {
+        for (unsigned int row = 0; row < rows; ++row)
+        {
+            std::copy(m_GateBiases.begin(), m_GateBiases.end(), gates.begin() + row * columns);
+        }
+    }
+
+    // The input contribution does not depend on the recurrence, so do all timesteps in one GEMM.
+    Gemm(rows, columns, m_NumInputs, input, m_GateWeights.data(), gates.data(), true);
+
+    const float* recurrentWeights = m_GateWeights.data() + static_cast<size_t>(m_NumInputs) * columns;
+
+    std::vector<float> outputState(outputStateIn, outputStateIn + numBatches * m_NumOutputs);
+    std::vector<float> cellState(cellStateIn, cellStateIn + numBatches * m_NumCells);
+    std::vector<float> nextCellState(cellState.size());
+    std::vector<float> cellOutput(static_cast<size_t>(numBatches) * m_NumCells);
+
+    const float projectionClip = m_Descriptor.m_ClippingThresProj;
+
+    for (unsigned int step = 0; step < numSteps; ++step)
+    {
+        float* stepGates = gates.data() + static_cast<size_t>(step) * numBatches * columns;
+        float* stepOutput = output + static_cast<size_t>(step) * numBatches * m_NumOutputs;
+
+        Gemm(numBatches, columns, m_NumOutputs, outputState.data(), recurrentWeights, stepGates, true);
+
+        UpdateGates(stepGates, cellState.data(), nextCellState.data(), cellOutput.data(), numBatches);
+
+        if (m_Descriptor.m_ProjectionEnabled)
+        {
+            for (unsigned int batch = 0; batch < numBatches; ++batch)
+            {
+                float* outputRow = stepOutput + batch * m_NumOutputs;
+                if (m_ProjectionBias.empty())
+                {
+                    std::fill(outputRow, outputRow + m_NumOutputs, 0.0f);
+                }
+                else
+                {
+                    std::copy(m_ProjectionBias.begin(), m_ProjectionBias.end(), outputRow);
+                }
+            }
+            Gemm(numBatches, m_NumOutputs, m_NumCells, cellOutput.data(), m_ProjectionWeights.data(), stepOutput,
+                 true);
+
+            if (projectionClip > 0.0f)
+            {
+                for (unsigned int i = 0; i < numBatches * m_NumOutputs; ++i)
+                {
+                    stepOutput[i] = Clip(stepOutput[i], projectionClip);
+                }
+            }
+        }
+        else
+        {
+            std::copy(cellOutput.begin(), cellOutput.begin() + numBatches * m_NumOutputs, stepOutput);
+        }
+
+        std::copy(stepOutput, stepOutput + numBatches * m_NumOutputs, outputState.begin());
+        std::swap(cellState, nextCellState);
+    }
+
+    std::copy(outputState.begin(), outputState.end(), outputStateOut);
+    std::copy(cellState.begin(), cellState.end(), cellStateOut);
+
+    if (scratch && numSteps > 0)
+    {
+        // LstmImpl lays its scratch buffer out as [input,] cell, forget, output, each [numBatches, nCell].
+        const float* lastGates = gates.data() + static_cast<size_t>(numSteps - 1) * numBatches * columns;
+        const unsigned int gateSize = numBatches * m_NumCells;
+        const bool useCifg = m_Descriptor.m_CifgEnabled;
+
+        auto writeGate = [&](unsigned int scratchIndex, unsigned int gateOffset)
+        {
+            for (unsigned int batch = 0; batch < numBatches; ++batch)
+            {
+                const float* source = lastGates + batch * columns + gateOffset;
+                std::copy(source, source + m_NumCells, scratch + scratchIndex * gateSize + batch * m_NumCells);
+            }
+        };
+
+        if (!useCifg)
+        {
+            writeGate(0, m_InputGate);
+        }
+        const unsigned int first = useCifg ? 0u : 1u;
+        writeGate(first, m_CellGate);
+        writeGate(first + 1, m_ForgetGate);
+        writeGate(first + 2, m_OutputGate);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,153 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/backends/TensorHandle.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Float LSTM engine shared by RefLstmWorkload and RefUnidirectionalSequenceLstmWorkload.
+///
+/// The input-to-gate and recurrent-to-gate weights of all gates are decoded once and packed into a single
+/// row-major [nInput + nOutput, numGates * nCell] matrix (the transpose of the concatenated gate matrices), so that
+/// the input contribution of every timestep is computed with one GEMM and each step only needs one GEMM for the
+/// recurrent contribution, followed by a single fused pass for peepholes, layer normalization, activations and the
+/// cell update. The arithmetic is performed in the same order as LstmImpl.
+class FusedLstm
+{
+public:
+    /// Constant tensors of an LSTM layer. Pointers are null for tensors the configuration does not use.
+    struct ConstantTensors
+    {
+        const ConstTensorHandle* m_InputToInputWeights      = nullptr;
+        const ConstTensorHandle* m_InputToForgetWeights     = nullptr;
+        const ConstTensorHandle* m_InputToCellWeights       = nullptr;
+        const ConstTensorHandle* m_InputToOutputWeights     = nullptr;
+        const ConstTensorHandle* m_RecurrentToInputWeights  = nullptr;
+        const ConstTensorHandle* m_RecurrentToForgetWeights = nullptr;
+        const ConstTensorHandle* m_RecurrentToCellWeights   = nullptr;
+        const ConstTensorHandle* m_RecurrentToOutputWeights = nullptr;
+        const ConstTensorHandle* m_CellToInputWeights       = nullptr;
+        const ConstTensorHandle* m_CellToForgetWeights      = nullptr;
+        const ConstTensorHandle* m_CellToOutputWeights      = nullptr;
+        const ConstTensorHandle* m_InputGateBias            = nullptr;
+        const ConstTensorHandle* m_ForgetGateBias           = nullptr;
+        const ConstTensorHandle* m_CellBias                 = nullptr;
+        const ConstTensorHandle* m_OutputGateBias           = nullptr;
+        const ConstTensorHandle* m_ProjectionWeights        = nullptr;
+        const ConstTensorHandle* m_ProjectionBias           = nullptr;
+        const ConstTensorHandle* m_InputLayerNormWeights    = nullptr;
+        const ConstTensorHandle* m_ForgetLayerNormWeights   = nullptr;
+        const ConstTensorHandle* m_CellLayerNormWeights     = nullptr;
+        const ConstTensorHandle* m_OutputLayerNormWeights   = nullptr;
+    };
+
+    /// Collects the constant tensors of an LstmQueueDescriptor or UnidirectionalSequenceLstmQueueDescriptor.
+    template <typename LstmQueueDescriptorType>
+    static ConstantTensors GetConstantTensors(const LstmQueueDescriptorType& descriptor)
+    {
+        ConstantTensors tensors;
+        tensors.m_InputToInputWeights      = descriptor.m_InputToInputWeights;
+        tensors.m_InputToForgetWeights     = descriptor.m_InputToForgetWeights;
+        tensors.m_InputToCellWeights       = descriptor.m_InputToCellWeights;
+        tensors.m_InputToOutputWeights     = descriptor.m_InputToOutputWeights;
+        tensors.m_RecurrentToInputWeights  = descriptor.m_RecurrentToInputWeights;
+        tensors.m_RecurrentToForgetWeights = descriptor.m_RecurrentToForgetWeights;
+        tensors.m_RecurrentToCellWeights   = descriptor.m_RecurrentToCellWeights;
+        tensors.m_RecurrentToOutputWeights = descriptor.m_RecurrentToOutputWeights;
+        tensors.m_CellToInputWeights       = descriptor.m_CellToInputWeights;
+        tensors.m_CellToForgetWeights      = descriptor.m_CellToForgetWeights;
+        tensors.m_CellToOutputWeights      = descriptor.m_CellToOutputWeights;
+        tensors.m_InputGateBias            = descriptor.m_InputGateBias;
+        tensors.m_ForgetGateBias           = descriptor.m_ForgetGateBias;
+        tensors.m_CellBias                 = descriptor.m_CellBias;
+        tensors.m_OutputGateBias           = descriptor.m_OutputGateBias;
+        tensors.m_ProjectionWeights        = descriptor.m_ProjectionWeights;
+        tensors.m_ProjectionBias           = descriptor.m_ProjectionBias;
+        tensors.m_InputLayerNormWeights    = descriptor.m_InputLayerNormWeights;
+        tensors.m_ForgetLayerNormWeights   = descriptor.m_ForgetLayerNormWeights;
+        tensors.m_CellLayerNormWeights     = descriptor.m_CellLayerNormWeights;
+        tensors.m_OutputLayerNormWeights   = descriptor.m_OutputLayerNormWeights;
+        return tensors;
+    }
+
+    FusedLstm(const LstmDescriptor& descriptor, const ConstantTensors& tensors, float layerNormEpsilon);
+
+    unsigned int GetNumInputs() const { return m_NumInputs; }
+    unsigned int GetNumCells() const { return m_NumCells; }
+    unsigned int GetNumOutputs() const { return m_NumOutputs; }
+
+    /// Runs numSteps timesteps of the LSTM on time major float data.
+    /// @param input          [numSteps, numBatches, nInput]
+    /// @param outputStateIn  [numBatches, nOutput]
+    /// @param cellStateIn    [numBatches, nCell]
+    /// @param output         [numSteps, numBatches, nOutput]
+    /// @param outputStateOut [numBatches, nOutput], the output of the last step.
+    /// @param cellStateOut   [numBatches, nCell], the cell state after the last step.
+    /// @param scratch        Optional. Receives the gate values of the last step in the layout LstmImpl uses for
+    ///                       its scratch buffer.
+    void Execute(const float* input,
+                 unsigned int numSteps,
+                 unsigned int numBatches,
+                 const float* outputStateIn,
+                 const float* cellStateIn,
+                 float* output,
+                 float* outputStateOut,
+                 float* cellStateOut,
+                 float* scratch = nullptr) const;
+
+private:
+    void UpdateGates(float* gates,
+                     const float* cellStateIn,
+                     float* cellStateOut,
+                     float* cellOutput,
+                     unsigned int numBatches) const;
+
+    void LayerNormalize(float* gate, const std::vector<float>& layerNormWeights, const float* bias) const;
+
+    LstmDescriptor m_Descriptor;
+    float m_LayerNormEpsilon;
+
+    unsigned int m_NumInputs;
+    unsigned int m_NumCells;
+    unsigned int m_NumOutputs;
+    unsigned int m_NumGates;
+
+    // Column offset of each gate inside a row of gate pre-activations. The input gate is absent with CIFG.
+    unsigned int m_InputGate;
+    unsigned int m_ForgetGate;
+    unsigned int m_CellGate;
+    unsigned int m_OutputGate;
+
+    /// [nInput + nOutput, numGates * nCell]: the first nInput rows hold the input weights, the rest the
+    /// recurrent weights.
+    std::vector<float> m_GateWeights;
+    /// [numGates * nCell]
+    std::vector<float> m_GateBiases;
+
+    std::vector<float> m_CellToInputWeights;
+    std::vector<float> m_CellToForgetWeights;
+    std::vector<float> m_CellToOutputWeights;
+
+    std::vector<float> m_InputLayerNormWeights;
+    std::vector<float> m_ForgetLayerNormWeights;
+    std::vector<float> m_CellLayerNormWeights;
+    std::vector<float> m_OutputLayerNormWeights;
+
+    /// [nCell, nOutput]
+    std::vector<float> m_ProjectionWeights;
+    std::vector<float> m_ProjectionBias;
+
+    ActivationFunction m_CellActivation;
+    float m_CellActivationA;
+    float m_CellActivationB;
+};
+
+} // namespace armnn
@@ -0,0 +1,57 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Gemm.hpp"
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+// Number of columns of C (and B) processed together, sized so the C tile stays in the L1 cache while
+// the rows of B are streamed through it.
+constexpr unsigned int gemmColumnBlock = 256;
+} // anonymous namespace
+
+void Gemm(unsigned int M,
+          unsigned int N,
+          unsigned int K,
+          const float* A,
+          const float* B,
+          float* C,
+          bool accumulate)
+{
+    if (!accumulate)
+    {
+        std::fill(C, C + static_cast<size_t>(M) * N, 0.0f);
+    }
+
+    for (unsigned int columnStart = 0; columnStart < N; columnStart += gemmColumnBlock)
+    {
+        const unsigned int columnEnd = std::min(columnStart + gemmColumnBlock, N);
+
+        for (unsigned int m = 0; m < M; ++m)
+        {
+            const float* aRow = A + static_cast<size_t>(m) * K;
+            float* cRow = C + static_cast<size_t>(m) * N;
+
+            // k outer, n inner: the innermost loop is a contiguous multiply-add over a row of B and C
+            // which the compiler vectorizes.
+            for (unsigned int k = 0; k < K; ++k)
+            {
+                const float a = aRow[k];
+                const float* bRow = B + static_cast<size_t>(k) * N;
+                for (unsigned int n = columnStart; n < columnEnd; ++n)
+                {
+                    cRow[n] += a * bRow[n];
+                }
+            }
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,22 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+namespace armnn
+{
+
+/// Computes C = A * B for row-major float matrices, with A of size [M, K], B of size [K, N] and C of size [M, N].
+/// If accumulate is true the product is added to the existing contents of C instead.
+/// Every element of C accumulates its K products in order, so results match a naive dot product loop.
+void Gemm(unsigned int M,
+          unsigned int N,
+          unsigned int K,
+          const float* A,
+          const float* B,
+          float* C,
+          bool accumulate = false);
+
+} // namespace armnn
@@ -7,6 +7,7 @@
 
 #include <armnn/Exceptions.hpp>
 #include <armnn/Types.hpp>
+#include <armnn/TypesUtils.hpp>
 
 #include <armnnUtils/DataLayoutIndexed.hpp>
 #include <armnn/utility/NumericCast.hpp>
@@ -14,6 +15,7 @@
 #include <limits>
 #include <algorithm>
 #include <functional>
+#include <vector>
 
 namespace
 {
@@ -133,6 +135,215 @@ namespace
             return false;
         }
     }
+
+    /// Window of input coordinates pooled into a single output coordinate along one spatial axis.
+    struct PoolingRange
+    {
+        int m_Start;       ///< First input coordinate inside the tensor (inclusive).
+        int m_End;         ///< Last input coordinate inside the tensor (exclusive).
+        int m_PaddedSize;  ///< Size of the window including the padding, used by PaddingMethod::IgnoreValue.
+        bool m_PaddingOnly;
+    };
+
+    /// Computes the pooling windows for every output coordinate along one axis. This mirrors the per element
+    /// window calculations done in Pooling2d so that both paths produce identical results.
+    std::vector<PoolingRange> ComputePoolingRanges(int outputSize, int inputSize, int stride,
+                                                   int padBefore, int padAfter, int poolSize)
+    {
+        std::vector<PoolingRange> ranges(static_cast<size_t>(outputSize));
+        for (int i = 0; i < outputSize; ++i)
+        {
+            int start = (i * stride) - padBefore;
+            int end   = std::min(start + poolSize, inputSize + padAfter);
+
+            PoolingRange& range = ranges[static_cast<size_t>(i)];
+            range.m_PaddedSize  = end - start;
+            range.m_PaddingOnly = OnPaddingOnly(start, end, inputSize);
+            ClampRange(start, end, inputSize);
+            range.m_Start = start;
+            range.m_End   = end;
+        }
+        return ranges;
+    }
+
+    struct PoolingShape
+    {
+        unsigned int m_Batches;
+        unsigned int m_Channels;
+        unsigned int m_InputHeight;
+        unsigned int m_InputWidth;
+        unsigned int m_OutputHeight;
+        unsigned int m_OutputWidth;
+    };
+
+    template <typename T>
+    const T* InputPixel(const T* input, const PoolingShape& shape, unsigned int n, int y, int x)
+    {
+        return input + ((n * shape.m_InputHeight + static_cast<unsigned int>(y)) * shape.m_InputWidth +
+                        static_cast<unsigned int>(x)) * shape.m_Channels;
+    }
+
+    /// Max pooling of NHWC data. Works directly in the data type of the tensor, which is exact for quantized
+    /// data as long as input and output share the same quantization parameters.
+    template <typename T>
+    void MaxPoolingNhwc(const T* input,
+                        T* output,
+                        const PoolingShape& shape,
+                        const std::vector<PoolingRange>& rows,
+                        const std::vector<PoolingRange>& cols,
+                        T paddingOnlyValue)
+    {
+        const unsigned int channels = shape.m_Channels;
+        for (unsigned int n = 0; n < shape.m_Batches; ++n)
+        {
+            for (const PoolingRange& row : rows)
+            {
+                for (const PoolingRange& col : cols)
+                {
+                    T* out = output;
+                    output += channels;
+
+                    if (row.m_PaddingOnly || col.m_PaddingOnly)
+                    {
+                        std::fill(out, out + channels, paddingOnlyValue);
+                        continue;
+                    }
+
+                    std::fill(out, out + channels, std::numeric_limits<T>::lowest());
+                    for (int y = row.m_Start; y < row.m_End; ++y)
+                    {
+                        for (int x = col.m_Start; x < col.m_End; ++x)
+                        {
+                            const T* in = InputPixel(input, shape, n, y, x);
+                            for (unsigned int c = 0; c < channels; ++c)
+                            {
+                                out[c] = out[c] < in[c] ? in[c] : out[c];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    int PoolAreaSize(const PoolingRange& row, const PoolingRange& col, armnn::PaddingMethod paddingMethod)
+    {
+        if (paddingMethod == armnn::PaddingMethod::Exclude)
+        {
+            return (row.m_End - row.m_Start) * (col.m_End - col.m_Start);
+        }
+        return row.m_PaddedSize * col.m_PaddedSize;
+    }
+
+    void AveragePoolingNhwc(const float* input,
+                            float* output,
+                            const PoolingShape& shape,
+                            const std::vector<PoolingRange>& rows,
+                            const std::vector<PoolingRange>& cols,
+                            armnn::PaddingMethod paddingMethod)
+    {
+        const unsigned int channels = shape.m_Channels;
+        for (unsigned int n = 0; n < shape.m_Batches; ++n)
+        {
+            for (const PoolingRange& row : rows)
+            {
+                for (const PoolingRange& col : cols)
+                {
+                    float* out = output;
+                    output += channels;
+
+                    std::fill(out, out + channels, 0.0f);
+                    if (row.m_PaddingOnly || col.m_PaddingOnly)
+                    {
+                        continue;
+                    }
+
+                    // The output row doubles as the accumulator, summing in the same order as Pooling2d.
+                    for (int y = row.m_Start; y < row.m_End; ++y)
+                    {
+                        for (int x = col.m_Start; x < col.m_End; ++x)
+                        {
+                            const float* in = InputPixel(input, shape, n, y, x);
+                            for (unsigned int c = 0; c < channels; ++c)
+                            {
+                                out[c] += in[c];
+                            }
+                        }
+                    }
+
+                    const float poolAreaSize = static_cast<float>(PoolAreaSize(row, col, paddingMethod));
+                    for (unsigned int c = 0; c < channels; ++c)
+                    {
+                        out[c] /= poolAreaSize;
+                    }
+                }
+            }
+        }
+    }
+
+    /// Average pooling of quantized NHWC data with input and output sharing the same quantization parameters.
+    /// The sum is accumulated in int32 and divided with rounding half away from zero, matching armnn::Quantize.
+    template <typename T>
+    void QuantizedAveragePoolingNhwc(const T* input,
+                                     T* output,
+                                     const PoolingShape& shape,
+                                     const std::vector<PoolingRange>& rows,
+                                     const std::vector<PoolingRange>& cols,
+                                     armnn::PaddingMethod paddingMethod,
+                                     int32_t offset)
+    {
+        constexpr int32_t min = std::numeric_limits<T>::lowest();
+        constexpr int32_t max = std::numeric_limits<T>::max();
+        const T zero = static_cast<T>(std::min(std::max(offset, min), max));
+
+        const unsigned int channels = shape.m_Channels;
+        std::vector<int32_t> accumulator(channels);
+
+        for (unsigned int n = 0; n < shape.m_Batches; ++n)
+        {
+            for (const PoolingRange& row : rows)
+            {
+                for (const PoolingRange& col : cols)
+                {
+                    T* out = output;
+                    output += channels;
+
+                    const int poolAreaSize = PoolAreaSize(row, col, paddingMethod);
+                    if (row.m_PaddingOnly || col.m_PaddingOnly || poolAreaSize == 0)
+                    {
+                        std::fill(out, out + channels, zero);
+                        continue;
+                    }
+
+                    std::fill(accumulator.begin(), accumulator.end(), 0);
+                    for (int y = row.m_Start; y < row.m_End; ++y)
+                    {
+                        for (int x = col.m_Start; x < col.m_End; ++x)
+                        {
+                            const T* in = InputPixel(input, shape, n, y, x);
+                            for (unsigned int c = 0; c < channels; ++c)
+                            {
+                                accumulator[c] += in[c];
+                            }
+                        }
+                    }
+
+                    // Padded elements in the area represent the real value zero, so remove the offset only
+                    // for the elements that were actually read.
+                    const int32_t count = (row.m_End - row.m_Start) * (col.m_End - col.m_Start);
+                    const int32_t bias  = offset * count;
+                    const int32_t half  = poolAreaSize / 2;
+                    for (unsigned int c = 0; c < channels; ++c)
+                    {
+                        const int32_t sum = accumulator[c] - bias;
+                        const int32_t average = sum >= 0 ? (sum + half) / poolAreaSize
+                                                         : -((half - sum) / poolAreaSize);
+                        out[c] = static_cast<T>(std::min(std::max(average + offset, min), max));
+                    }
+                }
+            }
+        }
+    }
 }
 
 using namespace armnnUtils;
@@ -302,4 +513,113 @@ void Pooling2d(Decoder<float>& rInputDecoder,
     }
 }
 
+bool IsPooling2dNhwcFastPathSupported(const TensorInfo& inputInfo,
+                                      const TensorInfo& outputInfo,
+                                      const Pooling2dDescriptor& params)
+{
+    if (params.m_DataLayout != DataLayout::NHWC ||
+        (params.m_PoolType != PoolingAlgorithm::Max && params.m_PoolType != PoolingAlgorithm::Average) ||
+        (params.m_PaddingMethod != PaddingMethod::Exclude && params.m_PaddingMethod != PaddingMethod::IgnoreValue) ||
+        inputInfo.GetNumDimensions() != 4 ||
+        inputInfo.GetDataType() != outputInfo.GetDataType())
+    {
+        return false;
+    }
+
+    switch (inputInfo.GetDataType())
+    {
+        case DataType::Float32:
+            return true;
+        case DataType::QAsymmU8:
+        case DataType::QAsymmS8:
+            return !inputInfo.HasPerAxisQuantization() &&
+                   !outputInfo.HasPerAxisQuantization() &&
+                   inputInfo.GetQuantizationScale() == outputInfo.GetQuantizationScale() &&
+                   inputInfo.GetQuantizationOffset() == outputInfo.GetQuantizationOffset();
+        default:
+            return false;
+    }
+}
+
+void Pooling2dNhwc(const void* inputData,
+                   void* outputData,
+                   const TensorInfo& inputInfo,
+                   const TensorInfo& outputInfo,
+                   const Pooling2dDescriptor& params)
+{
+    const TensorShape& inputShape  = inputInfo.GetShape();
+    const TensorShape& outputShape = outputInfo.GetShape();
+
+    const PoolingShape shape { outputShape[0], outputShape[3], inputShape[1], inputShape[2],
+                               outputShape[1], outputShape[2] };
+
+    const std::vector<PoolingRange> rows =
+        ComputePoolingRanges(armnn::numeric_cast<int>(shape.m_OutputHeight),
+                             armnn::numeric_cast<int>(shape.m_InputHeight),
+                             armnn::numeric_cast<int>(params.m_StrideY),
+                             armnn::numeric_cast<int>(params.m_PadTop),
+                             armnn::numeric_cast<int>(params.m_PadBottom),
+                             armnn::numeric_cast<int>(params.m_PoolHeight));
+    const std::vector<PoolingRange> cols =
+        ComputePoolingRanges(armnn::numeric_cast<int>(shape.m_OutputWidth),
+                             armnn::numeric_cast<int>(shape.m_InputWidth),
+                             armnn::numeric_cast<int>(params.m_StrideX),
+                             armnn::numeric_cast<int>(params.m_PadLeft),
+                             armnn::numeric_cast<int>(params.m_PadRight),
+                             armnn::numeric_cast<int>(params.m_PoolWidth));
+
+    const bool isMax = params.m_PoolType == PoolingAlgorithm::Max;
+    const int32_t offset = outputInfo.GetQuantizationOffset();
+
+    switch (inputInfo.GetDataType())
+    {
+        case DataType::Float32:
+        {
+            const float* input = static_cast<const float*>(inputData);
+            float* output      = static_cast<float*>(outputData);
+            if (isMax)
+            {
+                MaxPoolingNhwc(input, output, shape, rows, cols, 0.0f);
+            }
+            else
+            {
+                AveragePoolingNhwc(input, output, shape, rows, cols, params.m_PaddingMethod);
+            }
+            break;
+        }
+        case DataType::QAsymmU8:
+        {
+            const uint8_t* input = static_cast<const uint8_t*>(inputData);
+            uint8_t* output      = static_cast<uint8_t*>(outputData);
+            if (isMax)
+            {
+                MaxPoolingNhwc(input, output, shape, rows, cols, Quantize<uint8_t>(0.0f, 1.0f, offset));
+            }
+            else
+            {
+                QuantizedAveragePoolingNhwc(input, output, shape, rows, cols, params.m_PaddingMethod, offset);
+            }
+            break;
+        }
+        case DataType::QAsymmS8:
+        {
+            const int8_t* input = static_cast<const int8_t*>(inputData);
+            int8_t* output      = static_cast<int8_t*>(outputData);
+            if (isMax)
+            {
+                MaxPoolingNhwc(input, output, shape, rows, cols, Quantize<int8_t>(0.0f, 1.0f, offset));
+            }
+            else
+            {
+                QuantizedAveragePoolingNhwc(input, output, shape, rows, cols, params.m_PaddingMethod, offset);
+            }
+            break;
+        }
+        default:
+        {
+            throw armnn::InvalidArgumentException("Pooling2dNhwc: Unsupported data type");
+        }
+    }
+}
+
 } //namespace armnn
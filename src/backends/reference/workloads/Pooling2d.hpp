@@ -18,4 +18,18 @@ void Pooling2d(Decoder<float>& rInputDecoder,
                const TensorInfo& inputInfo,
                const TensorInfo& outputInfo,
                const Pooling2dDescriptor& params);
+
+/// Returns true if the Pooling2d operation can be computed by Pooling2dNhwc, i.e. Max or Average pooling of
+/// NHWC Float32 data, or of QAsymmU8/QAsymmS8 data whose input and output share the same quantization parameters.
+bool IsPooling2dNhwcFastPathSupported(const TensorInfo& inputInfo,
+                                      const TensorInfo& outputInfo,
+                                      const Pooling2dDescriptor& params);
+
+/// Computes the Pooling2d operation directly on the raw tensor data with the channels in the innermost loop.
+/// Quantized inputs are pooled in integer arithmetic. Only valid if IsPooling2dNhwcFastPathSupported returns true.
+void Pooling2dNhwc(const void* inputData,
+                   void* outputData,
+                   const TensorInfo& inputInfo,
+                   const TensorInfo& outputInfo,
+                   const Pooling2dDescriptor& params);
 } //namespace armnn
@@ -1,5 +1,5 @@
 //
-// Copyright © 2019-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2019-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -26,7 +26,13 @@ void RefConstantWorkload::Execute() const
 void RefConstantWorkload::Execute(std::vector<ITensorHandle*> outputs) const
 {
     ARMNN_SCOPED_PROFILING_EVENT_REF_NAME_GUID("RefConstantWorkload_Execute");
-    memcpy(outputs[0]->Map(), m_Data.m_LayerOutput->GetConstTensor<void>(), GetTensorInfo(outputs[0]).GetNumBytes());
+    void* output = outputs[0]->Map();
+    const void* constant = m_Data.m_LayerOutput->GetConstTensor<void>();
+    // The output may have imported the memory of the constant, rather than hold a copy of it
+    if (output != constant)
+    {
+        memcpy(output, constant, GetTensorInfo(outputs[0]).GetNumBytes());
+    }
 }
 
 } //namespace armnn
@@ -50,7 +50,7 @@ void RefDetectionPostProcessWorkload::Execute(std::vector<ITensorHandle*> inputs
                          detectionBoxesInfo, detectionClassesInfo,
                          detectionScoresInfo, numDetectionsInfo, m_Data.m_Parameters,
                          *boxEncodings, *scores, *anchors, detectionBoxes,
-                         detectionClasses, detectionScores, numDetections);
+                         detectionClasses, detectionScores, numDetections, m_Scratch);
 }
 
 } //namespace armnn
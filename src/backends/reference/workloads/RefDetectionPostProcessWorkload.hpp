@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "DetectionPostProcess.hpp"
 #include "RefBaseWorkload.hpp"
 #include <armnn/backends/WorkloadData.hpp>
 
@@ -21,6 +22,9 @@ public:
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
     std::unique_ptr<ScopedTensorHandle> m_Anchors;
+
+    /// Reused by every execution so that steady-state inference does not allocate.
+    mutable DetectionPostProcessScratch m_Scratch;
 };
 
 } //namespace armnn
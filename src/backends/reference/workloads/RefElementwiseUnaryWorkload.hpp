@@ -1,5 +1,5 @@
 //
-// Copyright © 2022, 2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022, 2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -21,6 +21,11 @@ public:
     RefElementwiseUnaryWorkload(const ElementwiseUnaryQueueDescriptor& descriptor, const WorkloadInfo& info);
     void Execute() const override;
 
+    std::vector<std::pair<unsigned int, unsigned int>> GetInPlaceSlots() const override
+    {
+        return { { 0, 0 } };
+    }
+
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
     using InType  = float;
@@ -0,0 +1,38 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefFusedWorkload.hpp"
+
+#include "RefWorkloadUtils.hpp"
+#include "Profiling.hpp"
+
+namespace armnn
+{
+
+RefFusedWorkload::RefFusedWorkload(const FusedQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : RefBaseWorkload<FusedQueueDescriptor>(descriptor, info)
+    , m_FusedElementwise(descriptor.m_Parameters, info.m_InputTensorInfos, info.m_OutputTensorInfos[0])
+{}
+
+void RefFusedWorkload::Execute() const
+{
+    Execute(m_Data.m_Inputs, m_Data.m_Outputs);
+}
+
+void RefFusedWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const
+{
+    ARMNN_SCOPED_PROFILING_EVENT_REF_NAME_GUID("RefFusedWorkload_Execute");
+
+    std::vector<const float*> inputData;
+    inputData.reserve(inputs.size());
+    for (ITensorHandle* input : inputs)
+    {
+        inputData.push_back(static_cast<const float*>(input->Map()));
+    }
+
+    m_FusedElementwise.Execute(inputData, GetOutputTensorData<float>(outputs[0]));
+}
+
+} // namespace armnn
@@ -0,0 +1,29 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "FusedElementwise.hpp"
+#include "RefBaseWorkload.hpp"
+
+#include <armnn/backends/WorkloadData.hpp>
+
+namespace armnn
+{
+
+/// Runs FusedLayers of type FusedKernelType::Elementwise.
+class RefFusedWorkload : public RefBaseWorkload<FusedQueueDescriptor>
+{
+public:
+    explicit RefFusedWorkload(const FusedQueueDescriptor& descriptor, const WorkloadInfo& info);
+    void Execute() const override;
+
+private:
+    void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
+
+    FusedElementwise m_FusedElementwise;
+};
+
+} // namespace armnn
@@ -11,6 +11,8 @@
 #include "LstmUtils.hpp"
 #include "RefWorkloadUtils.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
@@ -37,7 +39,19 @@ RefLstmWorkload::RefLstmWorkload(const LstmQueueDescriptor &descriptor, const Wo
     , m_ForgetLayerNormWeights        (AssignScopedTensorHandle(descriptor.m_ForgetLayerNormWeights))
     , m_CellLayerNormWeights          (AssignScopedTensorHandle(descriptor.m_CellLayerNormWeights))
     , m_OutputLayerNormWeights        (AssignScopedTensorHandle(descriptor.m_OutputLayerNormWeights))
-{}
+{
+    const bool isFloat32 =
+        std::all_of(info.m_InputTensorInfos.begin(), info.m_InputTensorInfos.end(),
+                    [](const TensorInfo& tensorInfo) { return tensorInfo.GetDataType() == DataType::Float32; }) &&
+        std::all_of(info.m_OutputTensorInfos.begin(), info.m_OutputTensorInfos.end(),
+                    [](const TensorInfo& tensorInfo) { return tensorInfo.GetDataType() == DataType::Float32; });
+    if (isFloat32)
+    {
+        m_FusedLstm = std::make_unique<FusedLstm>(descriptor.m_Parameters,
+                                                  FusedLstm::GetConstantTensors(descriptor),
+                                                  m_LayerNormEpsilon);
+    }
+}
 
 void RefLstmWorkload::Execute() const
 {
@@ -56,6 +70,20 @@ void RefLstmWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<IT
 
     const TensorShape& inputShape = inputInfo.GetShape();
 
+    if (m_FusedLstm)
+    {
+        m_FusedLstm->Execute(reinterpret_cast<const float*>(inputs[0]->Map()),
+                             1,
+                             inputShape[0],
+                             reinterpret_cast<const float*>(inputs[1]->Map()),
+                             reinterpret_cast<const float*>(inputs[2]->Map()),
+                             reinterpret_cast<float*>(outputs[3]->Map()),
+                             reinterpret_cast<float*>(outputs[1]->Map()),
+                             reinterpret_cast<float*>(outputs[2]->Map()),
+                             reinterpret_cast<float*>(outputs[0]->Map()));
+        return;
+    }
+
     std::unique_ptr<Encoder<float>> outputStateOut = MakeEncoder<float>(outputInfo, outputs[1]->Map());
     std::unique_ptr<Encoder<float>> cellStateOut   = MakeEncoder<float>(outputInfo, outputs[2]->Map());
     std::unique_ptr<Encoder<float>> output         = MakeEncoder<float>(outputInfo, outputs[3]->Map());
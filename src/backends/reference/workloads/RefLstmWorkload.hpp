@@ -7,6 +7,7 @@
 
 #include <armnn/TypesUtils.hpp>
 
+#include "FusedLstm.hpp"
 #include "RefBaseWorkload.hpp"
 #include <armnn/backends/WorkloadData.hpp>
 
@@ -45,6 +46,9 @@ private:
     std::unique_ptr<ScopedTensorHandle> m_OutputLayerNormWeights;
 
     float m_LayerNormEpsilon = static_cast<float>(1e-8);
+
+    /// Used instead of LstmImpl when all inputs and outputs are Float32.
+    std::unique_ptr<FusedLstm> m_FusedLstm;
 };
 
 } //namespace armnn
@@ -25,6 +25,12 @@ void RefPooling2dWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vect
     const TensorInfo& inputInfo  = GetTensorInfo(inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(outputs[0]);
 
+    if (IsPooling2dNhwcFastPathSupported(inputInfo, outputInfo, m_Data.m_Parameters))
+    {
+        Pooling2dNhwc(inputs[0]->Map(), outputs[0]->Map(), inputInfo, outputInfo, m_Data.m_Parameters);
+        return;
+    }
+
     auto inputDecoder  = MakeDecoder<float>(inputInfo,  inputs[0] ->Map());
     auto outputEncoder = MakeEncoder<float>(outputInfo, outputs[0]->Map());
 
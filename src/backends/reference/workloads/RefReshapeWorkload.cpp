@@ -1,5 +1,5 @@
 //
-// Copyright © 2018-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2018-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -23,8 +23,13 @@ void RefReshapeWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector
 
     void* output =  outputs[0]->Map();
     const void* input =  inputs[0]->Map();
-    unsigned int numBytes = GetTensorInfo(inputs[0]).GetNumBytes();
-    memcpy(output, input, numBytes);
+    // Nothing to do when the output shares the memory of the input. A copy is still needed when either of them has
+    // been replaced by an imported or exported user buffer.
+    if (output != input)
+    {
+        unsigned int numBytes = GetTensorInfo(inputs[0]).GetNumBytes();
+        memcpy(output, input, numBytes);
+    }
 }
 
 } //namespace armnn
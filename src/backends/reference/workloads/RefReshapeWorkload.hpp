@@ -1,5 +1,5 @@
 //
-// Copyright © 2022, 2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022, 2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -16,6 +16,12 @@ class RefReshapeWorkload : public RefBaseWorkload<ReshapeQueueDescriptor>
 public:
     using RefBaseWorkload<ReshapeQueueDescriptor>::RefBaseWorkload;
     void Execute() const override;
+
+    // The output holds the same bytes as the input, so it can be a view of the input memory
+    std::vector<std::pair<unsigned int, unsigned int>> GetInPlaceSlots() const override
+    {
+        return { { 0, 0 } };
+    }
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
 };
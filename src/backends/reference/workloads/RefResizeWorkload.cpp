@@ -16,6 +16,16 @@
 namespace armnn
 {
 
+RefResizeWorkload::RefResizeWorkload(const ResizeQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : RefBaseWorkload<ResizeQueueDescriptor>(descriptor, info)
+    , m_Plan(CreateResizePlan(info.m_InputTensorInfos[0],
+                              info.m_OutputTensorInfos[0],
+                              descriptor.m_Parameters.m_DataLayout,
+                              descriptor.m_Parameters.m_Method,
+                              descriptor.m_Parameters.m_AlignCorners,
+                              descriptor.m_Parameters.m_HalfPixelCenters))
+{}
+
 void RefResizeWorkload::Execute() const
 {
     Execute(m_Data.m_Inputs, m_Data.m_Outputs);
@@ -33,6 +43,13 @@ void RefResizeWorkload::Execute(std::vector<ITensorHandle*> inputs, std::vector<
     std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputInfo, outputs[0]->Map());
     Encoder<float> &encoder = *encoderPtr;
 
+    // The plan is built for the shapes known at construction; rebuild it if the tensor handles changed shape.
+    if (inputInfo.GetShape() == m_Plan.m_InputShape && outputInfo.GetShape() == m_Plan.m_OutputShape)
+    {
+        Resize(decoder, encoder, m_Plan);
+        return;
+    }
+
     Resize(decoder,
            inputInfo,
            encoder,
@@ -8,16 +8,20 @@
 #include "RefBaseWorkload.hpp"
 #include <armnn/backends/WorkloadData.hpp>
 
+#include "Resize.hpp"
+
 namespace armnn
 {
 
 class RefResizeWorkload : public RefBaseWorkload<ResizeQueueDescriptor>
 {
 public:
-    using RefBaseWorkload<ResizeQueueDescriptor>::RefBaseWorkload;
+    explicit RefResizeWorkload(const ResizeQueueDescriptor& descriptor, const WorkloadInfo& info);
     void Execute() const override;
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
+
+    const ResizePlan m_Plan;
 };
 
 } //namespace armnn
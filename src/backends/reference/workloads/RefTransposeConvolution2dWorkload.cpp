@@ -17,20 +17,21 @@ RefTransposeConvolution2dWorkload::RefTransposeConvolution2dWorkload(
     const TransposeConvolution2dQueueDescriptor& descriptor, const WorkloadInfo& info) :
     RefBaseWorkload<TransposeConvolution2dQueueDescriptor>(descriptor, info)
 {
-    // set up weights decoder
-    m_Weights = std::make_unique<ScopedTensorHandle>(*(descriptor.m_Weight));
-    const TensorInfo& weightsInfo = m_Weights->GetTensorInfo();
+    // Decode and rearrange the constant weights once, so every execution can go straight to the GEMM.
+    const TensorInfo& weightsInfo = descriptor.m_Weight->GetTensorInfo();
+    std::unique_ptr<Decoder<float>> weightsDecoder =
+        MakeDecoder<float>(weightsInfo, descriptor.m_Weight->Map(true));
 
-    m_WeightsDecoder = MakeDecoder<float>(weightsInfo, m_Weights->Map(true));
-    m_WeightsShape   = weightsInfo.GetShape();
-
-    // set up biases decoder
+    std::unique_ptr<Decoder<float>> biasesDecoder;
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
-        m_Biases = std::make_unique<ScopedTensorHandle>(*(descriptor.m_Bias));
-        const TensorInfo& biasesInfo = m_Biases->GetTensorInfo();
-        m_BiasesDecoder = MakeDecoder<float>(biasesInfo, m_Biases->Map(true));
+        biasesDecoder = MakeDecoder<float>(descriptor.m_Bias->GetTensorInfo(), descriptor.m_Bias->Map(true));
     }
+
+    m_PackedWeights = PackTransposeConvolution2dWeights(descriptor.m_Parameters,
+                                                        weightsInfo.GetShape(),
+                                                        *weightsDecoder,
+                                                        biasesDecoder.get());
 }
 
 void RefTransposeConvolution2dWorkload::Execute() const
@@ -54,9 +55,7 @@ void RefTransposeConvolution2dWorkload::Execute(std::vector<ITensorHandle*> inpu
                                *inputDecoder,
                                outputInfo.GetShape(),
                                *outputEncoder,
-                               m_WeightsShape,
-                               *m_WeightsDecoder,
-                               m_BiasesDecoder.get());
+                               m_PackedWeights);
 }
 
 } // namespace armnn
\ No newline at end of file
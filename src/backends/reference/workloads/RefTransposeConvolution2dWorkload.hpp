@@ -7,6 +7,7 @@
 
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "TransposeConvolution2d.hpp"
 
 #include <armnn/backends/TensorHandle.hpp>
 #include "RefBaseWorkload.hpp"
@@ -25,13 +26,8 @@ public:
 
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
-    std::unique_ptr<ScopedTensorHandle> m_Weights;
-    std::unique_ptr<ScopedTensorHandle> m_Biases;
 
-    std::unique_ptr<Decoder<float>> m_WeightsDecoder;
-    std::unique_ptr<Decoder<float>> m_BiasesDecoder;
-
-    TensorShape m_WeightsShape;
+    TransposeConvolution2dPackedWeights m_PackedWeights;
 };
 
 } // namespace armnn
\ No newline at end of file
@@ -13,6 +13,8 @@
 
 #include <armnnUtils/Permute.hpp>
 
+#include <algorithm>
+
 namespace armnn
 {
 
@@ -41,7 +43,18 @@ RefUnidirectionalSequenceLstmWorkload::RefUnidirectionalSequenceLstmWorkload(
     , m_ForgetLayerNormWeights        (AssignScopedTensorHandle(descriptor.m_ForgetLayerNormWeights))
     , m_CellLayerNormWeights          (AssignScopedTensorHandle(descriptor.m_CellLayerNormWeights))
     , m_OutputLayerNormWeights        (AssignScopedTensorHandle(descriptor.m_OutputLayerNormWeights))
-{}
+{
+    const bool isFloat32 =
+        info.m_InputTensorInfos[0].GetDataType() == DataType::Float32 &&
+        std::all_of(info.m_OutputTensorInfos.begin(), info.m_OutputTensorInfos.end(),
+                    [](const TensorInfo& tensorInfo) { return tensorInfo.GetDataType() == DataType::Float32; });
+    if (isFloat32)
+    {
+        m_FusedLstm = std::make_unique<FusedLstm>(descriptor.m_Parameters,
+                                                  FusedLstm::GetConstantTensors(descriptor),
+                                                  m_LayerNormEpsilon);
+    }
+}
 
 void RefUnidirectionalSequenceLstmWorkload::Execute() const
 {
@@ -53,6 +66,12 @@ void RefUnidirectionalSequenceLstmWorkload::Execute(std::vector<ITensorHandle*>
 {
     ARMNN_SCOPED_PROFILING_EVENT_REF_NAME_GUID("RefUnidirectionalSequenceLstmWorkload_Execute");
 
+    if (m_FusedLstm)
+    {
+        ExecuteFused(inputs, outputs);
+        return;
+    }
+
     TensorInfo inputInfo = GetTensorInfo(inputs[0]);
     const TensorInfo& outputStateInfo = GetTensorInfo(inputs[1]);
     const TensorInfo& cellStateInfo = GetTensorInfo(inputs[2]);
@@ -304,4 +323,45 @@ void RefUnidirectionalSequenceLstmWorkload::Execute(std::vector<ITensorHandle*>
     }
 }
 
+void RefUnidirectionalSequenceLstmWorkload::ExecuteFused(std::vector<ITensorHandle*> inputs,
+                                                         std::vector<ITensorHandle*> outputs) const
+{
+    const TensorInfo& inputInfo = GetTensorInfo(inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(outputs[2]);
+    const bool timeMajor = m_Data.m_Parameters.m_TimeMajor;
+
+    const unsigned int maxTime   = timeMajor ? inputInfo.GetShape()[0] : inputInfo.GetShape()[1];
+    const unsigned int batchSize = timeMajor ? inputInfo.GetShape()[1] : inputInfo.GetShape()[0];
+
+    const float* inputData = reinterpret_cast<const float*>(inputs[0]->Map());
+    float* outputData = GetOutputTensorData<float>(outputs[2]);
+
+    // The engine works on time major data. Batch major tensors are permuted through local buffers so that the
+    // input tensor is left untouched.
+    const PermutationVector mappings = {1U, 0U, 2U};
+    std::vector<float> timeMajorInput;
+    std::vector<float> timeMajorOutput;
+    if (!timeMajor)
+    {
+        timeMajorInput.resize(inputInfo.GetNumElements());
+        armnnUtils::Permute(armnnUtils::Permuted(inputInfo.GetShape(), mappings), mappings,
+                            inputData, timeMajorInput.data(), sizeof(float));
+        timeMajorOutput.resize(outputInfo.GetNumElements());
+    }
+
+    m_FusedLstm->Execute(timeMajor ? inputData : timeMajorInput.data(),
+                         maxTime,
+                         batchSize,
+                         reinterpret_cast<const float*>(inputs[1]->Map()),
+                         reinterpret_cast<const float*>(inputs[2]->Map()),
+                         timeMajor ? outputData : timeMajorOutput.data(),
+                         GetOutputTensorData<float>(outputs[0]),
+                         GetOutputTensorData<float>(outputs[1]));
+
+    if (!timeMajor)
+    {
+        armnnUtils::Permute(outputInfo.GetShape(), mappings, timeMajorOutput.data(), outputData, sizeof(float));
+    }
+}
+
 } //namespace armnn
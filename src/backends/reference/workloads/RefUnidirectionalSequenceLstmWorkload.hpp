@@ -7,6 +7,7 @@
 
 #include <armnn/TypesUtils.hpp>
 
+#include "FusedLstm.hpp"
 #include "RefBaseWorkload.hpp"
 #include <armnn/backends/WorkloadData.hpp>
 
@@ -26,6 +27,7 @@ public:
 
 private:
     void Execute(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
+    void ExecuteFused(std::vector<ITensorHandle*> inputs, std::vector<ITensorHandle*> outputs) const;
     std::unique_ptr<ScopedTensorHandle> m_InputToInputWeightsTensor;
     std::unique_ptr<ScopedTensorHandle> m_InputToForgetWeightsTensor;
     std::unique_ptr<ScopedTensorHandle> m_InputToCellWeightsTensor;
@@ -49,6 +51,9 @@ private:
     std::unique_ptr<ScopedTensorHandle> m_OutputLayerNormWeights;
 
     float m_LayerNormEpsilon = static_cast<float>(1e-8);
+
+    /// Used instead of stepping LstmImpl when the input and outputs are Float32.
+    std::unique_ptr<FusedLstm> m_FusedLstm;
 };
 
 } //namespace armnn
@@ -32,6 +32,7 @@
 #include "RefFakeQuantizationFloat32Workload.hpp"
 #include "RefFillWorkload.hpp"
 #include "RefFloorWorkload.hpp"
+#include "RefFusedWorkload.hpp"
 #include "RefFullyConnectedWorkload.hpp"
 #include "RefGatherNdWorkload.hpp"
 #include "RefGatherWorkload.hpp"
@@ -23,11 +23,6 @@ inline float Lerp(float a, float b, float w)
     return w * b + (1.f - w) * a;
 }
 
-inline double EuclideanDistance(float Xa, float Ya, const unsigned int Xb, const unsigned int Yb)
-{
-    return std::sqrt(pow(Xa - armnn::numeric_cast<float>(Xb), 2) + pow(Ya - armnn::numeric_cast<float>(Yb), 2));
-}
-
 inline float CalculateResizeScale(const unsigned int& InputSize,
                                   const unsigned int& OutputSize,
                                   const bool& AlignCorners)
@@ -58,161 +53,199 @@ inline float PixelScaler(const unsigned int& Pixel,
     }
 }
 
+/// Computes the source coordinates and weights for every output coordinate along one axis.
+armnn::ResizeAxisPlan CreateAxisPlan(unsigned int inputSize,
+                              unsigned int outputSize,
+                              armnn::ResizeMethod resizeMethod,
+                              bool alignCorners,
+                              bool halfPixelCenters)
+{
+    // How much to scale pixel coordinates in the output image, to get the corresponding pixel coordinates
+    // in the input image.
+    const float scale = CalculateResizeScale(inputSize, outputSize, alignCorners);
+
+    armnn::ResizeAxisPlan plan;
+    plan.m_Index0.resize(outputSize);
+    plan.m_Index1.resize(outputSize);
+    plan.m_Weight.resize(outputSize);
+
+    for (unsigned int i = 0; i < outputSize; ++i)
+    {
+        // Corresponding real-valued coordinate in input image.
+        const float ii = PixelScaler(i, scale, halfPixelCenters, resizeMethod);
+
+        // Discrete coordinate of the top-left texel (in the 2x2 texel area used for interpolation).
+        // Nearest Neighbour uses rounding to align to corners.
+        const float fi = (resizeMethod == armnn::ResizeMethod::NearestNeighbor && alignCorners) ? armnn::roundf(ii)
+                                                                                                : floorf(ii);
+        // Pixel scaling a value with Half Pixel Centers can be negative, if so set to 0
+        const unsigned int i0 = static_cast<unsigned int>(std::max(fi, 0.0f));
+
+        // Half Pixel Centers uses the scaling to compute a weighted parameter for nearby pixels,
+        // otherwise take the texel below or to the right of i0.
+        const unsigned int i1 = halfPixelCenters
+                                ? std::min(static_cast<unsigned int>(std::ceil(ii)), inputSize - 1u)
+                                : std::min(i0 + 1, inputSize - 1u);
+
+        if (resizeMethod == armnn::ResizeMethod::NearestNeighbor)
+        {
+            // The distance to the neighbours is separable, so the nearest texel can be picked per axis.
+            // Ties resolve towards i0.
+            const float distance0 = std::abs(fi - static_cast<float>(i0));
+            const float distance1 = std::abs(fi - static_cast<float>(i1));
+            plan.m_Index0[i] = distance0 <= distance1 ? i0 : i1;
+            plan.m_Index1[i] = plan.m_Index0[i];
+            plan.m_Weight[i] = 0.0f;
+        }
+        else
+        {
+            plan.m_Index0[i] = i0;
+            plan.m_Index1[i] = i1;
+            // Interpolation weight (range [0,1]).
+            plan.m_Weight[i] = ii - fi;
+        }
+    }
+    return plan;
+}
+
 }// anonymous namespace
 
 namespace armnn
 {
-void Resize(Decoder<float>&   in,
-            const TensorInfo& inputInfo,
-            Encoder<float>&   out,
-            const TensorInfo& outputInfo,
-            DataLayoutIndexed dataLayout,
-            ResizeMethod resizeMethod,
-            bool alignCorners,
-            bool halfPixelCenters)
+ResizePlan CreateResizePlan(const TensorInfo& inputInfo,
+                            const TensorInfo& outputInfo,
+                            DataLayoutIndexed dataLayout,
+                            ResizeMethod resizeMethod,
+                            bool alignCorners,
+                            bool halfPixelCenters)
 {
     // alignCorners and halfPixelCenters cannot both be true
     ARMNN_THROW_INVALIDARG_MSG_IF_FALSE(!(alignCorners && halfPixelCenters),
                                         "Resize: alignCorners and halfPixelCenters cannot both be true");
 
+    if (resizeMethod != ResizeMethod::Bilinear && resizeMethod != ResizeMethod::NearestNeighbor)
+    {
+        throw InvalidArgumentException("Unknown resize method: " + std::to_string(static_cast<int>(resizeMethod)));
+    }
+
     // We follow the definition of TensorFlow and AndroidNN: the top-left corner of a texel in the output
     // image is projected into the input image to figure out the interpolants and weights. Note that this
     // will yield different results than if projecting the centre of output texels.
+    const TensorShape& inputShape  = inputInfo.GetShape();
+    const TensorShape& outputShape = outputInfo.GetShape();
+
+    ResizePlan plan;
+    plan.m_InputShape  = inputShape;
+    plan.m_OutputShape = outputShape;
+    plan.m_DataLayout  = dataLayout;
+    plan.m_Method      = resizeMethod;
+    plan.m_Rows = CreateAxisPlan(inputShape[dataLayout.GetHeightIndex()],
+                                 outputShape[dataLayout.GetHeightIndex()],
+                                 resizeMethod, alignCorners, halfPixelCenters);
+    plan.m_Cols = CreateAxisPlan(inputShape[dataLayout.GetWidthIndex()],
+                                 outputShape[dataLayout.GetWidthIndex()],
+                                 resizeMethod, alignCorners, halfPixelCenters);
+    return plan;
+}
 
-    const unsigned int batchSize = inputInfo.GetShape()[0];
-    const unsigned int channelCount = inputInfo.GetShape()[dataLayout.GetChannelsIndex()];
+void Resize(Decoder<float>& in, Encoder<float>& out, const ResizePlan& plan)
+{
+    const DataLayoutIndexed& dataLayout = plan.m_DataLayout;
+    const TensorShape& inputShape = plan.m_InputShape;
 
-    const unsigned int inputHeight = inputInfo.GetShape()[dataLayout.GetHeightIndex()];
-    const unsigned int inputWidth = inputInfo.GetShape()[dataLayout.GetWidthIndex()];
-    const unsigned int outputHeight = outputInfo.GetShape()[dataLayout.GetHeightIndex()];
-    const unsigned int outputWidth = outputInfo.GetShape()[dataLayout.GetWidthIndex()];
+    const unsigned int batchSize    = inputShape[0];
+    const unsigned int channelCount = inputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int inputHeight  = inputShape[dataLayout.GetHeightIndex()];
+    const unsigned int inputWidth   = inputShape[dataLayout.GetWidthIndex()];
+    const unsigned int outputHeight = plan.m_OutputShape[dataLayout.GetHeightIndex()];
+    const unsigned int outputWidth  = plan.m_OutputShape[dataLayout.GetWidthIndex()];
 
-    // How much to scale pixel coordinates in the output image, to get the corresponding pixel coordinates
-    // in the input image.
-    const float scaleY = CalculateResizeScale(inputHeight, outputHeight, alignCorners);
-    const float scaleX = CalculateResizeScale(inputWidth, outputWidth, alignCorners);
+    const bool isNhwc = dataLayout.GetDataLayout() == DataLayout::NHWC;
+
+    // Element strides of the input, so source offsets can be built from the plan directly.
+    const unsigned int batchStride   = inputHeight * inputWidth * channelCount;
+    const unsigned int rowStride     = isNhwc ? inputWidth * channelCount : inputWidth;
+    const unsigned int colStride     = isNhwc ? channelCount : 1u;
+    const unsigned int channelStride = isNhwc ? 1u : inputHeight * inputWidth;
 
-    const TensorShape& inputShape =  inputInfo.GetShape();
-    const TensorShape& outputShape =  outputInfo.GetShape();
+    const ResizeAxisPlan& rows = plan.m_Rows;
+    const ResizeAxisPlan& cols = plan.m_Cols;
+
+    auto interpolate = [&](unsigned int base, unsigned int y, unsigned int x) -> float
+    {
+        const unsigned int row0 = base + rows.m_Index0[y] * rowStride;
+        const unsigned int col0 = cols.m_Index0[x] * colStride;
+        if (plan.m_Method == ResizeMethod::NearestNeighbor)
+        {
+            in[row0 + col0];
+            return in.Get();
+        }
 
+        const unsigned int row1 = base + rows.m_Index1[y] * rowStride;
+        const unsigned int col1 = cols.m_Index1[x] * colStride;
+        const float xw = cols.m_Weight[x];
+
+        in[row0 + col0];
+        const float input1 = in.Get();
+        in[row0 + col1];
+        const float input2 = in.Get();
+        in[row1 + col0];
+        const float input3 = in.Get();
+        in[row1 + col1];
+        const float input4 = in.Get();
+
+        const float ly0 = Lerp(input1, input2, xw); // lerp along row y0.
+        const float ly1 = Lerp(input3, input4, xw); // lerp along row y1.
+        return Lerp(ly0, ly1, rows.m_Weight[y]);
+    };
+
+    // Both loop nests visit the output in memory order, with the channels innermost for NHWC.
+    out[0];
     for (unsigned int n = 0; n < batchSize; ++n)
     {
-        for (unsigned int c = 0; c < channelCount; ++c)
+        const unsigned int batchBase = n * batchStride;
+        if (isNhwc)
         {
             for (unsigned int y = 0; y < outputHeight; ++y)
             {
-                // Corresponding real-valued height coordinate in input image.
-                float iy = PixelScaler(y, scaleY, halfPixelCenters, resizeMethod);
-
-                // Discrete height coordinate of top-left texel (in the 2x2 texel area used for interpolation).
-                const float fiy = (resizeMethod == ResizeMethod::NearestNeighbor && alignCorners) ? armnn::roundf(iy)
-                                                                                                  : floorf(iy);
-                // Pixel scaling a value with Half Pixel Centers can be negative, if so set to 0
-                const unsigned int y0 = static_cast<unsigned int>(std::max(fiy, 0.0f));
-
-                // Interpolation weight (range [0,1]).
-                const float yw = iy - fiy;
-
                 for (unsigned int x = 0; x < outputWidth; ++x)
                 {
-                    // Real-valued and discrete width coordinates in input image.
-                    float ix = PixelScaler(x, scaleX, halfPixelCenters, resizeMethod);
-
-                    // Nearest Neighbour uses rounding to align to corners
-                    const float fix = resizeMethod == ResizeMethod::NearestNeighbor && alignCorners ? armnn::roundf(ix)
-                                                                                                    : floorf(ix);
-                    // Pixel scaling a value with Half Pixel Centers can be negative, if so set to 0
-                    const unsigned int x0 = static_cast<unsigned int>(std::max(fix, 0.0f));
-
-                    // Interpolation weight (range [0,1]).
-                    const float xw = ix - fix;
-
-                    unsigned int x1;
-                    unsigned int y1;
-                    // Half Pixel Centers uses the scaling to compute a weighted parameter for nearby pixels
-                    if (halfPixelCenters)
-                    {
-                        x1 = std::min(static_cast<unsigned int>(std::ceil(ix)), inputWidth - 1u);
-                        y1 = std::min(static_cast<unsigned int>(std::ceil(iy)), inputHeight - 1u);
-                    }
-                    // Discrete width/height coordinates of texels below and to the right of (x0, y0).
-                    else
+                    for (unsigned int c = 0; c < channelCount; ++c)
                     {
-                        x1 = std::min(x0 + 1, inputWidth - 1u);
-                        y1 = std::min(y0 + 1, inputHeight - 1u);
+                        out.Set(interpolate(batchBase + c, y, x));
+                        ++out;
                     }
-
-                    float interpolatedValue;
-                    switch (resizeMethod)
+                }
+            }
+        }
+        else
+        {
+            for (unsigned int c = 0; c < channelCount; ++c)
+            {
+                const unsigned int channelBase = batchBase + c * channelStride;
+                for (unsigned int y = 0; y < outputHeight; ++y)
+                {
+                    for (unsigned int x = 0; x < outputWidth; ++x)
                     {
-                        case ResizeMethod::Bilinear:
-                        {
-                            in[dataLayout.GetIndex(inputShape, n, c, y0, x0)];
-                            float input1 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y0, x1)];
-                            float input2 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y1, x0)];
-                            float input3 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y1, x1)];
-                            float input4 = in.Get();
-
-                            const float ly0 = Lerp(input1, input2, xw); // lerp along row y0.
-                            const float ly1 = Lerp(input3, input4, xw); // lerp along row y1.
-                            interpolatedValue = Lerp(ly0, ly1, yw);
-                            break;
-                        }
-                        case ResizeMethod::NearestNeighbor:
-                        {
-                            // calculate euclidean distance to the 4 neighbours
-                            auto distance00 = EuclideanDistance(fix, fiy, x0, y0);
-                            auto distance01 = EuclideanDistance(fix, fiy, x0, y1);
-                            auto distance10 = EuclideanDistance(fix, fiy, x1, y0);
-                            auto distance11 = EuclideanDistance(fix, fiy, x1, y1);
-
-                            auto minimum = std::min( { distance00, distance01, distance10, distance11 } );
-
-                            unsigned int xNearest = 0;
-                            unsigned int yNearest = 0;
-
-                            if (minimum == distance00)
-                            {
-                               xNearest = x0;
-                               yNearest = y0;
-                            }
-                            else if (minimum == distance01)
-                            {
-                                xNearest = x0;
-                                yNearest = y1;
-                            }
-                            else if (minimum == distance10)
-                            {
-                                xNearest = x1;
-                                yNearest = y0;
-                            }
-                            else if (minimum == distance11)
-                            {
-                                xNearest = x1;
-                                yNearest = y1;
-                            }
-                            else
-                            {
-                                throw InvalidArgumentException("Resize Nearest Neighbor failure");
-                            }
-
-                            in[dataLayout.GetIndex(inputShape, n, c, yNearest, xNearest)];
-                            interpolatedValue = in.Get();
-                            break;
-                        }
-                        default:
-                            throw InvalidArgumentException("Unknown resize method: " +
-                                                            std::to_string(static_cast<int>(resizeMethod)));
+                        out.Set(interpolate(channelBase, y, x));
+                        ++out;
                     }
-                    out[dataLayout.GetIndex(outputShape, n, c, y, x)];
-                    out.Set(interpolatedValue);
                 }
             }
         }
     }
 }
 
+void Resize(Decoder<float>&   in,
+            const TensorInfo& inputInfo,
+            Encoder<float>&   out,
+            const TensorInfo& outputInfo,
+            DataLayoutIndexed dataLayout,
+            ResizeMethod resizeMethod,
+            bool alignCorners,
+            bool halfPixelCenters)
+{
+    Resize(in, out, CreateResizePlan(inputInfo, outputInfo, dataLayout, resizeMethod, alignCorners, halfPixelCenters));
+}
+
 } //namespace armnn
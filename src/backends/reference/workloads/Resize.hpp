@@ -11,9 +11,43 @@
 
 #include <armnnUtils/DataLayoutIndexed.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
+/// Source coordinates and interpolation weights for every output coordinate along one spatial axis.
+/// For nearest neighbour only m_Index0 is used and holds the selected source coordinate.
+struct ResizeAxisPlan
+{
+    std::vector<unsigned int> m_Index0;
+    std::vector<unsigned int> m_Index1;
+    std::vector<float>        m_Weight;
+};
+
+/// Everything Resize needs that depends only on the shapes and the descriptor, so that it can be computed once
+/// per workload instead of once per output element.
+struct ResizePlan
+{
+    TensorShape                   m_InputShape;
+    TensorShape                   m_OutputShape;
+    armnnUtils::DataLayoutIndexed m_DataLayout = DataLayout::NCHW;
+    ResizeMethod                  m_Method     = ResizeMethod::NearestNeighbor;
+    ResizeAxisPlan                m_Rows;
+    ResizeAxisPlan                m_Cols;
+};
+
+ResizePlan CreateResizePlan(const TensorInfo&             inputInfo,
+                            const TensorInfo&             outputInfo,
+                            armnnUtils::DataLayoutIndexed dataLayout = DataLayout::NCHW,
+                            ResizeMethod                  resizeMethod = ResizeMethod::NearestNeighbor,
+                            bool                          alignCorners = false,
+                            bool                          halfPixelCenters = false);
+
+void Resize(Decoder<float>&   in,
+            Encoder<float>&   out,
+            const ResizePlan& plan);
+
 void Resize(Decoder<float>&               in,
             const TensorInfo&             inputInfo,
             Encoder<float>&               out,
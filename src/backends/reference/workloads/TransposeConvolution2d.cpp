@@ -1,10 +1,12 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
 #include "TransposeConvolution2d.hpp"
 
+#include "Gemm.hpp"
+
 #include <armnnUtils/DataLayoutIndexed.hpp>
 
 namespace armnn
@@ -12,19 +14,61 @@ namespace armnn
 
 using namespace armnnUtils;
 
+TransposeConvolution2dPackedWeights PackTransposeConvolution2dWeights(
+    const TransposeConvolution2dDescriptor& descriptor,
+    const TensorShape& weightsShape,
+    Decoder<float>& weightsDecoder,
+    Decoder<float>* biasesDecoder)
+{
+    if (descriptor.m_BiasEnabled && !biasesDecoder)
+    {
+        throw InvalidArgumentException("Biases enabled but no bias data provided");
+    }
+    const DataLayoutIndexed dataLayoutIndexed(descriptor.m_DataLayout);
+
+    TransposeConvolution2dPackedWeights packed;
+    packed.m_OutputChannels = weightsShape[0];
+    packed.m_InputChannels  = weightsShape[dataLayoutIndexed.GetChannelsIndex()];
+    packed.m_KernelHeight   = weightsShape[dataLayoutIndexed.GetHeightIndex()];
+    packed.m_KernelWidth    = weightsShape[dataLayoutIndexed.GetWidthIndex()];
+
+    const unsigned int columns = packed.m_KernelHeight * packed.m_KernelWidth * packed.m_OutputChannels;
+    packed.m_Weights.resize(static_cast<size_t>(packed.m_InputChannels) * columns);
+
+    const std::vector<float> filterVec = weightsDecoder.DecodeTensor(weightsShape);
+    for (unsigned int dOutput = 0u; dOutput < packed.m_OutputChannels; ++dOutput)
+    {
+        for (unsigned int dInput = 0u; dInput < packed.m_InputChannels; ++dInput)
+        {
+            for (unsigned int yWeights = 0u; yWeights < packed.m_KernelHeight; ++yWeights)
+            {
+                for (unsigned int xWeights = 0u; xWeights < packed.m_KernelWidth; ++xWeights)
+                {
+                    const unsigned int weightsIndex =
+                        dataLayoutIndexed.GetIndex(weightsShape, dOutput, dInput, yWeights, xWeights);
+                    const unsigned int column =
+                        (yWeights * packed.m_KernelWidth + xWeights) * packed.m_OutputChannels + dOutput;
+
+                    packed.m_Weights[dInput * columns + column] = filterVec[weightsIndex];
+                }
+            }
+        }
+    }
+
+    if (descriptor.m_BiasEnabled)
+    {
+        packed.m_Biases = biasesDecoder->DecodeTensor(TensorShape{ packed.m_OutputChannels });
+    }
+    return packed;
+}
+
 void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descriptor,
                                 const TensorShape& inputShape,
                                 Decoder<float>& inputDecoder,
                                 const TensorShape& outputShape,
                                 Encoder<float>& outputEncoder,
-                                const TensorShape& weightsShape,
-                                Decoder<float>& weightsDecoder,
-                                Decoder<float>* biasesDecoder)
+                                const TransposeConvolution2dPackedWeights& packedWeights)
 {
-    if (descriptor.m_BiasEnabled && !biasesDecoder)
-    {
-        throw InvalidArgumentException("Biases enabled but no bias data provided");
-    }
     const DataLayoutIndexed dataLayoutIndexed(descriptor.m_DataLayout);
     const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
     const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
@@ -36,126 +80,168 @@ void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descript
     const unsigned int inputHeight = inputShape[heightIndex];
     const unsigned int inputDepth  = inputShape[channelsIndex];
 
-    const unsigned int weightsHeight = weightsShape[heightIndex];
-    const unsigned int weightsWidth  = weightsShape[widthIndex];
-    const unsigned int weightsDepth  = weightsShape[channelsIndex];
-
     const unsigned int outputHeight = outputShape[heightIndex];
     const unsigned int outputWidth  = outputShape[widthIndex];
     const unsigned int outputDepth  = outputShape[channelsIndex];
 
+    const unsigned int weightsHeight = packedWeights.m_KernelHeight;
+    const unsigned int weightsWidth  = packedWeights.m_KernelWidth;
+
+    if (packedWeights.m_InputChannels != inputDepth || packedWeights.m_OutputChannels != outputDepth)
+    {
+        throw InvalidArgumentException("TransposeConvolution2d: packed weights do not match the input and output");
+    }
+    if (descriptor.m_BiasEnabled && packedWeights.m_Biases.size() != outputDepth)
+    {
+        throw InvalidArgumentException("Biases enabled but no bias data provided");
+    }
+
+    const bool isNhwc = descriptor.m_DataLayout == armnn::DataLayout::NHWC;
+
     const unsigned int paddingLeft = descriptor.m_PadLeft;
     const unsigned int paddingTop  = descriptor.m_PadTop;
 
     const unsigned int strideX = descriptor.m_StrideX;
     const unsigned int strideY = descriptor.m_StrideY;
 
-    std::vector<float> outputBuffer(outputShape.GetNumElements(), 0);
-
     const std::vector<float> inputVec = inputDecoder.DecodeTensor(inputShape);
-    const std::vector<float> filterVec = weightsDecoder.DecodeTensor(weightsShape);
+
+    // The GEMM and col2im work on a channels-last view of a single batch. NCHW data is gathered into this
+    // buffer one input row at a time, NHWC data is used in place.
+    std::vector<float> inputRow(isNhwc ? 0 : inputWidth * inputDepth);
+
+    // Each input pixel produces a kernelHeight x kernelWidth patch of output pixels, one row of columns.
+    const unsigned int columns = weightsHeight * weightsWidth * outputDepth;
+    std::vector<float> columnBuffer(static_cast<size_t>(inputWidth) * columns);
+
+    // Output accumulated channels-last, converted to the output layout when encoding.
+    std::vector<float> outputBuffer(outputShape.GetNumElements(), 0.0f);
 
     for (unsigned int batch = 0u; batch < numBatches; ++batch)
     {
+        const size_t inputBatchOffset  = static_cast<size_t>(batch) * inputHeight * inputWidth * inputDepth;
+        float* outputBatch =
+            outputBuffer.data() + static_cast<size_t>(batch) * outputHeight * outputWidth * outputDepth;
+
         for (unsigned int yInput = 0u; yInput < inputHeight; ++yInput)
         {
+            const float* rowData;
+            if (isNhwc)
+            {
+                rowData = inputVec.data() + inputBatchOffset + static_cast<size_t>(yInput) * inputWidth * inputDepth;
+            }
+            else
+            {
+                for (unsigned int dInput = 0u; dInput < inputDepth; ++dInput)
+                {
+                    const float* plane = inputVec.data() + inputBatchOffset +
+                                         (static_cast<size_t>(dInput) * inputHeight + yInput) * inputWidth;
+                    for (unsigned int xInput = 0u; xInput < inputWidth; ++xInput)
+                    {
+                        inputRow[xInput * inputDepth + dInput] = plane[xInput];
+                    }
+                }
+                rowData = inputRow.data();
+            }
+
+            // [inputWidth, inputDepth] x [inputDepth, columns]
+            Gemm(inputWidth, columns, inputDepth, rowData, packedWeights.m_Weights.data(), columnBuffer.data());
+
+            // col2im: scatter-add every kernel tap of every input pixel into the output.
+            const unsigned int yOutputOrigin = yInput * strideY - paddingTop;
             for (unsigned int xInput = 0u; xInput < inputWidth; ++xInput)
             {
-                unsigned int xOutputOrigin = xInput * strideX - paddingLeft;
-                unsigned int yOutputOrigin = yInput * strideY - paddingTop;
+                const unsigned int xOutputOrigin = xInput * strideX - paddingLeft;
+                const float* column = columnBuffer.data() + static_cast<size_t>(xInput) * columns;
 
-                for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+                for (unsigned int yWeights = 0u; yWeights < weightsHeight; ++yWeights)
                 {
-                    for (unsigned int yWeights = 0u; yWeights < weightsHeight; ++yWeights)
+                    // Unsigned wrap-around makes outputs above or left of the image fail the bounds check.
+                    const unsigned int yOutput = yOutputOrigin + yWeights;
+                    if (yOutput >= outputHeight)
                     {
-                        for (unsigned int xWeights = 0u; xWeights < weightsWidth; ++xWeights)
+                        continue;
+                    }
+
+                    for (unsigned int xWeights = 0u; xWeights < weightsWidth; ++xWeights)
+                    {
+                        const unsigned int xOutput = xOutputOrigin + xWeights;
+                        if (xOutput >= outputWidth)
                         {
-                            unsigned int yOutput = yOutputOrigin + yWeights;
-                            unsigned int xOutput = xOutputOrigin + xWeights;
-
-                            if (yOutput < outputHeight && xOutput< outputWidth)
-                            {
-                                for (unsigned int dInput = 0u; dInput < inputDepth; dInput++)
-                                {
-                                    unsigned int inputIndex;
-                                    unsigned int outputIndex;
-                                    unsigned int weightsIndex;
-
-                                    if(descriptor.m_DataLayout == armnn::DataLayout::NHWC)
-                                    {
-                                        inputIndex   = batch  * inputHeight * inputWidth * inputDepth +
-                                                       yInput * inputWidth * inputDepth +
-                                                       xInput * inputDepth +
-                                                       dInput;
-
-                                        weightsIndex = dOutput  * weightsHeight * weightsWidth * weightsDepth +
-                                                       yWeights * weightsWidth * weightsDepth +
-                                                       xWeights * weightsDepth +
-                                                       dInput;
-
-                                        outputIndex  = batch   * outputHeight * outputWidth * outputDepth +
-                                                       yOutput * outputWidth * outputDepth +
-                                                       xOutput * outputDepth +
-                                                       dOutput;
-                                    }
-                                    else
-                                    {
-                                        inputIndex   = batch  * inputDepth * inputHeight * inputWidth +
-                                                       dInput * inputHeight * inputWidth +
-                                                       yInput * inputWidth +
-                                                       xInput;
-
-                                        weightsIndex = dOutput  * weightsDepth * weightsHeight * weightsWidth +
-                                                       dInput   * weightsHeight * weightsWidth +
-                                                       yWeights * weightsWidth +
-                                                       xWeights;
-
-                                        outputIndex  = batch   * outputDepth * outputHeight * outputWidth +
-                                                       dOutput * outputHeight * outputWidth +
-                                                       yOutput * outputWidth +
-                                                       xOutput;
-                                    }
-
-                                    outputBuffer[outputIndex] += inputVec[inputIndex] * filterVec[weightsIndex];
-                                }
-                            }
+                            continue;
                         }
-                    }
 
+                        float* out = outputBatch + (static_cast<size_t>(yOutput) * outputWidth + xOutput) * outputDepth;
+                        const float* tap = column + (yWeights * weightsWidth + xWeights) * outputDepth;
+                        for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+                        {
+                            out[dOutput] += tap[dOutput];
+                        }
+                    }
                 }
             }
         }
     }
 
-    // Apply bias (if enabled)
-    if (descriptor.m_BiasEnabled)
+    // Apply bias (if enabled) and write out in the requested layout.
+    const unsigned int outputPixels = outputHeight * outputWidth;
+    outputEncoder[0];
+    for (unsigned int batch = 0u; batch < numBatches; ++batch)
     {
-        outputEncoder[0];
-        Decoder<float>& rBiasesDecoder = *biasesDecoder;
-
-        for (unsigned int batch = 0u; batch < numBatches; ++batch)
+        const float* outputBatch = outputBuffer.data() + static_cast<size_t>(batch) * outputPixels * outputDepth;
+        if (isNhwc)
+        {
+            for (unsigned int pixel = 0u; pixel < outputPixels; ++pixel)
+            {
+                for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+                {
+                    float output = outputBatch[pixel * outputDepth + dOutput];
+                    if (descriptor.m_BiasEnabled)
+                    {
+                        output += packedWeights.m_Biases[dOutput];
+                    }
+                    outputEncoder.Set(output);
+                    ++outputEncoder;
+                }
+            }
+        }
+        else
         {
             for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
             {
-                rBiasesDecoder[dOutput];
-                for (unsigned int yOutput = 0u; yOutput < outputHeight; ++yOutput)
+                for (unsigned int pixel = 0u; pixel < outputPixels; ++pixel)
                 {
-                    for (unsigned int xOutput = 0u; xOutput < outputWidth; ++xOutput)
+                    float output = outputBatch[pixel * outputDepth + dOutput];
+                    if (descriptor.m_BiasEnabled)
                     {
-                        const unsigned int outputIndex =
-                            dataLayoutIndexed.GetIndex(outputShape, batch, dOutput, yOutput, xOutput);
-                        outputBuffer[outputIndex] += rBiasesDecoder.Get();
+                        output += packedWeights.m_Biases[dOutput];
                     }
+                    outputEncoder.Set(output);
+                    ++outputEncoder;
                 }
             }
         }
     }
-    outputEncoder[0];
-    for (float output : outputBuffer)
-    {
-        outputEncoder.Set(output);
-        ++outputEncoder;
-    }
+}
+
+void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descriptor,
+                                const TensorShape& inputShape,
+                                Decoder<float>& inputDecoder,
+                                const TensorShape& outputShape,
+                                Encoder<float>& outputEncoder,
+                                const TensorShape& weightsShape,
+                                Decoder<float>& weightsDecoder,
+                                Decoder<float>* biasesDecoder)
+{
+    TransposeConvolution2dImpl(descriptor,
+                               inputShape,
+                               inputDecoder,
+                               outputShape,
+                               outputEncoder,
+                               PackTransposeConvolution2dWeights(descriptor,
+                                                                 weightsShape,
+                                                                 weightsDecoder,
+                                                                 biasesDecoder));
 }
 
 } // namespace armnn
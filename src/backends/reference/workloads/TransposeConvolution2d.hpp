@@ -1,5 +1,5 @@
 //
-// Copyright © 2017 Arm Ltd. All rights reserved.
+// Copyright © 2017, 2026 Arm Ltd. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -11,9 +11,37 @@
 #include <armnn/Descriptors.hpp>
 #include <armnn/Tensor.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
+/// TransposeConvolution2d weights decoded and rearranged into a row-major
+/// [inputChannels, kernelHeight * kernelWidth * outputChannels] matrix, so that the operation can be computed
+/// as a GEMM followed by col2im. Built once per workload.
+struct TransposeConvolution2dPackedWeights
+{
+    unsigned int       m_InputChannels  = 0;
+    unsigned int       m_KernelHeight   = 0;
+    unsigned int       m_KernelWidth    = 0;
+    unsigned int       m_OutputChannels = 0;
+    std::vector<float> m_Weights;
+    std::vector<float> m_Biases;
+};
+
+TransposeConvolution2dPackedWeights PackTransposeConvolution2dWeights(
+    const TransposeConvolution2dDescriptor& descriptor,
+    const TensorShape& weightsShape,
+    Decoder<float>& weightsDecoder,
+    Decoder<float>* biasesDecoder);
+
+void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descriptor,
+                                const TensorShape& inputShape,
+                                Decoder<float>& inputDecoder,
+                                const TensorShape& outputShape,
+                                Encoder<float>& outputEncoder,
+                                const TransposeConvolution2dPackedWeights& packedWeights);
+
 void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descriptor,
                                 const TensorShape& inputShape,
                                 Decoder<float>& inputDecoder,
@@ -23,4 +51,4 @@ void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descript
                                 Decoder<float>& weightsDecoder,
                                 Decoder<float>* biasesDecoder);
 
-} // namespace armnn
\ No newline at end of file
+} // namespace armnn
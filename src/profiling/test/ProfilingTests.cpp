@@ -2727,9 +2727,9 @@ TEST_CASE("CheckProfilingServiceGoodRequestCounterDirectoryPacket")
     // Write the packet to the mock profiling connection
     mockProfilingConnection->WritePacket(std::move(requestCounterDirectoryPacket));
 
-    // Expecting one CounterDirectory Packet of length 652
+    // Expecting one CounterDirectory Packet of length 1088
     // and one TimelineMessageDirectory packet of length 451
-    CHECK(helper.WaitForPacketsSent(mockProfilingConnection, PacketType::CounterDirectory, 652) == 1);
+    CHECK(helper.WaitForPacketsSent(mockProfilingConnection, PacketType::CounterDirectory, 1088) == 1);
     CHECK(helper.WaitForPacketsSent(mockProfilingConnection, PacketType::TimelineMessageDirectory, 451) == 1);
 
     // The Request Counter Directory Command Handler should not have updated the profiling state
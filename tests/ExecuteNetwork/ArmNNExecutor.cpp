@@ -1,5 +1,5 @@
 //
-// Copyright © 2022-2025 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022-2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -171,7 +171,8 @@ ArmNNExecutor::ArmNNExecutor(const ExecuteNetworkParams& params, armnn::IRuntime
     INetworkProperties networkProperties{MemorySource::Undefined,
                                          MemorySource::Undefined,
                                          params.m_EnableProfiling,
-                                         profilingDetailsMethod};
+                                         profilingDetailsMethod,
+                                         !params.m_MemoryProfileFilePath.empty()};
 
     std::string errorMsg;
     Status status = m_Runtime->LoadNetwork(m_NetworkId, std::move(optNet), errorMsg, networkProperties);
@@ -188,6 +189,25 @@ ArmNNExecutor::ArmNNExecutor(const ExecuteNetworkParams& params, armnn::IRuntime
 
     SetupInputsAndOutputs();
 
+    if (!params.m_MemoryProfileFilePath.empty())
+    {
+        std::ofstream memoryProfileFile(params.m_MemoryProfileFilePath);
+        if (m_Runtime->SerializeMemoryProfile(m_NetworkId, memoryProfileFile) != Status::Success)
+        {
+            ARMNN_LOG(warning) << "Failed to write the memory profile to " << params.m_MemoryProfileFilePath;
+        }
+    }
+
+    for (const auto& backendStatistics : m_Runtime->GetMemoryStatistics(m_NetworkId))
+    {
+        const MemoryStatistics& statistics = backendStatistics.second;
+        ARMNN_LOG(info) << "Memory used on " << backendStatistics.first << ": "
+                        << statistics.m_ConstantBytes << " bytes of constants, "
+                        << statistics.m_WorkingMemoryBytes << " bytes of working memory (at least "
+                        << statistics.m_MinimumWorkingMemoryBytes << " bytes needed), "
+                        << statistics.m_ImportedBytes << " bytes imported";
+    }
+
     if (m_Params.m_Iterations > 1)
     {
         std::stringstream msg;
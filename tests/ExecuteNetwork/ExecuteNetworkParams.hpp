@@ -1,5 +1,5 @@
 //
-// Copyright © 2022, 2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022, 2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -42,6 +42,7 @@ struct ExecuteNetworkParams
     std::vector<std::string>          m_InputTensorDataFilePaths;
     std::vector<armnn::TensorShape>   m_InputTensorShapes;
     unsigned int                      m_Iterations;
+    std::string                       m_MemoryProfileFilePath;
     std::string                       m_ModelPath;
     unsigned int                      m_NumberOfThreads;
     bool                              m_OutputDetailsToStdOut;
@@ -1,5 +1,5 @@
 //
-// Copyright © 2022-2024 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2022-2024, 2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 
@@ -460,7 +460,13 @@ ProgramOptions::ProgramOptions() : m_CxxOptions{"ExecuteNetwork",
                 ("import-inputs-if-aligned",
                  "In & Out tensors will be imported per inference if the memory alignment allows.",
                  cxxopts::value<bool>(m_ExNetParams.m_ImportInputsIfAligned)->default_value("false")
-                         ->implicit_value("true"));
+                         ->implicit_value("true"))
+
+                ("memory-profile-file",
+                 "If set, the network is loaded with external memory management and the lifetimes and sizes of the "
+                 "memory blocks planned for its intermediate tensors are written to this file. The file can be "
+                 "replayed with MemoryStrategyBenchmark --trace. Not supported by the TfLite executors.",
+                 cxxopts::value<std::string>(m_ExNetParams.m_MemoryProfileFilePath)->default_value(""));
 
         m_CxxOptions.add_options("f) Deprecated or unused")
                 ("f,model-format",
@@ -1,5 +1,5 @@
 //
-// Copyright © 2021, 2025 Arm Ltd and Contributors. All rights reserved.
+// Copyright © 2021, 2025-2026 Arm Ltd and Contributors. All rights reserved.
 // SPDX-License-Identifier: MIT
 //
 #include "TestBlocks.hpp"
@@ -14,7 +14,12 @@
 
 #include <iostream>
 #include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <iomanip>
+#include <list>
+#include <map>
+#include <sstream>
 
 std::vector<TestBlock> testBlocks
 {
@@ -28,6 +33,57 @@ std::vector<TestBlock> testBlocks
     {"yolov3",yolov3}
 };
 
+// Memory blocks replayed from traces, which the TestBlocks of the traces refer to
+std::list<std::vector<armnn::MemBlock>> traceBlocks;
+
+// Reads the memory blocks written by IRuntime::SerializeMemoryProfile, one line per block:
+// "<backend> <start of life> <end of life> <size in bytes> <index>". The blocks of each backend of each trace
+// become a model of their own, named "<trace file>:<backend>".
+bool LoadTraces(const std::vector<std::string>& traceFiles, std::vector<TestBlock>& traces)
+{
+    for (const auto& traceFile : traceFiles)
+    {
+        std::ifstream stream(traceFile);
+        if (!stream.is_open())
+        {
+            std::cout << "Trace file not found: " << traceFile << "\n";
+            return false;
+        }
+
+        std::map<std::string, std::vector<armnn::MemBlock>> backendBlocks;
+        std::string line;
+        unsigned int lineNumber = 0;
+        while (std::getline(stream, line))
+        {
+            ++lineNumber;
+            if (line.find_first_not_of(" \t\r") == std::string::npos)
+            {
+                continue;
+            }
+
+            std::istringstream lineStream(line);
+            std::string backendId;
+            unsigned int startOfLife = 0;
+            unsigned int endOfLife = 0;
+            size_t memSize = 0;
+            unsigned int index = 0;
+            if (!(lineStream >> backendId >> startOfLife >> endOfLife >> memSize >> index) || startOfLife > endOfLife)
+            {
+                std::cout << "Invalid memory block in " << traceFile << " at line " << lineNumber << "\n";
+                return false;
+            }
+            backendBlocks[backendId].emplace_back(startOfLife, endOfLife, memSize, 0, index);
+        }
+
+        for (auto& blocks : backendBlocks)
+        {
+            traceBlocks.push_back(std::move(blocks.second));
+            traces.push_back({traceFile + ":" + blocks.first, traceBlocks.back()});
+        }
+    }
+    return true;
+}
+
 void PrintModels()
 {
     std::cout << "Available models:\n";
@@ -58,6 +114,57 @@ size_t GetMinPossibleMemorySize(const std::vector<armnn::MemBlock>& blocks)
    return *std::max_element(lifetimes.begin(), lifetimes.end());
 }
 
+// Returns, as a percentage, how much of the free memory of the bins is split into holes smaller than the largest one,
+// averaged over the timesteps. It is 0 when, at every timestep, all the free memory could hold a single block.
+float GetFragmentation(const std::vector<armnn::MemBin>& bins)
+{
+    unsigned int maxLifetime = 0;
+    for (const auto& bin : bins)
+    {
+        for (const auto& block : bin.m_MemBlocks)
+        {
+            maxLifetime = std::max(maxLifetime, block.m_EndOfLife);
+        }
+    }
+
+    float fragmentation = 0;
+    for (unsigned int lifetime = 0; lifetime <= maxLifetime; ++lifetime)
+    {
+        size_t freeMemory = 0;
+        size_t largestHole = 0;
+        for (const auto& bin : bins)
+        {
+            std::vector<std::pair<size_t, size_t>> usedMemory;
+            for (const auto& block : bin.m_MemBlocks)
+            {
+                if (block.m_StartOfLife <= lifetime && lifetime <= block.m_EndOfLife)
+                {
+                    usedMemory.emplace_back(block.m_Offset, block.m_Offset + block.m_MemSize);
+                }
+            }
+            std::sort(usedMemory.begin(), usedMemory.end());
+            // Marks the end of the bin as used, to count the hole before it
+            usedMemory.emplace_back(bin.m_MemSize, bin.m_MemSize);
+
+            size_t position = 0;
+            for (const auto& used : usedMemory)
+            {
+                if (used.first > position)
+                {
+                    freeMemory += used.first - position;
+                    largestHole = std::max(largestHole, used.first - position);
+                }
+                position = std::max(position, used.second);
+            }
+        }
+        if (freeMemory != 0)
+        {
+            fragmentation += 1 - static_cast<float>(largestHole) / static_cast<float>(freeMemory);
+        }
+    }
+    return 100 * fragmentation / static_cast<float>(maxLifetime + 1);
+}
+
 void RunBenchmark(armnn::IMemoryOptimizerStrategy* strategy, std::vector<TestBlock>* models)
 {
     using Clock = std::chrono::high_resolution_clock;
@@ -91,6 +198,8 @@ void RunBenchmark(armnn::IMemoryOptimizerStrategy* strategy, std::vector<TestBlo
         std::cout << "Minimum possible usage: " << minSize/1024 << " kb\n";
 
         std::cout << "Memory efficiency: " << std::setprecision(3) << efficiency << "%\n";
+
+        std::cout << "Fragmentation: " << std::setprecision(3) << GetFragmentation(result) << "%\n";
     }
 
     avgDuration/= static_cast<double>(models->size());
@@ -101,12 +210,67 @@ void RunBenchmark(armnn::IMemoryOptimizerStrategy* strategy, std::vector<TestBlo
     std::cout << "Average memory efficiency: " << std::setprecision(3) << avgEfficiency << "%\n";
 }
 
+// Runs every strategy of the library on each model and prints their memory usage and execution time side by side
+void CompareStrategies(std::vector<TestBlock>* models, bool validate)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    std::vector<std::shared_ptr<armnn::IMemoryOptimizerStrategy>> strategies;
+    for (const auto& strategyName : armnn::GetMemoryOptimizerStrategyNames())
+    {
+        if (strategyName != "StrategyValidator")
+        {
+            strategies.push_back(armnn::GetMemoryOptimizerStrategy(strategyName));
+        }
+    }
+
+    std::cout << "\n" << std::left << std::setw(18) << "Model" << std::setw(24) << "Strategy"
+              << std::right << std::setw(14) << "Memory (kb)" << std::setw(14) << "Minimum (kb)"
+              << std::setw(12) << "Efficiency" << std::setw(15) << "Fragmentation" << std::setw(12) << "Time (ms)"
+              << "\n";
+    for (auto& model : *models)
+    {
+        const size_t minSize = GetMinPossibleMemorySize(model.m_Blocks);
+        for (auto& strategy : strategies)
+        {
+            armnn::StrategyValidator strategyValidator;
+            armnn::IMemoryOptimizerStrategy* strategyToRun = strategy.get();
+            if (validate)
+            {
+                strategyValidator.SetStrategy(strategy);
+                strategyToRun = &strategyValidator;
+            }
+
+            std::vector<armnn::MemBlock> blocks = model.m_Blocks;
+            auto now = Clock::now();
+            const std::vector<armnn::MemBin> result = strategyToRun->Optimize(blocks);
+            auto duration = std::chrono::duration<double, std::milli>(Clock::now() - now);
+
+            size_t memoryUsage = 0;
+            for (const auto& bin : result)
+            {
+                memoryUsage += bin.m_MemSize;
+            }
+            const float efficiency = 100 * static_cast<float>(minSize) / static_cast<float>(memoryUsage);
+
+            std::cout << std::left << std::setw(18) << model.m_Name << std::setw(24) << strategy->GetName()
+                      << std::right << std::setw(14) << memoryUsage / 1024 << std::setw(14) << minSize / 1024
+                      << std::setw(11) << std::fixed << std::setprecision(1) << efficiency << "%"
+                      << std::setw(14) << GetFragmentation(result) << "%"
+                      << std::setw(12) << std::setprecision(3) << duration.count() << "\n";
+            std::cout.unsetf(std::ios_base::floatfield);
+        }
+    }
+}
+
 struct BenchmarkOptions
 {
     std::string m_StrategyName;
     std::string m_ModelName;
+    std::vector<std::string> m_TraceFiles;
     bool m_UseDefaultStrategy = false;
     bool m_Validate = false;
+    bool m_Compare = false;
 };
 
 BenchmarkOptions ParseOptions(int argc, char* argv[])
@@ -117,6 +281,11 @@ BenchmarkOptions ParseOptions(int argc, char* argv[])
         ("s, strategy", "Strategy name, do not specify to use default strategy", cxxopts::value<std::string>())
         ("m, model", "Model name", cxxopts::value<std::string>())
         ("v, validate", "Validate strategy", cxxopts::value<bool>()->default_value("false")->implicit_value("true"))
+        ("c, compare", "Compare all the available strategies",
+            cxxopts::value<bool>()->default_value("false")->implicit_value("true"))
+        ("t, trace", "Replay the memory blocks of a network written by ExecuteNetwork --memory-profile-file instead "
+            "of the built-in models. Can be given several times. Compares all the available strategies unless a "
+            "strategy is given", cxxopts::value<std::vector<std::string>>())
         ("h,help", "Display usage information");
 
     auto result = options.parse(argc, argv);
@@ -136,11 +305,16 @@ BenchmarkOptions ParseOptions(int argc, char* argv[])
 
     BenchmarkOptions benchmarkOptions;
 
+    if (result.count("trace"))
+    {
+        benchmarkOptions.m_TraceFiles = result["trace"].as<std::vector<std::string>>();
+    }
+
     if(result.count("strategy"))
     {
         benchmarkOptions.m_StrategyName = result["strategy"].as<std::string>();
     }
-    else
+    else if (!result["compare"].as<bool>() && benchmarkOptions.m_TraceFiles.empty())
     {
         std::cout << "No Strategy given, using default strategy";
 
@@ -153,6 +327,8 @@ BenchmarkOptions ParseOptions(int argc, char* argv[])
     }
 
     benchmarkOptions.m_Validate = result["validate"].as<bool>();
+    benchmarkOptions.m_Compare = result["compare"].as<bool>() ||
+                                 (!benchmarkOptions.m_TraceFiles.empty() && !result.count("strategy"));
 
     return benchmarkOptions;
 }
@@ -167,7 +343,7 @@ int main(int argc, char* argv[])
     {
         strategy = std::make_shared<armnn::TestStrategy>();
     }
-    else
+    else if (!benchmarkOptions.m_Compare)
     {
         strategy = armnn::GetMemoryOptimizerStrategy(benchmarkOptions.m_StrategyName);
 
@@ -178,16 +354,27 @@ int main(int argc, char* argv[])
         }
     }
 
+    std::vector<TestBlock> traces;
+    std::vector<TestBlock>* models = &testBlocks;
+    if (!benchmarkOptions.m_TraceFiles.empty())
+    {
+        if (!LoadTraces(benchmarkOptions.m_TraceFiles, traces))
+        {
+            return 0;
+        }
+        models = &traces;
+    }
+
     std::vector<TestBlock> model;
-    std::vector<TestBlock>* modelsToTest = &testBlocks;
+    std::vector<TestBlock>* modelsToTest = models;
     if (benchmarkOptions.m_ModelName.size() != 0)
     {
-        auto it = std::find_if(testBlocks.cbegin(), testBlocks.cend(), [&](const TestBlock testBlock)
+        auto it = std::find_if(models->cbegin(), models->cend(), [&](const TestBlock testBlock)
         {
             return testBlock.m_Name == benchmarkOptions.m_ModelName;
         });
 
-        if (it == testBlocks.end())
+        if (it == models->end())
         {
             std::cout << "Model name not found\n";
             return 0;
@@ -199,7 +386,11 @@ int main(int argc, char* argv[])
         }
     }
 
-    if (benchmarkOptions.m_Validate)
+    if (benchmarkOptions.m_Compare)
+    {
+        CompareStrategies(modelsToTest, benchmarkOptions.m_Validate);
+    }
+    else if (benchmarkOptions.m_Validate)
     {
         armnn::StrategyValidator strategyValidator;
 
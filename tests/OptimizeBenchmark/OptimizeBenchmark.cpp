@@ -0,0 +1,173 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnn/IRuntime.hpp>
+#include <armnn/IStrategy.hpp>
+
+#include <cxxopts.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct BenchmarkOptions
+{
+    std::vector<unsigned int> m_NumLayers;
+    unsigned int m_Iterations = 1;
+    std::string m_Backend;
+};
+
+class LayerCounter : public armnn::IStrategy
+{
+public:
+    void ExecuteStrategy(const armnn::IConnectableLayer*,
+                         const armnn::BaseDescriptor&,
+                         const std::vector<armnn::ConstTensor>&,
+                         const char*,
+                         const armnn::LayerBindingId) override
+    {
+        ++m_NumLayers;
+    }
+
+    unsigned int m_NumLayers = 0;
+};
+
+/// Builds a chain of blocks of eight layers, giving the optimizer some work in every block: a pair of inverse
+/// transposes, a pair of consecutive reshapes and a batch normalization to fuse into a convolution, which adds new
+/// layers to the graph.
+armnn::INetworkPtr CreateSyntheticNetwork(unsigned int numLayers)
+{
+    using namespace armnn;
+
+    const TensorInfo info({ 1, 4, 4, 4 }, DataType::Float32);
+    const TensorInfo flatInfo({ 64 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 4, 1, 1, 4 }, DataType::Float32, 0.0f, 0, true);
+    const TensorInfo channelInfo({ 4 }, DataType::Float32, 0.0f, 0, true);
+
+    const std::vector<float> weightsData(weightsInfo.GetNumElements(), 0.25f);
+    const std::vector<float> channelData(channelInfo.GetNumElements(), 1.0f);
+    const ConstTensor weights(weightsInfo, weightsData);
+    const ConstTensor channelValues(channelInfo, channelData);
+
+    Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_StrideX = 1;
+    convolutionDescriptor.m_StrideY = 1;
+    convolutionDescriptor.m_DataLayout = DataLayout::NHWC;
+    BatchNormalizationDescriptor batchNormDescriptor;
+    batchNormDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* previous = network->AddInputLayer(0, "input");
+    previous->GetOutputSlot(0).SetTensorInfo(info);
+
+    auto append = [&](IConnectableLayer* layer, const TensorInfo& outputInfo)
+    {
+        previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+        layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+        previous = layer;
+    };
+
+    const unsigned int numBlocks = std::max(1u, numLayers / 8);
+    for (unsigned int i = 0; i < numBlocks; ++i)
+    {
+        const std::string suffix = std::to_string(i);
+        append(network->AddActivationLayer(ActivationDescriptor(ActivationFunction::ReLu),
+                                           ("relu" + suffix).c_str()), info);
+        append(network->AddTransposeLayer(TransposeDescriptor({ 0, 2, 3, 1 }), ("transpose" + suffix).c_str()),
+               info);
+        append(network->AddTransposeLayer(TransposeDescriptor({ 0, 3, 1, 2 }), ("inverse" + suffix).c_str()),
+               info);
+        append(network->AddReshapeLayer(ReshapeDescriptor(flatInfo.GetShape()), ("flatten" + suffix).c_str()),
+               flatInfo);
+        append(network->AddReshapeLayer(ReshapeDescriptor(info.GetShape()), ("unflatten" + suffix).c_str()), info);
+
+        IConnectableLayer* convolution = network->AddConvolution2dLayer(convolutionDescriptor,
+                                                                        ("convolution" + suffix).c_str());
+        IConnectableLayer* weightsLayer = network->AddConstantLayer(weights, ("weights" + suffix).c_str());
+        weightsLayer->GetOutputSlot(0).SetTensorInfo(weightsInfo);
+        weightsLayer->GetOutputSlot(0).Connect(convolution->GetInputSlot(1));
+        append(convolution, info);
+        append(network->AddBatchNormalizationLayer(batchNormDescriptor, channelValues, channelValues, channelValues,
+                                                   channelValues, ("batchNorm" + suffix).c_str()), info);
+    }
+
+    previous->GetOutputSlot(0).Connect(network->AddOutputLayer(0, "output")->GetInputSlot(0));
+    return network;
+}
+
+void RunBenchmark(const BenchmarkOptions& options)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    armnn::IRuntimePtr runtime = armnn::IRuntime::Create(armnn::IRuntime::CreationOptions());
+
+    std::cout << "Backend: " << options.m_Backend << "\n";
+    std::cout << "===============================================\n";
+    for (unsigned int numLayers : options.m_NumLayers)
+    {
+        armnn::INetworkPtr network = CreateSyntheticNetwork(numLayers);
+
+        std::chrono::duration<double, std::milli> totalDuration{};
+        unsigned int numOptimizedLayers = 0;
+        for (unsigned int i = 0; i < options.m_Iterations; ++i)
+        {
+            auto start = Clock::now();
+            armnn::IOptimizedNetworkPtr optimizedNetwork =
+                armnn::Optimize(*network, { options.m_Backend }, runtime->GetDeviceSpec());
+            totalDuration += Clock::now() - start;
+
+            LayerCounter counter;
+            optimizedNetwork->ExecuteStrategy(counter);
+            numOptimizedLayers = counter.m_NumLayers;
+        }
+
+        std::cout << "\nLayers: " << numLayers << "\n";
+        std::cout << "Layers after optimization: " << numOptimizedLayers << "\n";
+        std::cout << "Optimize time: " << std::setprecision(4)
+                  << totalDuration.count() / options.m_Iterations << " milliseconds\n";
+    }
+}
+
+BenchmarkOptions ParseOptions(int argc, char* argv[])
+{
+    cxxopts::Options options("Optimize Benchmark", "Times armnn::Optimize on synthetic networks of increasing size");
+
+    options.add_options()
+        ("l, layers", "Comma separated numbers of layers of the synthetic networks",
+            cxxopts::value<std::vector<unsigned int>>()->default_value("1000,10000,100000"))
+        ("i, iterations", "Number of times each network is optimized",
+            cxxopts::value<unsigned int>()->default_value("1"))
+        ("b, backend", "Backend to optimize for", cxxopts::value<std::string>()->default_value("CpuRef"))
+        ("h,help", "Display usage information");
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help"))
+    {
+        std::cout << options.help() << std::endl;
+        exit(EXIT_SUCCESS);
+    }
+
+    BenchmarkOptions benchmarkOptions;
+    benchmarkOptions.m_NumLayers = result["layers"].as<std::vector<unsigned int>>();
+    benchmarkOptions.m_Iterations = std::max(1u, result["iterations"].as<unsigned int>());
+    benchmarkOptions.m_Backend = result["backend"].as<std::string>();
+    return benchmarkOptions;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    RunBenchmark(ParseOptions(argc, argv));
+    return 0;
+}
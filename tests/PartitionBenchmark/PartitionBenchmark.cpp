@@ -0,0 +1,145 @@
+//
+// Copyright © 2026 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <Graph.hpp>
+#include <SubgraphViewSelector.hpp>
+
+#include <armnn/BackendId.hpp>
+#include <armnn/Descriptors.hpp>
+
+#include <cxxopts.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct BenchmarkOptions
+{
+    std::vector<unsigned int> m_NumLayers;
+    unsigned int m_RunLength = 1;
+    unsigned int m_Iterations = 1;
+};
+
+const std::vector<armnn::BackendId> g_Backends = { "CpuAcc", "CpuRef" };
+
+/// Builds a chain of activations with a residual addition every fourth layer, assigning the layers to the backends in
+/// turn, m_RunLength consecutive layers at a time, as if each backend only supported some of the layers.
+void CreateSyntheticGraph(armnn::Graph& graph, unsigned int numLayers, unsigned int runLength)
+{
+    using namespace armnn;
+
+    const TensorInfo info({ 1, 16 }, DataType::Float32);
+
+    Layer* previous = graph.AddLayer<InputLayer>(0, "input");
+    previous->GetOutputSlot(0).SetTensorInfo(info);
+    Layer* residual = previous;
+
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        const std::string name = std::to_string(i);
+        Layer* layer = nullptr;
+        if (i % 4 == 3)
+        {
+            layer = graph.AddLayer<ElementwiseBinaryLayer>(ElementwiseBinaryDescriptor(BinaryOperation::Add),
+                                                           ("add" + name).c_str());
+            residual->GetOutputSlot(0).Connect(layer->GetInputSlot(1));
+            residual = layer;
+        }
+        else
+        {
+            layer = graph.AddLayer<ActivationLayer>(ActivationDescriptor(), ("relu" + name).c_str());
+        }
+        previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+        layer->GetOutputSlot(0).SetTensorInfo(info);
+        layer->SetBackendId(g_Backends[(i / runLength) % g_Backends.size()]);
+        previous = layer;
+    }
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+    output->SetBackendId(g_Backends.back());
+    previous->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    graph.TopologicalSort();
+}
+
+void RunBenchmark(const BenchmarkOptions& options)
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    std::cout << "Consecutive layers per backend: " << options.m_RunLength << "\n";
+    std::cout << "===============================================\n";
+    for (unsigned int numLayers : options.m_NumLayers)
+    {
+        armnn::Graph graph;
+        CreateSyntheticGraph(graph, numLayers, options.m_RunLength);
+
+        std::chrono::duration<double, std::milli> totalDuration{};
+        size_t numSubgraphs = 0;
+        for (unsigned int i = 0; i < options.m_Iterations; ++i)
+        {
+            numSubgraphs = 0;
+            auto start = Clock::now();
+            // Select the subgraphs of each backend in turn, like ApplyBackendOptimizations
+            for (const armnn::BackendId& backend : g_Backends)
+            {
+                armnn::SubgraphViewSelector::Subgraphs subgraphs =
+                    armnn::SubgraphViewSelector::SelectSubgraphs(graph, [&backend](const armnn::Layer& layer)
+                    {
+                        return layer.GetType() != armnn::LayerType::Input &&
+                               layer.GetType() != armnn::LayerType::Output &&
+                               layer.GetBackendId() == backend;
+                    });
+                numSubgraphs += subgraphs.size();
+            }
+            totalDuration += Clock::now() - start;
+        }
+
+        std::cout << "\nLayers: " << numLayers << "\n";
+        std::cout << "Subgraphs: " << numSubgraphs << "\n";
+        std::cout << "Partitioning time: " << std::setprecision(4)
+                  << totalDuration.count() / options.m_Iterations << " milliseconds\n";
+    }
+}
+
+BenchmarkOptions ParseOptions(int argc, char* argv[])
+{
+    cxxopts::Options options("Partition Benchmark",
+                             "Times the partitioning of synthetic graphs of increasing size between two backends");
+
+    options.add_options()
+        ("l, layers", "Comma separated numbers of layers of the synthetic graphs",
+            cxxopts::value<std::vector<unsigned int>>()->default_value("1000,10000,100000"))
+        ("r, run-length", "Number of consecutive layers assigned to the same backend",
+            cxxopts::value<unsigned int>()->default_value("1"))
+        ("i, iterations", "Number of times each graph is partitioned",
+            cxxopts::value<unsigned int>()->default_value("1"))
+        ("h,help", "Display usage information");
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help"))
+    {
+        std::cout << options.help() << std::endl;
+        exit(EXIT_SUCCESS);
+    }
+
+    BenchmarkOptions benchmarkOptions;
+    benchmarkOptions.m_NumLayers = result["layers"].as<std::vector<unsigned int>>();
+    benchmarkOptions.m_RunLength = std::max(1u, result["run-length"].as<unsigned int>());
+    benchmarkOptions.m_Iterations = std::max(1u, result["iterations"].as<unsigned int>());
+    return benchmarkOptions;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    RunBenchmark(ParseOptions(argc, argv));
+    return 0;
+}